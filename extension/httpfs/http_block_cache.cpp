@@ -0,0 +1,345 @@
+#include "http_block_cache.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+HTTPBlockCacheParams HTTPBlockCacheParams::ReadFrom(FileOpener *opener) {
+	bool enabled = false;
+	idx_t memory_limit = DEFAULT_MEMORY_LIMIT;
+	idx_t disk_limit = DEFAULT_DISK_LIMIT;
+	string directory;
+	Value value;
+	if (FileOpener::TryGetCurrentSetting(opener, "enable_http_block_cache", value)) {
+		enabled = value.GetValue<bool>();
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_memory_limit", value)) {
+		memory_limit = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_disk_limit", value)) {
+		disk_limit = DBConfig::ParseMemoryLimit(value.GetValue<string>());
+	}
+	if (FileOpener::TryGetCurrentSetting(opener, "http_block_cache_directory", value) && !value.IsNull()) {
+		directory = value.GetValue<string>();
+	}
+	return {enabled, memory_limit, disk_limit, directory};
+}
+
+HTTPBlockCache::HTTPBlockCache(BufferManager &buffer_manager, idx_t memory_limit_p, idx_t disk_limit_p,
+                               string directory_p)
+    : buffer_manager(buffer_manager), memory_limit(memory_limit_p), disk_limit(disk_limit_p),
+      directory(std::move(directory_p)), local_fs(FileSystem::CreateLocal()), memory_size(0), disk_size(0) {
+	if (!directory.empty()) {
+		if (!local_fs->DirectoryExists(directory)) {
+			local_fs->CreateDirectory(directory);
+		}
+		LoadDirectory();
+	}
+}
+
+shared_ptr<HTTPBlockCache> HTTPBlockCache::TryGetCache(FileOpener *opener) {
+	auto client_context = FileOpener::TryGetClientContext(opener);
+	if (!client_context) {
+		return nullptr;
+	}
+	auto params = HTTPBlockCacheParams::ReadFrom(opener);
+	if (!params.enabled) {
+		return nullptr;
+	}
+
+	// the cache is created by the first handle that needs it, and replaced when it moves to another directory
+	static mutex creation_lock;
+	lock_guard<mutex> guard(creation_lock);
+	auto &object_cache = ObjectCache::GetObjectCache(*client_context);
+	auto cache = object_cache.Get<HTTPBlockCache>(ObjectType());
+	if (!cache || cache->GetDirectory() != params.directory) {
+		cache = make_shared<HTTPBlockCache>(BufferManager::GetBufferManager(*client_context), params.memory_limit,
+		                                    params.disk_limit, params.directory);
+		object_cache.Put(ObjectType(), cache);
+	} else {
+		cache->SetLimits(params.memory_limit, params.disk_limit);
+	}
+	return cache;
+}
+
+string HTTPBlockCache::GetBlockKey(const string &url, const string &version, idx_t block_idx) {
+	return url + "\n" + version + "\n" + to_string(block_idx);
+}
+
+bool HTTPBlockCache::Get(const string &block_key, data_ptr_t buffer, idx_t block_len) {
+	if (ReadFromMemory(block_key, buffer, block_len)) {
+		memory_hits++;
+		return true;
+	}
+	if (ReadFromDisk(block_key, buffer, block_len)) {
+		PutInMemory(block_key, buffer, block_len);
+		disk_hits++;
+		return true;
+	}
+	misses++;
+	return false;
+}
+
+bool HTTPBlockCache::Contains(const string &block_key) {
+	lock_guard<mutex> guard(lock);
+	if (memory_map.find(block_key) != memory_map.end()) {
+		return true;
+	}
+	auto file_name = GetFileName(block_key);
+	return disk_map.find(file_name) != disk_map.end();
+}
+
+void HTTPBlockCache::Put(const string &block_key, const_data_ptr_t buffer, idx_t block_len) {
+	PutInMemory(block_key, buffer, block_len);
+	if (!directory.empty()) {
+		PutOnDisk(block_key, buffer, block_len);
+	}
+}
+
+void HTTPBlockCache::SetLimits(idx_t memory_limit_p, idx_t disk_limit_p) {
+	vector<shared_ptr<BlockHandle>> evicted_buffers;
+	vector<string> removed_files;
+	{
+		lock_guard<mutex> guard(lock);
+		memory_limit = memory_limit_p;
+		disk_limit = disk_limit_p;
+		EvictMemory(evicted_buffers);
+		EvictDisk(removed_files);
+	}
+	RemoveFiles(removed_files);
+}
+
+bool HTTPBlockCache::ReadFromMemory(const string &block_key, data_ptr_t buffer, idx_t block_len) {
+	shared_ptr<BlockHandle> block;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = memory_map.find(block_key);
+		if (entry == memory_map.end() || entry->second->size != block_len) {
+			return false;
+		}
+		memory_blocks.splice(memory_blocks.begin(), memory_blocks, entry->second);
+		block = entry->second->buffer;
+	}
+	// the block stays pinned until we are done copying it, even if it is evicted from the cache in the meantime
+	auto pinned_block = buffer_manager.Pin(block);
+	if (!pinned_block.IsValid()) {
+		// the buffer manager destroyed the block to free up memory
+		ForgetMemoryBlock(block_key, block);
+		return false;
+	}
+	memcpy(buffer, pinned_block.Ptr(), block_len);
+	return true;
+}
+
+void HTTPBlockCache::PutInMemory(const string &block_key, const_data_ptr_t buffer, idx_t block_len) {
+	// the buffer manager only hands out buffers of at least a block
+	const auto alloc_len = MaxValue<idx_t>(block_len, Storage::BLOCK_SIZE);
+	{
+		lock_guard<mutex> guard(lock);
+		if (alloc_len > memory_limit) {
+			return;
+		}
+	}
+	shared_ptr<BlockHandle> block;
+	idx_t memory_usage;
+	try {
+		// the block is unpinned once it is filled, so that the buffer manager can destroy it when it runs out of memory
+		auto pinned_block = buffer_manager.Allocate(alloc_len);
+		memcpy(pinned_block.Ptr(), buffer, block_len);
+		memory_usage = pinned_block.GetFileBuffer().AllocSize();
+		block = pinned_block.GetBlockHandle();
+	} catch (OutOfMemoryException &ex) {
+		// the memory is needed elsewhere, so do not cache the block in memory
+		return;
+	}
+
+	vector<shared_ptr<BlockHandle>> evicted_buffers;
+	lock_guard<mutex> guard(lock);
+	auto entry = memory_map.find(block_key);
+	if (entry != memory_map.end()) {
+		memory_size -= entry->second->memory_usage;
+		evicted_buffers.push_back(std::move(entry->second->buffer));
+		memory_blocks.erase(entry->second);
+		memory_map.erase(entry);
+	}
+	memory_blocks.push_front(MemoryBlock {block_key, std::move(block), block_len, memory_usage});
+	memory_map[block_key] = memory_blocks.begin();
+	memory_size += memory_usage;
+	EvictMemory(evicted_buffers);
+}
+
+string HTTPBlockCache::GetFileName(const string &block_key) {
+	return to_string(Hash(block_key.c_str(), block_key.size())) + ".block";
+}
+
+string HTTPBlockCache::GetFilePath(const string &file_name) const {
+	return local_fs->JoinPath(directory, file_name);
+}
+
+// Block files start with the length of the key and the key itself, so that hash collisions are detected
+void HTTPBlockCache::PutOnDisk(const string &block_key, const_data_ptr_t buffer, idx_t block_len) {
+	uint64_t key_len = block_key.size();
+	const auto file_size = sizeof(key_len) + key_len + block_len;
+	{
+		lock_guard<mutex> guard(lock);
+		if (file_size > disk_limit) {
+			return;
+		}
+	}
+	auto file_name = GetFileName(block_key);
+	auto file_path = GetFilePath(file_name);
+	auto temp_path = file_path + "." + to_string(temp_file_counter++) + ".tmp";
+	try {
+		// write to a temporary file first, so readers never see a partially written block
+		auto handle =
+		    local_fs->OpenFile(temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		local_fs->Write(*handle, &key_len, sizeof(key_len), 0);
+		local_fs->Write(*handle, (void *)block_key.c_str(), key_len, sizeof(key_len));
+		local_fs->Write(*handle, (void *)buffer, block_len, sizeof(key_len) + key_len);
+		handle->Close();
+		local_fs->MoveFile(temp_path, file_path);
+	} catch (IOException &ex) {
+		// the disk is only a second level of the cache, the block is still cached in memory
+		try {
+			local_fs->RemoveFile(temp_path);
+		} catch (IOException &) {
+			// the temporary file was not created
+		}
+		return;
+	}
+
+	vector<string> removed_files;
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = disk_map.find(file_name);
+		if (entry != disk_map.end()) {
+			disk_size -= entry->second->size;
+			disk_blocks.erase(entry->second);
+			disk_map.erase(entry);
+		}
+		disk_blocks.push_front(DiskBlock {file_name, file_size});
+		disk_map[file_name] = disk_blocks.begin();
+		disk_size += file_size;
+		EvictDisk(removed_files);
+	}
+	RemoveFiles(removed_files);
+}
+
+bool HTTPBlockCache::ReadFromDisk(const string &block_key, data_ptr_t buffer, idx_t block_len) {
+	if (directory.empty()) {
+		return false;
+	}
+	auto file_name = GetFileName(block_key);
+	uint64_t key_len = block_key.size();
+	{
+		lock_guard<mutex> guard(lock);
+		auto entry = disk_map.find(file_name);
+		if (entry == disk_map.end() || entry->second->size != sizeof(key_len) + key_len + block_len) {
+			return false;
+		}
+		disk_blocks.splice(disk_blocks.begin(), disk_blocks, entry->second);
+	}
+	// block files are replaced by renaming them, so the file is either the old or the new version of the block
+	try {
+		auto handle = local_fs->OpenFile(GetFilePath(file_name), FileFlags::FILE_FLAGS_READ);
+		if (idx_t(local_fs->GetFileSize(*handle)) != sizeof(key_len) + key_len + block_len) {
+			return false;
+		}
+		uint64_t stored_key_len;
+		local_fs->Read(*handle, &stored_key_len, sizeof(stored_key_len), 0);
+		if (stored_key_len != key_len) {
+			return false;
+		}
+		string stored_key(key_len, '\0');
+		local_fs->Read(*handle, (void *)stored_key.data(), key_len, sizeof(key_len));
+		if (stored_key != block_key) {
+			return false;
+		}
+		local_fs->Read(*handle, buffer, block_len, sizeof(key_len) + key_len);
+	} catch (IOException &ex) {
+		// the file was evicted, removed or damaged, forget about it
+		ForgetDiskBlock(file_name);
+		return false;
+	}
+	return true;
+}
+
+void HTTPBlockCache::ForgetMemoryBlock(const string &block_key, const shared_ptr<BlockHandle> &buffer) {
+	shared_ptr<BlockHandle> destroyed_buffer;
+	lock_guard<mutex> guard(lock);
+	auto entry = memory_map.find(block_key);
+	if (entry != memory_map.end() && entry->second->buffer == buffer) {
+		memory_size -= entry->second->memory_usage;
+		destroyed_buffer = std::move(entry->second->buffer);
+		memory_blocks.erase(entry->second);
+		memory_map.erase(entry);
+	}
+}
+
+void HTTPBlockCache::ForgetDiskBlock(const string &file_name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = disk_map.find(file_name);
+	if (entry != disk_map.end()) {
+		disk_size -= entry->second->size;
+		disk_blocks.erase(entry->second);
+		disk_map.erase(entry);
+	}
+}
+
+void HTTPBlockCache::LoadDirectory() {
+	vector<string> file_names;
+	local_fs->ListFiles(directory, [&](const string &name, bool is_directory) {
+		if (!is_directory && StringUtil::EndsWith(name, ".block")) {
+			file_names.push_back(name);
+		}
+	});
+	for (auto &file_name : file_names) {
+		try {
+			auto handle = local_fs->OpenFile(GetFilePath(file_name), FileFlags::FILE_FLAGS_READ);
+			auto file_size = local_fs->GetFileSize(*handle);
+			disk_blocks.push_back(DiskBlock {file_name, idx_t(file_size)});
+			disk_map[file_name] = std::prev(disk_blocks.end());
+			disk_size += file_size;
+		} catch (IOException &ex) {
+			continue;
+		}
+	}
+	vector<string> removed_files;
+	EvictDisk(removed_files);
+	RemoveFiles(removed_files);
+}
+
+void HTTPBlockCache::EvictMemory(vector<shared_ptr<BlockHandle>> &evicted_buffers) {
+	while (memory_size > memory_limit && !memory_blocks.empty()) {
+		auto &block = memory_blocks.back();
+		memory_size -= block.memory_usage;
+		evicted_buffers.push_back(std::move(block.buffer));
+		memory_map.erase(block.key);
+		memory_blocks.pop_back();
+	}
+}
+
+void HTTPBlockCache::EvictDisk(vector<string> &removed_files) {
+	while (disk_size > disk_limit && !disk_blocks.empty()) {
+		auto &block = disk_blocks.back();
+		removed_files.push_back(block.file_name);
+		disk_size -= block.size;
+		disk_map.erase(block.file_name);
+		disk_blocks.pop_back();
+	}
+}
+
+void HTTPBlockCache::RemoveFiles(const vector<string> &file_names) {
+	for (auto &file_name : file_names) {
+		try {
+			local_fs->RemoveFile(GetFilePath(file_name));
+		} catch (IOException &ex) {
+			// the file is gone already
+		}
+	}
+}
+
+} // namespace duckdb
@@ -28,6 +28,25 @@ static void LoadInternal(DatabaseInstance &instance) {
 	config.AddExtensionOption("http_retry_backoff",
 	                          "Backoff factor for exponentially increasing retry wait time (default 4)",
 	                          LogicalType::FLOAT, Value(4));
+	config.AddExtensionOption("http_max_concurrent_requests",
+	                          "Maximum number of concurrent requests of a batched read of a file (default 8)",
+	                          LogicalType::UBIGINT, Value(8));
+
+	// HTTP block cache config
+	config.AddExtensionOption("enable_http_block_cache",
+	                          "Cache the blocks that are read from HTTP and S3 files, for as long as the files do not "
+	                          "change (default false)",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("http_block_cache_memory_limit",
+	                          "Maximum size of the HTTP block cache in memory (default 256MB)", LogicalType::VARCHAR,
+	                          Value("256MB"));
+	config.AddExtensionOption("http_block_cache_directory",
+	                          "Directory that the HTTP block cache persists blocks in, across queries and restarts "
+	                          "(default empty, only cache blocks in memory)",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("http_block_cache_disk_limit",
+	                          "Maximum size of the HTTP block cache directory (default 4GB)", LogicalType::VARCHAR,
+	                          Value("4GB"));
 
 	// Global S3 config
 	config.AddExtensionOption("s3_region", "S3 Region", LogicalType::VARCHAR);
@@ -1,8 +1,10 @@
 #include "httpfs.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/http_stats.hpp"
+#include "duckdb/common/io_thread_pool.hpp"
 #include "duckdb/common/thread.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/common/types/hash.hpp"
@@ -33,6 +35,7 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	uint64_t retries = DEFAULT_RETRIES;
 	uint64_t retry_wait_ms = DEFAULT_RETRY_WAIT_MS;
 	float retry_backoff = DEFAULT_RETRY_BACKOFF;
+	uint64_t max_concurrent_requests = DEFAULT_MAX_CONCURRENT_REQUESTS;
 	Value value;
 	if (FileOpener::TryGetCurrentSetting(opener, "http_timeout", value)) {
 		timeout = value.GetValue<uint64_t>();
@@ -46,7 +49,10 @@ HTTPParams HTTPParams::ReadFrom(FileOpener *opener) {
 	if (FileOpener::TryGetCurrentSetting(opener, "http_retry_backoff", value)) {
 		retry_backoff = value.GetValue<float>();
 	}
-	return {timeout, retries, retry_wait_ms, retry_backoff};
+	if (FileOpener::TryGetCurrentSetting(opener, "http_max_concurrent_requests", value)) {
+		max_concurrent_requests = MaxValue<uint64_t>(value.GetValue<uint64_t>(), 1);
+	}
+	return {timeout, retries, retry_wait_ms, retry_backoff, max_concurrent_requests};
 }
 
 void HTTPFileSystem::ParseUrl(string &url, string &path_out, string &proto_host_port_out) {
@@ -236,11 +242,17 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 
 	idx_t out_offset = 0;
 
+	// requests of a batched read run concurrently, each of them on its own client
+	auto client = hfs.AcquireClient();
+	if (!client) {
+		client = GetClient(hfs.http_params, proto_host_port.c_str());
+	}
+
 	std::function<duckdb_httplib_openssl::Result(void)> request([&]() {
 		if (hfs.stats) {
 			hfs.stats->get_count++;
 		}
-		return hfs.http_client->Get(
+		return client->Get(
 		    path.c_str(), *headers,
 		    [&](const duckdb_httplib_openssl::Response &response) {
 			    if (response.status >= 400) {
@@ -271,15 +283,39 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 		    });
 	});
 
-	std::function<void(void)> on_retry(
-	    [&]() { hfs.http_client = GetClient(hfs.http_params, proto_host_port.c_str()); });
+	std::function<void(void)> on_retry([&]() { client = GetClient(hfs.http_params, proto_host_port.c_str()); });
 
-	return RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	auto response = RunRequestWithRetry(request, url, "GET Range", hfs.http_params, on_retry);
+	hfs.ReleaseClient(std::move(client));
+	return response;
 }
 
 HTTPFileHandle::HTTPFileHandle(FileSystem &fs, string path, uint8_t flags, const HTTPParams &http_params)
-    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), buffer_available(0), buffer_idx(0),
-      file_offset(0), buffer_start(0), buffer_end(0) {
+    : FileHandle(fs, path), http_params(http_params), flags(flags), length(0), last_modified(0), buffer_available(0),
+      buffer_idx(0), file_offset(0), buffer_start(0), buffer_end(0) {
+}
+
+unique_ptr<duckdb_httplib_openssl::Client> HTTPFileHandle::AcquireClient() {
+	lock_guard<mutex> guard(client_lock);
+	if (http_client) {
+		return std::move(http_client);
+	}
+	if (client_pool.empty()) {
+		return nullptr;
+	}
+	auto client = std::move(client_pool.back());
+	client_pool.pop_back();
+	return client;
+}
+
+void HTTPFileHandle::ReleaseClient(unique_ptr<duckdb_httplib_openssl::Client> client) {
+	lock_guard<mutex> guard(client_lock);
+	if (!http_client) {
+		http_client = std::move(client);
+	} else if (client_pool.size() + 1 < http_params.max_concurrent_requests) {
+		client_pool.push_back(std::move(client));
+	}
+	// otherwise enough connections are kept alive for the concurrent requests already, and this one is closed
 }
 
 unique_ptr<HTTPFileHandle> HTTPFileSystem::CreateHandle(const string &path, uint8_t flags, FileLockType lock,
@@ -297,6 +333,83 @@ unique_ptr<FileHandle> HTTPFileSystem::OpenFile(const string &path, uint8_t flag
 	return std::move(handle);
 }
 
+// Read through the block cache: cached blocks are copied, consecutive blocks that are not cached are downloaded with a
+// single request and added to the cache
+static void ReadThroughBlockCache(HTTPFileSystem &hfs, HTTPFileHandle &hfh, data_ptr_t buffer, idx_t nr_bytes,
+                                  idx_t location) {
+	auto &cache = *hfh.block_cache;
+	const auto block_size = HTTPBlockCache::CACHE_BLOCK_SIZE;
+	const auto read_end = location + nr_bytes;
+	const auto end_block = (read_end + block_size - 1) / block_size;
+	unique_ptr<data_t[]> block_buffer;
+
+	for (auto block_idx = location / block_size; block_idx < end_block;) {
+		const auto block_start = block_idx * block_size;
+		const auto block_len = MinValue<idx_t>(block_size, hfh.length - block_start);
+		const auto copy_start = MaxValue<idx_t>(block_start, location);
+		const auto copy_end = MinValue<idx_t>(block_start + block_len, read_end);
+
+		// Blocks that are entirely read are copied straight into the buffer
+		auto block_key = HTTPBlockCache::GetBlockKey(hfh.path, hfh.cache_version, block_idx);
+		const auto whole_block = copy_start == block_start && copy_end == block_start + block_len;
+		if (whole_block) {
+			if (cache.Get(block_key, buffer + (block_start - location), block_len)) {
+				if (hfh.stats) {
+					hfh.stats->cache_hit_count++;
+				}
+				block_idx++;
+				continue;
+			}
+		} else {
+			if (!block_buffer) {
+				block_buffer = unique_ptr<data_t[]>(new data_t[block_size]);
+			}
+			if (cache.Get(block_key, block_buffer.get(), block_len)) {
+				if (hfh.stats) {
+					hfh.stats->cache_hit_count++;
+				}
+				memcpy(buffer + (copy_start - location), block_buffer.get() + (copy_start - block_start),
+				       copy_end - copy_start);
+				block_idx++;
+				continue;
+			}
+		}
+
+		// Download this block together with the blocks that follow it and are not cached either
+		auto run_end = block_idx + 1;
+		while (run_end < end_block &&
+		       !cache.Contains(HTTPBlockCache::GetBlockKey(hfh.path, hfh.cache_version, run_end))) {
+			run_end++;
+		}
+		if (hfh.stats) {
+			hfh.stats->cache_miss_count += run_end - block_idx;
+		}
+		const auto run_end_offset = MinValue<idx_t>(run_end * block_size, hfh.length);
+		const auto run_len = run_end_offset - block_start;
+		unique_ptr<data_t[]> run_buffer;
+		data_ptr_t run_ptr;
+		if (block_start >= location && run_end_offset <= read_end) {
+			run_ptr = buffer + (block_start - location);
+		} else {
+			run_buffer = unique_ptr<data_t[]>(new data_t[run_len]);
+			run_ptr = run_buffer.get();
+		}
+		hfs.GetRangeRequest(hfh, hfh.path, {}, block_start, (char *)run_ptr, run_len);
+		for (auto run_idx = block_idx; run_idx < run_end; run_idx++) {
+			const auto offset = (run_idx - block_idx) * block_size;
+			cache.Put(HTTPBlockCache::GetBlockKey(hfh.path, hfh.cache_version, run_idx), run_ptr + offset,
+			          MinValue<idx_t>(block_size, run_len - offset));
+		}
+		if (run_buffer) {
+			const auto run_copy_start = MaxValue<idx_t>(block_start, location);
+			const auto run_copy_end = MinValue<idx_t>(run_end_offset, read_end);
+			memcpy(buffer + (run_copy_start - location), run_ptr + (run_copy_start - block_start),
+			       run_copy_end - run_copy_start);
+		}
+		block_idx = run_end;
+	}
+}
+
 // Buffered read from http file.
 // Note that buffering is disabled when FileFlags::FILE_FLAGS_DIRECT_IO is set
 void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
@@ -307,6 +420,15 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 		throw IOException("out of file");
 	}
 
+	// The block cache replaces the read buffer of the handle
+	if (hfh.block_cache && to_read > 0) {
+		ReadThroughBlockCache(*this, hfh, (data_ptr_t)buffer, to_read, location);
+		hfh.buffer_available = 0;
+		hfh.buffer_idx = 0;
+		hfh.file_offset = location + nr_bytes;
+		return;
+	}
+
 	// Don't buffer when DirectIO is set.
 	if (hfh.flags & FileFlags::FILE_FLAGS_DIRECT_IO && to_read > 0) {
 		GetRangeRequest(hfh, hfh.path, {}, location, (char *)buffer, to_read);
@@ -363,6 +485,92 @@ void HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, id
 	}
 }
 
+// A range of a batched read that is fetched as a whole, and the read requests that it covers
+struct HTTPBatchRange {
+	explicit HTTPBatchRange(FileReadRequest &request)
+	    : location(request.location), end(request.location + request.nr_bytes), requests {&request},
+	      buffer(nullptr) {
+	}
+
+	idx_t location;
+	idx_t end;
+	vector<FileReadRequest *> requests;
+	// The buffer that the range is fetched into, which is owned by the range if it covers several read requests
+	data_ptr_t buffer;
+	unique_ptr<data_t[]> owned_buffer;
+};
+
+// A part of a range that is fetched with a single request
+struct HTTPBatchPart {
+	idx_t location;
+	idx_t size;
+	data_ptr_t buffer;
+};
+
+void HTTPFileSystem::ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) {
+	auto &hfh = (HTTPFileHandle &)handle;
+	vector<FileReadRequest *> sorted_requests;
+	for (idx_t i = 0; i < count; i++) {
+		if (requests[i].location + requests[i].nr_bytes > hfh.length) {
+			throw IOException("out of file");
+		}
+		if (requests[i].nr_bytes > 0) {
+			sorted_requests.push_back(&requests[i]);
+		}
+	}
+	if (hfh.block_cache) {
+		// the block cache already fetches runs of missing blocks with a single request
+		FileSystem::ReadBatch(handle, requests, count);
+		return;
+	}
+
+	// Coalesce the ranges that overlap or are close to each other, saving a round trip for each of them
+	std::sort(sorted_requests.begin(), sorted_requests.end(),
+	          [](const FileReadRequest *a, const FileReadRequest *b) { return a->location < b->location; });
+	vector<HTTPBatchRange> ranges;
+	for (auto request : sorted_requests) {
+		if (!ranges.empty() && request->location <= ranges.back().end + BATCH_COALESCE_GAP) {
+			auto &range = ranges.back();
+			range.end = MaxValue<idx_t>(range.end, request->location + request->nr_bytes);
+			range.requests.push_back(request);
+		} else {
+			ranges.emplace_back(*request);
+		}
+	}
+
+	// Split the ranges in parts, which are fetched straight into the buffer of the request if a range has only one
+	vector<HTTPBatchPart> parts;
+	for (auto &range : ranges) {
+		const auto range_size = range.end - range.location;
+		if (range.requests.size() == 1) {
+			range.buffer = (data_ptr_t)range.requests[0]->buffer;
+		} else {
+			range.owned_buffer = unique_ptr<data_t[]>(new data_t[range_size]);
+			range.buffer = range.owned_buffer.get();
+		}
+		for (idx_t offset = 0; offset < range_size; offset += BATCH_REQUEST_SIZE) {
+			parts.push_back({range.location + offset, MinValue<idx_t>(BATCH_REQUEST_SIZE, range_size - offset),
+			                 range.buffer + offset});
+		}
+	}
+
+	// Fetch the parts concurrently on the shared I/O threads, the calling thread takes part in fetching
+	IOThreadPool::Get().Run(parts.size(), hfh.http_params.max_concurrent_requests, [&](idx_t part_idx) {
+		auto &part = parts[part_idx];
+		GetRangeRequest(hfh, hfh.path, {}, part.location, (char *)part.buffer, part.size);
+	});
+
+	// Copy the coalesced ranges into the buffers of the requests
+	for (auto &range : ranges) {
+		if (!range.owned_buffer) {
+			continue;
+		}
+		for (auto request : range.requests) {
+			memcpy(request->buffer, range.buffer + (request->location - range.location), request->nr_bytes);
+		}
+	}
+}
+
 int64_t HTTPFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &hfh = (HTTPFileHandle &)handle;
 	idx_t max_read = hfh.length - hfh.file_offset;
@@ -459,10 +667,12 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		if (found) {
 			last_modified = value.last_modified;
 			length = value.length;
+			etag = value.etag;
 
 			if (flags & FileFlags::FILE_FLAGS_READ) {
 				read_buffer = unique_ptr<data_t[]>(new data_t[READ_BUFFER_LEN]);
 			}
+			InitializeBlockCache(opener);
 			return;
 		}
 
@@ -521,10 +731,30 @@ void HTTPFileHandle::Initialize(FileOpener *opener) {
 		tm.tm_isdst = 0;
 		last_modified = mktime(&tm);
 	}
+	if (res->headers.find("ETag") != res->headers.end()) {
+		etag = res->headers["ETag"];
+	}
 
 	if (should_write_cache) {
-		current_cache->Insert(path, {length, last_modified});
+		current_cache->Insert(path, {length, last_modified, etag});
+	}
+	InitializeBlockCache(opener);
+}
+
+void HTTPFileHandle::InitializeBlockCache(FileOpener *opener) {
+	if (!(flags & FileFlags::FILE_FLAGS_READ)) {
+		return;
+	}
+	// Cached blocks can only be used if we can tell that the file has not changed since they were cached
+	if (!etag.empty()) {
+		cache_version = etag;
+	} else if (last_modified != 0) {
+		cache_version = to_string(last_modified);
+	} else {
+		return;
 	}
+	cache_version += ":" + to_string(length);
+	block_cache = HTTPBlockCache::TryGetCache(opener);
 }
 
 void HTTPFileHandle::InitializeClient() {
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/file_opener.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class BufferManager;
+
+struct HTTPBlockCacheParams {
+	static constexpr idx_t DEFAULT_MEMORY_LIMIT = 256ULL * 1024 * 1024; // 256 MiB
+	static constexpr idx_t DEFAULT_DISK_LIMIT = 4ULL * 1024 * 1024 * 1024; // 4 GiB
+
+	bool enabled;
+	idx_t memory_limit;
+	idx_t disk_limit;
+	//! The directory that blocks are persisted in, empty if blocks are only cached in memory
+	string directory;
+
+	static HTTPBlockCacheParams ReadFrom(FileOpener *opener);
+};
+
+//! Caches blocks of remote files in memory and (optionally) in a local directory, so that reading the same bytes of
+//! an unchanged file again does not download them again. Blocks are identified by the URL, the version of the file
+//! (its ETag or last modification time) and their offset, so blocks of a file that changed are never returned.
+//! The cache is shared by all HTTP and S3 file handles of a database instance, and evicts blocks in LRU order.
+//! The blocks in memory are allocated through the buffer manager, so they count towards the memory limit. They are
+//! not pinned while they are cached: the buffer manager can destroy them when it needs the memory elsewhere, after
+//! which they are read from disk or downloaded again.
+//! Only the lookups and updates of the index are serialized: blocks are copied, read and written without the lock.
+class HTTPBlockCache : public ObjectCacheEntry {
+public:
+	//! The size of the cached blocks (the last block of a file is smaller)
+	static constexpr idx_t CACHE_BLOCK_SIZE = 1ULL << 20;
+
+	HTTPBlockCache(BufferManager &buffer_manager, idx_t memory_limit, idx_t disk_limit, string directory);
+
+	//! Returns the block cache of the database instance (creating it if needed), or nullptr if it is disabled
+	static shared_ptr<HTTPBlockCache> TryGetCache(FileOpener *opener);
+	//! The key of the block at block_idx of the given version of a file
+	static string GetBlockKey(const string &url, const string &version, idx_t block_idx);
+
+	//! Copies a cached block of block_len bytes into buffer, returns false if the block is not cached
+	bool Get(const string &block_key, data_ptr_t buffer, idx_t block_len);
+	//! Whether the block is cached, without counting it as a hit or miss
+	bool Contains(const string &block_key);
+	//! Adds a block to the cache, evicting the least recently used blocks to stay within the limits
+	void Put(const string &block_key, const_data_ptr_t buffer, idx_t block_len);
+	//! Changes the limits of the cache
+	void SetLimits(idx_t memory_limit, idx_t disk_limit);
+
+	const string &GetDirectory() const {
+		return directory;
+	}
+
+	static string ObjectType() {
+		return "http_block_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+public:
+	//! The number of blocks that were read from memory, from disk, and that had to be downloaded
+	atomic<idx_t> memory_hits {0};
+	atomic<idx_t> disk_hits {0};
+	atomic<idx_t> misses {0};
+
+private:
+	struct MemoryBlock {
+		string key;
+		//! The buffer that holds the block, readers pin it while they copy it
+		shared_ptr<BlockHandle> buffer;
+		//! The size of the block
+		idx_t size;
+		//! The memory that the buffer takes up
+		idx_t memory_usage;
+	};
+	struct DiskBlock {
+		string file_name;
+		idx_t size;
+	};
+
+	bool ReadFromMemory(const string &block_key, data_ptr_t buffer, idx_t block_len);
+	void PutInMemory(const string &block_key, const_data_ptr_t buffer, idx_t block_len);
+	void PutOnDisk(const string &block_key, const_data_ptr_t buffer, idx_t block_len);
+	bool ReadFromDisk(const string &block_key, data_ptr_t buffer, idx_t block_len);
+	//! Block files are named after the hash of their key
+	static string GetFileName(const string &block_key);
+	string GetFilePath(const string &file_name) const;
+	//! Registers the blocks that were persisted in the directory by earlier instances
+	void LoadDirectory();
+	//! Removes the memory block from the index (if it is still in there) after its buffer was destroyed
+	void ForgetMemoryBlock(const string &block_key, const shared_ptr<BlockHandle> &buffer);
+	//! Removes the block file from the index (if it is still in there)
+	void ForgetDiskBlock(const string &file_name);
+	//! Evicts blocks from the index until the limits are met (with the lock held). The evicted memory blocks are
+	//! released, the evicted block files are added to removed_files to be deleted once the lock is released.
+	void EvictMemory(vector<shared_ptr<BlockHandle>> &evicted_buffers);
+	void EvictDisk(vector<string> &removed_files);
+	void RemoveFiles(const vector<string> &file_names);
+
+private:
+	//! Protects the limits and the index of the cached blocks
+	mutex lock;
+	BufferManager &buffer_manager;
+	idx_t memory_limit;
+	idx_t disk_limit;
+	string directory;
+	unique_ptr<FileSystem> local_fs;
+	//! Used to give every block file that is being written a unique temporary name
+	atomic<idx_t> temp_file_counter {0};
+
+	//! The blocks in memory, the most recently used first
+	list<MemoryBlock> memory_blocks;
+	unordered_map<string, list<MemoryBlock>::iterator> memory_map;
+	idx_t memory_size;
+
+	//! The block files in the directory, the most recently used first
+	list<DiskBlock> disk_blocks;
+	unordered_map<string, list<DiskBlock>::iterator> disk_map;
+	idx_t disk_size;
+};
+
+} // namespace duckdb
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "http_block_cache.hpp"
 #include "http_metadata_cache.hpp"
 
 namespace duckdb_httplib_openssl {
@@ -31,11 +33,14 @@ struct HTTPParams {
 	static constexpr uint64_t DEFAULT_RETRIES = 3;
 	static constexpr uint64_t DEFAULT_RETRY_WAIT_MS = 100;
 	static constexpr float DEFAULT_RETRY_BACKOFF = 4;
+	static constexpr uint64_t DEFAULT_MAX_CONCURRENT_REQUESTS = 8;
 
 	uint64_t timeout;
 	uint64_t retries;
 	uint64_t retry_wait_ms;
 	float retry_backoff;
+	// The number of requests that a batched read of a file issues at the same time
+	uint64_t max_concurrent_requests;
 
 	static HTTPParams ReadFrom(FileOpener *opener);
 };
@@ -49,6 +54,10 @@ public:
 
 	// We keep an http client stored for connection reuse with keep-alive headers
 	unique_ptr<duckdb_httplib_openssl::Client> http_client;
+	// Additional idle clients that keep the connections of concurrent requests alive. Together with http_client, at
+	// most max_concurrent_requests connections are kept.
+	vector<unique_ptr<duckdb_httplib_openssl::Client>> client_pool;
+	mutex client_lock;
 
 	const HTTPParams http_params;
 
@@ -56,6 +65,7 @@ public:
 	uint8_t flags;
 	idx_t length;
 	time_t last_modified;
+	string etag;
 
 	// Read info
 	idx_t buffer_available;
@@ -70,16 +80,32 @@ public:
 
 	HTTPStats *stats;
 
+	// Block cache shared with the other handles, nullptr if blocks are not cached
+	shared_ptr<HTTPBlockCache> block_cache;
+	// The version of the file that identifies its blocks in the block cache
+	string cache_version;
+
 public:
 	void Close() override {
 	}
 
+	// Takes an idle client for a request, returns nullptr if all clients are in use
+	unique_ptr<duckdb_httplib_openssl::Client> AcquireClient();
+	// Returns the client of a finished request, so that its connection is reused
+	void ReleaseClient(unique_ptr<duckdb_httplib_openssl::Client> client);
+
 protected:
 	virtual void InitializeClient();
+	void InitializeBlockCache(FileOpener *opener);
 };
 
 class HTTPFileSystem : public FileSystem {
 public:
+	// Ranges of a batched read that are at most this many bytes apart are fetched with a single request
+	static constexpr idx_t BATCH_COALESCE_GAP = 1ULL << 16; // 64 KiB
+	// Ranges of a batched read are split in requests of at most this size, to fetch large ranges concurrently
+	static constexpr idx_t BATCH_REQUEST_SIZE = 1ULL << 23; // 8 MiB
+
 	static unique_ptr<duckdb_httplib_openssl::Client> GetClient(const HTTPParams &http_params,
 	                                                            const char *proto_host_port);
 	static void ParseUrl(string &url, string &path_out, string &proto_host_port_out);
@@ -106,6 +132,8 @@ public:
 	// FS methods
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	// Coalesces ranges that are close to each other, and fetches the ranges concurrently
+	void ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	void FileSync(FileHandle &handle) override;
@@ -10,6 +10,7 @@
 
 #include "buffered_json_reader.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "json_transform.hpp"
@@ -209,8 +210,14 @@ public:
 	DateFormatMap date_format_map;
 	JSONTransformOptions transform_options;
 
+	//! Whether keys that are not read are removed from records before parsing, so their values are not parsed
+	bool skip_unprojected_keys;
+	//! The keys that are read
+	json_key_set_t projected_keys;
+
 private:
 	yyjson_val *ParseLine(char *line_start, idx_t line_size, idx_t remaining, JSONLine &line);
+	void SkipUnprojectedKeys(char *line_start, idx_t line_size);
 	idx_t GetObjectsFromArray(JSONScanGlobalState &gstate);
 
 private:
@@ -232,6 +239,9 @@ private:
 	idx_t prev_buffer_remainder;
 	idx_t lines_or_objects_in_buffer;
 
+	//! Offsets of the key/value pairs that are kept by SkipUnprojectedKeys
+	vector<pair<idx_t, idx_t>> projected_pairs;
+
 	//! Buffer to reconstruct split values
 	AllocatedData reconstruct_buffer;
 	//! Copy of current buffer for YYJSON_READ_INSITU
@@ -180,7 +180,8 @@ JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, JSONScanData &b
 }
 
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
-    : scan_count(0), array_idx(0), array_offset(0), batch_index(DConstants::INVALID_INDEX), bind_data(gstate.bind_data),
+    : scan_count(0), array_idx(0), array_offset(0), batch_index(DConstants::INVALID_INDEX),
+      skip_unprojected_keys(false), bind_data(gstate.bind_data),
       json_allocator(BufferAllocator::Get(context)), current_reader(nullptr), current_buffer_handle(nullptr),
       is_last(false), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
 
@@ -262,6 +263,16 @@ unique_ptr<LocalTableFunctionState> JSONLocalTableFunctionState::Init(ExecutionC
 	result->state.transform_options = gstate.state.bind_data.transform_options;
 	result->state.transform_options.date_format_map = &result->state.date_format_map;
 
+	// If unknown keys are not an error, we don't have to parse the values of keys that are not read
+	auto &bind_data = gstate.state.bind_data;
+	if (bind_data.type == JSONScanType::READ_JSON && bind_data.record_type == JSONRecordType::RECORDS &&
+	    !bind_data.transform_options.error_unknown_key) {
+		result->state.skip_unprojected_keys = true;
+		for (auto &name : bind_data.names) {
+			result->state.projected_keys.insert({name.c_str(), name.length()});
+		}
+	}
+
 	return result;
 }
 
@@ -348,7 +359,158 @@ static inline void TrimWhitespace(JSONLine &line) {
 	}
 }
 
+static inline void SkipWhitespace(const char *&ptr, const char *end) {
+	for (; ptr != end; ptr++) {
+		if (!StringUtil::CharacterIsSpace(*ptr)) {
+			break;
+		}
+	}
+}
+
+//! Skips over the string that starts at ptr, returns false if the string is not terminated
+static inline bool SkipString(const char *&ptr, const char *end) {
+	for (ptr++; ptr != end; ptr++) {
+		if (*ptr == '"') {
+			ptr++;
+			return true;
+		} else if (*ptr == '\\') {
+			ptr++;
+			if (ptr == end) {
+				break;
+			}
+		}
+	}
+	return false;
+}
+
+//! Skips over the value that starts at ptr without parsing it
+//! Only checks whether strings are terminated and whether brackets are balanced
+static inline bool SkipValue(const char *&ptr, const char *end) {
+	idx_t depth = 0;
+	while (ptr != end) {
+		switch (*ptr) {
+		case '"':
+			if (!SkipString(ptr, end)) {
+				return false;
+			}
+			if (depth == 0) {
+				return true;
+			}
+			continue;
+		case '{':
+		case '[':
+			depth++;
+			break;
+		case '}':
+		case ']':
+			if (depth == 0) {
+				return true;
+			}
+			if (--depth == 0) {
+				ptr++;
+				return true;
+			}
+			break;
+		case ',':
+			if (depth == 0) {
+				return true;
+			}
+			break;
+		default:
+			if (depth == 0 && StringUtil::CharacterIsSpace(*ptr)) {
+				return true;
+			}
+			break;
+		}
+		ptr++;
+	}
+	return depth == 0;
+}
+
+void JSONScanLocalState::SkipUnprojectedKeys(char *line_start, idx_t line_size) {
+	// Walk over the key/value pairs of the record without parsing the values
+	const char *ptr = line_start;
+	const char *end = line_start + line_size;
+	SkipWhitespace(ptr, end);
+	if (ptr == end || *ptr != '{') {
+		return;
+	}
+	const auto object_start = (char *)ptr++;
+
+	// We give up on anything unexpected, yyjson then parses the record as usual and reports any errors
+	projected_pairs.clear();
+	bool skipped_pair = false;
+	while (true) {
+		SkipWhitespace(ptr, end);
+		if (ptr == end) {
+			return;
+		} else if (*ptr == '}') {
+			ptr++;
+			break;
+		} else if (*ptr != '"') {
+			return;
+		}
+		const auto pair_start = ptr;
+		if (!SkipString(ptr, end)) {
+			return;
+		}
+		// Keys with escape sequences are always kept, as we can't compare them to the projected keys
+		JSONKey key {pair_start + 1, size_t(ptr - pair_start - 2)};
+		bool keep = memchr(key.ptr, '\\', key.len) || projected_keys.find(key) != projected_keys.end();
+
+		SkipWhitespace(ptr, end);
+		if (ptr == end || *ptr != ':') {
+			return;
+		}
+		ptr++;
+		SkipWhitespace(ptr, end);
+		const auto value_start = ptr;
+		if (!SkipValue(ptr, end) || ptr == value_start) {
+			return;
+		}
+		if (keep) {
+			projected_pairs.emplace_back(pair_start - line_start, ptr - line_start);
+		} else {
+			skipped_pair = true;
+		}
+
+		SkipWhitespace(ptr, end);
+		if (ptr == end) {
+			return;
+		} else if (*ptr == ',') {
+			ptr++;
+		} else if (*ptr == '}') {
+			ptr++;
+			break;
+		} else {
+			return;
+		}
+	}
+	SkipWhitespace(ptr, end);
+	if (ptr != end || !skipped_pair) {
+		return;
+	}
+
+	// Move the pairs that we keep to the front of the record, and overwrite the rest with whitespace
+	auto write_ptr = object_start + 1;
+	for (idx_t pair_idx = 0; pair_idx < projected_pairs.size(); pair_idx++) {
+		if (pair_idx != 0) {
+			*write_ptr++ = ',';
+		}
+		const auto &pair = projected_pairs[pair_idx];
+		const auto pair_size = pair.second - pair.first;
+		memmove(write_ptr, line_start + pair.first, pair_size);
+		write_ptr += pair_size;
+	}
+	*write_ptr++ = '}';
+	memset(write_ptr, ' ', end - write_ptr);
+}
+
 yyjson_val *JSONScanLocalState::ParseLine(char *line_start, idx_t line_size, idx_t remaining, JSONLine &line) {
+	if (skip_unprojected_keys) {
+		SkipUnprojectedKeys(line_start, line_size);
+	}
+
 	yyjson_doc *doc;
 	if (bind_data.ignore_errors) {
 		doc = JSONCommon::ReadDocumentUnsafe(line_start, line_size, JSONCommon::READ_FLAG,
@@ -83,10 +83,18 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
-		uint64_t size = chunk->meta_data.total_compressed_size;
-		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+	if (!chunk) {
+		return;
+	}
+	if (offset_index) {
+		// the pages that only contain skipped rows are never read, so they are not fetched either
+		for (auto &range : prefetch_ranges) {
+			transport.RegisterPrefetch(range.first, range.second - range.first, allow_merge);
+		}
+		return;
 	}
+	uint64_t size = chunk->meta_data.total_compressed_size;
+	transport.RegisterPrefetch(FileOffset(), size, allow_merge);
 }
 
 uint64_t ColumnReader::TotalCompressedSize() {
@@ -179,6 +187,52 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const std::vector<Colum
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips and partially read pages of the previous row group do not carry over
+	pending_skips = 0;
+	page_rows_available = 0;
+	offset_index.reset();
+}
+
+static void AddPrefetchRange(vector<pair<idx_t, idx_t>> &ranges, idx_t start, idx_t end) {
+	if (!ranges.empty() && ranges.back().second == start) {
+		// consecutive pages are fetched together
+		ranges.back().second = end;
+	} else {
+		ranges.emplace_back(start, end);
+	}
+}
+
+void ColumnReader::SetOffsetIndex(unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index_p,
+                                  const vector<pair<idx_t, idx_t>> &skipped_ranges) {
+	D_ASSERT(!HasRepeats());
+	offset_index = std::move(offset_index_p);
+	prefetch_ranges.clear();
+	auto &locations = offset_index->page_locations;
+	auto chunk_start = FileOffset();
+	if (locations.empty()) {
+		prefetch_ranges.emplace_back(chunk_start, chunk_start + chunk->meta_data.total_compressed_size);
+		return;
+	}
+	// the dictionary page precedes the data pages: it always has to be read
+	if (chunk_start < idx_t(locations[0].offset)) {
+		AddPrefetchRange(prefetch_ranges, chunk_start, locations[0].offset);
+	}
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < locations.size(); page_idx++) {
+		auto &location = locations[page_idx];
+		idx_t page_start_row = location.first_row_index;
+		idx_t page_end_row =
+		    page_idx + 1 < locations.size() ? locations[page_idx + 1].first_row_index : chunk->meta_data.num_values;
+		while (range_idx < skipped_ranges.size() && skipped_ranges[range_idx].second <= page_start_row) {
+			range_idx++;
+		}
+		if (range_idx < skipped_ranges.size() && skipped_ranges[range_idx].first <= page_start_row &&
+		    skipped_ranges[range_idx].second >= page_end_row) {
+			// all rows of the page are skipped
+			continue;
+		}
+		AddPrefetchRange(prefetch_ranges, location.offset, location.offset + location.compressed_page_size);
+	}
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -495,6 +549,40 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
+	auto &locations = offset_index->page_locations;
+	while (num_values > 0 && page_rows_available == 0 && !locations.empty()) {
+		if (int64_t(chunk_read_offset) < locations[0].offset) {
+			// the dictionary page precedes the data pages: it always has to be read
+			trans.SetLocation(chunk_read_offset);
+			PrepareRead(none_filter);
+			chunk_read_offset = trans.GetLocation();
+			continue;
+		}
+		// find the data page that starts at the current location
+		auto entry = std::lower_bound(locations.begin(), locations.end(), chunk_read_offset,
+		                              [](const duckdb_parquet::format::PageLocation &location, idx_t offset) {
+			                              return location.offset < int64_t(offset);
+		                              });
+		if (entry == locations.end() || entry->offset != int64_t(chunk_read_offset)) {
+			break;
+		}
+		auto next_entry = entry + 1;
+		idx_t page_end_row = next_entry == locations.end() ? chunk->meta_data.num_values : next_entry->first_row_index;
+		idx_t page_rows = page_end_row - entry->first_row_index;
+		if (page_rows > num_values) {
+			break;
+		}
+		// the page only contains skipped rows: jump over it
+		chunk_read_offset = entry->offset + entry->compressed_page_size;
+		group_rows_available -= page_rows;
+		num_values -= page_rows;
+	}
+	trans.SetLocation(chunk_read_offset);
+	return num_values;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
@@ -508,7 +596,20 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	idx_t read = 0;
 
 	while (remaining) {
+		if (offset_index && page_rows_available == 0) {
+			// we are at a page boundary: pages that are skipped entirely do not have to be read at all
+			auto skipped = remaining - SkipPages(remaining);
+			read += skipped;
+			remaining -= skipped;
+			if (remaining == 0) {
+				break;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		if (offset_index && page_rows_available > 0) {
+			// stop at the end of the page, the following pages might be skipped
+			to_read = MinValue<idx_t>(to_read, page_rows_available);
+		}
 		read += Read(to_read, none_filter, (uint8_t *)dummy_define.ptr, (uint8_t *)dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -29,12 +30,16 @@ namespace duckdb {
 using namespace duckdb_parquet; // NOLINT
 using namespace duckdb_miniz;   // NOLINT
 
+using duckdb_parquet::format::BoundaryOrder;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::Encoding;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::PageType;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::Type;
@@ -83,6 +88,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -175,7 +183,7 @@ void RleBpEncoder::FinishWrite(Serializer &writer) {
 ColumnWriter::ColumnWriter(ParquetWriter &writer, idx_t schema_idx, vector<string> schema_path_p, idx_t max_repeat,
                            idx_t max_define, bool can_have_nulls)
     : writer(writer), schema_idx(schema_idx), schema_path(std::move(schema_path_p)), max_repeat(max_repeat),
-      max_define(max_define), can_have_nulls(can_have_nulls), null_count(0) {
+      max_define(max_define), can_have_nulls(can_have_nulls) {
 }
 ColumnWriter::~ColumnWriter() {
 }
@@ -253,7 +261,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 			if (parent->is_empty.empty() || !parent->is_empty[current_index]) {
@@ -269,7 +277,7 @@ void ColumnWriter::HandleDefineLevels(ColumnWriterState &state, ColumnWriterStat
 				if (!can_have_nulls) {
 					throw IOException("Parquet writer: map key column is not allowed to contain NULL values");
 				}
-				null_count++;
+				state.null_count++;
 				state.definition_levels.push_back(null_value);
 			}
 		}
@@ -293,6 +301,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<BufferedSerializer> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, which are written to the column index
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -314,6 +324,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The bloom filter of the column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -348,7 +360,7 @@ public:
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, PreparedRowGroup &target) override;
 
 protected:
 	void WriteLevels(Serializer &temp_writer, const vector<uint16_t> &levels, idx_t max_value, idx_t start_offset,
@@ -377,12 +389,21 @@ protected:
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
 	}
+	//! Whether or not the writer can build a bloom filter over the values it writes
+	virtual bool SupportsBloomFilter() {
+		return false;
+	}
+	//! Inserts the hashes of the plain-encoded values of a (subset of a) vector into the bloom filter
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
 	//! The number of elements in the dictionary
 	virtual idx_t DictionarySize(BasicColumnWriterState &state_p);
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<BufferedSerializer> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	//! Builds the column index and offset index of the column chunk, given the offsets of its data pages
+	void AddPageIndex(BasicColumnWriterState &state, const vector<duckdb_parquet::format::PageLocation> &locations,
+	                  PreparedRowGroup &target);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
 
@@ -475,12 +496,18 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		write_info.page_stats = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
 
 		state.write_info.push_back(std::move(write_info));
 	}
+	if (writer.BloomFiltersEnabled() && SupportsBloomFilter()) {
+		// the dictionary holds the distinct values, otherwise every value is assumed to be distinct
+		auto distinct_values = HasDictionary(state) ? DictionarySize(state) : state.definition_levels.size();
+		state.bloom_filter = make_unique<ParquetBloomFilter>(ParquetBloomFilter::OptimalNumBytes(distinct_values));
+	}
 
 	// start writing the first page
 	NextPage(state);
@@ -545,6 +572,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	state.stats_state->Merge(*write_info.page_stats);
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.blob.size > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -570,6 +598,10 @@ unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
 	return make_unique<ColumnWriterStatistics>();
 }
 
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+}
+
 idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) {
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
@@ -588,8 +620,11 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.page_stats.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (state.bloom_filter) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -603,7 +638,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
                                              duckdb_parquet::format::ColumnChunk &column_chunk) {
 	if (max_repeat == 0) {
-		column_chunk.meta_data.statistics.null_count = null_count;
+		column_chunk.meta_data.statistics.null_count = state.null_count;
 		column_chunk.meta_data.statistics.__isset.null_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
@@ -638,15 +673,15 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p, PreparedRowGroup &target) {
 	auto &state = (BasicColumnWriterState &)state_p;
 	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
-	auto &column_writer = writer.GetWriter();
-	auto start_offset = column_writer.GetTotalWritten();
+	auto &column_writer = target.buffer;
+	auto start_offset = target.GetTotalWritten();
 	auto page_offset = start_offset;
 	// flush the dictionary
 	if (HasDictionary(state)) {
@@ -664,17 +699,80 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
-		auto header_start_offset = column_writer.GetTotalWritten();
-		write_info.page_header.write(writer.GetProtocol());
+		auto header_start_offset = target.GetTotalWritten();
+		write_info.page_header.write(target.protocol.get());
 		// total uncompressed size in the column chunk includes the header size (!)
-		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
+		total_uncompressed_size += target.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		column_writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			PageLocation location;
+			location.offset = header_start_offset;
+			location.compressed_page_size = target.GetTotalWritten() - header_start_offset;
+			location.first_row_index = state.page_info[page_locations.size()].offset;
+			page_locations.push_back(location);
+		}
 	}
-	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
+	column_chunk.meta_data.total_compressed_size = target.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	AddPageIndex(state, page_locations, target);
+	if (state.bloom_filter) {
+		// the bloom filter directly follows the pages of the column chunk
+		column_chunk.meta_data.bloom_filter_offset = target.GetTotalWritten();
+		column_chunk.meta_data.__isset.bloom_filter_offset = true;
+		state.bloom_filter->Write(*target.protocol, target.buffer);
+	}
+}
+
+void BasicColumnWriter::AddPageIndex(BasicColumnWriterState &state, const vector<PageLocation> &locations,
+                                     PreparedRowGroup &target) {
+	if (max_repeat > 0 || locations.empty()) {
+		// the page index addresses pages by row: this only maps directly to values for non-repeated columns
+		return;
+	}
+	D_ASSERT(locations.size() == state.page_info.size());
+	auto offset_index = make_unique<OffsetIndex>();
+	offset_index->page_locations = locations;
+
+	auto column_index = make_unique<ColumnIndex>();
+	column_index->boundary_order = BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	auto data_page_offset = state.write_info.size() - state.page_info.size();
+	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
+		auto &page_info = state.page_info[page_idx];
+		idx_t page_null_count = 0;
+		if (!state.definition_levels.empty()) {
+			for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+				if (state.definition_levels[i] != max_define) {
+					page_null_count++;
+				}
+			}
+		}
+		bool null_page = page_null_count == page_info.row_count;
+		auto &page_stats = *state.write_info[data_page_offset + page_idx].page_stats;
+		auto min_value = null_page ? string() : page_stats.GetMinValue();
+		auto max_value = null_page ? string() : page_stats.GetMaxValue();
+		if (!null_page && (min_value.empty() || max_value.empty())) {
+			// no statistics for this page (e.g. dictionary encoded strings): we can only write the offset index
+			column_index.reset();
+		}
+		if (column_index) {
+			column_index->null_pages.push_back(null_page);
+			column_index->min_values.push_back(std::move(min_value));
+			column_index->max_values.push_back(std::move(max_value));
+			column_index->null_counts.push_back(page_null_count);
+		}
+	}
+	if (target.offset_indexes.size() <= state.col_idx) {
+		target.column_indexes.resize(state.col_idx + 1);
+		target.offset_indexes.resize(state.col_idx + 1);
+	}
+	target.column_indexes[state.col_idx] = std::move(column_index);
+	target.offset_indexes[state.col_idx] = std::move(offset_index);
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -744,6 +842,18 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = (NumericStatisticsState<SRC, T, OP> &)other_p;
+		if (!other.HasStats()) {
+			return;
+		}
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -834,6 +944,21 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->Insert(ParquetBloomFilter::Hash<TGT>(OP::template Operation<SRC, TGT>(ptr[r])));
+			}
+		}
+	}
+
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
@@ -867,6 +992,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = (BooleanStatisticsState &)other_p;
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -998,6 +1128,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = (FixedDecimalStatistics &)other_p;
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1179,6 +1316,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = (StringStatisticsState &)other_p;
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1346,6 +1496,27 @@ public:
 		}
 	}
 
+	bool SupportsBloomFilter() override {
+		return true;
+	}
+
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &state = (StringColumnWriterState &)state_p;
+		if (state.IsDictionaryEncoded()) {
+			// the values are inserted when the dictionary is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->Insert(
+				    ParquetBloomFilter::Hash((const_data_ptr_t)ptr[r].GetDataUnsafe(), ptr[r].GetSize()));
+			}
+		}
+	}
+
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = (StringColumnWriterState &)state_p;
 		return make_unique<StringWriterPageState>(state.key_bit_width, state.dictionary);
@@ -1398,6 +1569,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->Insert(
+				    ParquetBloomFilter::Hash((const_data_ptr_t)value.GetDataUnsafe(), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData((const_data_ptr_t)(value.GetDataUnsafe()), value.GetSize());
@@ -1562,7 +1737,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, PreparedRowGroup &target) override;
 };
 
 class StructColumnWriterState : public ColumnWriterState {
@@ -1652,12 +1827,12 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
-void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p, PreparedRowGroup &target) {
 	auto &state = (StructColumnWriterState &)state_p;
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
 		// we add the null count of the struct to the null count of the children
-		child_writers[child_idx]->null_count += null_count;
-		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx]);
+		state.child_states[child_idx]->null_count += state.null_count;
+		child_writers[child_idx]->FinalizeWrite(*state.child_states[child_idx], target);
 	}
 }
 
@@ -1685,7 +1860,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
-	void FinalizeWrite(ColumnWriterState &state) override;
+	void FinalizeWrite(ColumnWriterState &state, PreparedRowGroup &target) override;
 };
 
 class ListColumnWriterState : public ColumnWriterState {
@@ -1794,9 +1969,9 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
-void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p, PreparedRowGroup &target) {
 	auto &state = (ListColumnWriterState &)state_p;
-	child_writer->FinalizeWrite(*state.child_state);
+	child_writer->FinalizeWrite(*state.child_state, target);
 }
 
 //===--------------------------------------------------------------------===//
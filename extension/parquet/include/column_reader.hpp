@@ -73,6 +73,12 @@ public:
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns);
 
+	//! Sets the offset index of the current column chunk, which allows skipping entire pages without reading them.
+	//! The pages that lie within the (sorted, disjoint) skipped row ranges are not prefetched either.
+	//! Only valid for non-repeated columns.
+	void SetOffsetIndex(unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index,
+	                    const vector<pair<idx_t, idx_t>> &skipped_ranges);
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -144,9 +150,14 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Skips over the pages that only contain skipped rows, returns the amount of rows that are left to skip
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const char *src, idx_t src_size, char *dst, idx_t dst_size);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+	//! With an offset index: the byte ranges [start, end) of the dictionary and the pages that are not skipped
+	vector<pair<idx_t, idx_t>> prefetch_ranges;
 
 	duckdb_apache::thrift::protocol::TProtocol *protocol;
 	idx_t page_rows_available;
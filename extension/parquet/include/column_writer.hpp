@@ -14,6 +14,7 @@
 namespace duckdb {
 class BufferedSerializer;
 class ParquetWriter;
+struct PreparedRowGroup;
 class ColumnWriterPageState;
 class BasicColumnWriterState;
 
@@ -24,6 +25,8 @@ public:
 	vector<uint16_t> definition_levels;
 	vector<uint16_t> repetition_levels;
 	vector<bool> is_empty;
+	//! The number of NULL values in this row group, including those of parent structs
+	idx_t null_count = 0;
 };
 
 class ColumnWriterStatistics {
@@ -34,6 +37,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of a page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 };
 
 class ColumnWriter {
@@ -49,8 +54,6 @@ public:
 	idx_t max_repeat;
 	idx_t max_define;
 	bool can_have_nulls;
-	// collected stats
-	idx_t null_count;
 
 public:
 	//! Create the column writer for a specific type recursively
@@ -81,7 +84,8 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
-	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
+	//! Serializes the pages of the column chunk into the (in-memory) row group
+	virtual void FinalizeWrite(ColumnWriterState &state, PreparedRowGroup &target) = 0;
 
 protected:
 	void HandleDefineLevels(ColumnWriterState &state, ColumnWriterState *parent, ValidityMask &validity, idx_t count,
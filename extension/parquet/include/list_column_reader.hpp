@@ -25,6 +25,7 @@ public:
 
 	void InitializeRead(idx_t row_group_idx_p, const std::vector<ColumnChunk> &columns,
 	                    TProtocol &protocol_p) override {
+		pending_skips = 0;
 		child_column_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
 	}
 
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#endif
+#include "parquet_types.h"
+#include "thrift/protocol/TProtocol.h"
+
+namespace duckdb {
+
+//! A split block bloom filter as specified by the Parquet format: the filter consists of 256-bit blocks, a value
+//! hashes (with XXH64) into a single block in which it sets one bit in each of the eight 32-bit words.
+class ParquetBloomFilter {
+public:
+	explicit ParquetBloomFilter(idx_t num_bytes);
+	ParquetBloomFilter(unique_ptr<data_t[]> data, idx_t num_bytes);
+
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	//! The smallest and largest filters we write
+	static constexpr const idx_t MINIMUM_SIZE = 32;
+	static constexpr const idx_t MAXIMUM_SIZE = 128 * 1024 * 1024;
+	//! The false positive probability the filters are sized for
+	static constexpr const double DEFAULT_FPP = 0.01;
+
+public:
+	//! Computes the filter size (a power of two) for the given number of distinct values
+	static idx_t OptimalNumBytes(idx_t distinct_values, double fpp = DEFAULT_FPP);
+	//! Hashes the plain-encoded bytes of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash((const_data_ptr_t)&value, sizeof(T));
+	}
+
+	void Insert(uint64_t hash);
+	bool Check(uint64_t hash) const;
+
+	idx_t NumBytes() const {
+		return num_bytes;
+	}
+
+	//! Writes the bloom filter header, followed by the bitset
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol, BufferedSerializer &target) const;
+	//! Reads the bloom filter header at the current location of the protocol, the bitset follows it. Returns false if
+	//! the filter uses an algorithm, hash or compression we do not support.
+	static bool ReadHeader(duckdb_apache::thrift::protocol::TProtocol &protocol, idx_t &num_bytes);
+
+	//! Hashes a constant the way the writer hashed the values of the column. Returns false if the type of the column
+	//! does not allow this (e.g. because the stored value requires a conversion we do not invert here).
+	static bool HashConstant(const Value &constant, const LogicalType &type,
+	                         const duckdb_parquet::format::SchemaElement &schema_ele, uint64_t &result);
+
+private:
+	unique_ptr<data_t[]> data;
+	idx_t num_bytes;
+};
+
+} // namespace duckdb
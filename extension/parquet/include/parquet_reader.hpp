@@ -62,6 +62,10 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges [start, end) of the current row group that the page index proves to contain no matching rows
+	vector<pair<idx_t, idx_t>> skipped_ranges;
+	idx_t skipped_range_idx = 0;
 };
 
 struct ParquetOptions {
@@ -152,6 +156,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Checks the equality filters on a column against the bloom filter of its column chunk
+	bool BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader, const ColumnChunk &chunk,
+	                         TableFilter &filter);
+	//! Uses the page indexes of the filtered columns to find the row ranges of the current row group that can be
+	//! skipped, and hands the offset indexes to the column readers so they can skip these pages without reading them
+	void PreparePageIndex(ParquetReaderScanState &state, idx_t column_count);
+	//! Skips the rows of a skipped row range at the current position, returns false if there is none
+	bool SkipFilteredRows(ParquetReaderScanState &state, idx_t column_count);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 	void RearrangeChildReaders(unique_ptr<duckdb::ColumnReader> &root_reader, vector<column_t> &column_ids);
 
@@ -14,6 +14,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/common/types/column_data_collection.hpp"
 #endif
 
@@ -25,12 +26,36 @@ namespace duckdb {
 class FileSystem;
 class FileOpener;
 
+//! A row group whose column chunks have been encoded, compressed and serialized in memory
+struct PreparedRowGroup {
+	PreparedRowGroup();
+
+	duckdb_parquet::format::RowGroup row_group;
+	//! The serialized column chunks. The page offsets in the row group are relative to the start of this buffer
+	BufferedSerializer buffer;
+	//! The protocol used to serialize the page headers into the buffer
+	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
+	//! The page index of every column chunk (or nullptr), which is written after all row groups
+	vector<unique_ptr<duckdb_parquet::format::ColumnIndex>> column_indexes;
+	vector<unique_ptr<duckdb_parquet::format::OffsetIndex>> offset_indexes;
+
+	idx_t GetTotalWritten() const {
+		return buffer.blob.size;
+	}
+};
+
 class ParquetWriter {
 public:
 	ParquetWriter(FileSystem &fs, string file_name, FileOpener *file_opener, vector<LogicalType> types,
-	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec);
+	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, bool bloom_filters);
 
 public:
+	//! Encodes, compresses and serializes the buffered data into a row group in memory. This can be called by many
+	//! threads in parallel.
+	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Appends a prepared row group to the file
+	void FlushRowGroup(PreparedRowGroup &row_group);
+	//! Prepares the buffered data as a row group and appends it to the file
 	void Flush(ColumnDataCollection &buffer);
 	void Finalize();
 
@@ -46,6 +71,10 @@ public:
 	duckdb_parquet::format::Type::type GetType(idx_t schema_idx) {
 		return file_meta_data.schema[schema_idx].type;
 	}
+	//! Whether or not bloom filters are written for the column chunks
+	bool BloomFiltersEnabled() const {
+		return bloom_filters;
+	}
 	BufferedFileWriter &GetWriter() {
 		return *writer;
 	}
@@ -55,11 +84,15 @@ private:
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec;
+	bool bloom_filters;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
 	duckdb_parquet::format::FileMetaData file_meta_data;
 	std::mutex lock;
+	//! The page indexes of the row groups that have been written
+	vector<vector<unique_ptr<duckdb_parquet::format::ColumnIndex>>> column_indexes;
+	vector<vector<unique_ptr<duckdb_parquet::format::OffsetIndex>>> offset_indexes;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
 };
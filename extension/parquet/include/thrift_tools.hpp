@@ -105,17 +105,28 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Prefetch all read heads: the ranges are read as a single batch, which lets the file system issue them at once
 	void Prefetch() {
+		vector<FileReadRequest> requests;
+		vector<ReadHead *> heads;
 		for (auto &read_head : read_heads) {
+			if (read_head.data_isset) {
+				continue;
+			}
 			read_head.Allocate(allocator);
 
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
-
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+			requests.emplace_back(read_head.data.get(), read_head.size, read_head.location);
+			heads.push_back(&read_head);
+		}
+		if (requests.empty()) {
+			return;
+		}
+		handle.file_system.ReadBatch(handle, requests.data(), requests.size());
+		for (auto head : heads) {
+			head->data_isset = true;
 		}
 	}
 };
@@ -115,6 +115,8 @@ struct ParquetWriteBindData : public TableFunctionData {
 	vector<string> column_names;
 	duckdb_parquet::format::CompressionCodec::type codec = duckdb_parquet::format::CompressionCodec::SNAPPY;
 	idx_t row_group_size = RowGroup::ROW_GROUP_SIZE;
+	//! Whether or not to write bloom filters for the column chunks
+	bool bloom_filters = false;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -737,6 +739,8 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyInfo &info
 				}
 			}
 			throw ParserException("Expected %s argument to be either [uncompressed, snappy, gzip or zstd]", loption);
+		} else if (loption == "bloom_filter" || loption == "bloom_filters") {
+			bind_data->bloom_filters = option.second.empty() || option.second[0].GetValue<bool>();
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -754,7 +758,7 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer =
 	    make_unique<ParquetWriter>(fs, file_path, FileSystem::GetFileOpener(context), parquet_bind.sql_types,
-	                               parquet_bind.column_names, parquet_bind.codec);
+	                               parquet_bind.column_names, parquet_bind.codec, parquet_bind.bloom_filters);
 	return std::move(global_state);
 }
 
@@ -0,0 +1,296 @@
+#include "parquet_bloom_filter.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/value.hpp"
+#endif
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::Type;
+
+constexpr const idx_t ParquetBloomFilter::BLOCK_SIZE;
+constexpr const idx_t ParquetBloomFilter::MINIMUM_SIZE;
+constexpr const idx_t ParquetBloomFilter::MAXIMUM_SIZE;
+constexpr const double ParquetBloomFilter::DEFAULT_FPP;
+
+// the salts used to derive the eight bits that are set in a block, as defined by the specification
+static const uint32_t BLOOM_FILTER_SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_bytes_p) : num_bytes(num_bytes_p) {
+	D_ASSERT(num_bytes % BLOCK_SIZE == 0);
+	data = unique_ptr<data_t[]>(new data_t[num_bytes]);
+	memset(data.get(), 0, num_bytes);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(unique_ptr<data_t[]> data_p, idx_t num_bytes_p)
+    : data(std::move(data_p)), num_bytes(num_bytes_p) {
+	D_ASSERT(num_bytes % BLOCK_SIZE == 0);
+}
+
+idx_t ParquetBloomFilter::OptimalNumBytes(idx_t distinct_values, double fpp) {
+	// every value sets eight bits in a single block: this gives the bits required for the desired error rate
+	auto num_bits = -8.0 * double(distinct_values) / std::log(1.0 - std::pow(fpp, 1.0 / 8.0));
+	auto num_bytes = idx_t(num_bits / 8.0);
+	if (num_bytes <= MINIMUM_SIZE) {
+		return MINIMUM_SIZE;
+	}
+	if (num_bytes >= MAXIMUM_SIZE) {
+		return MAXIMUM_SIZE;
+	}
+	return NextPowerOfTwo(num_bytes);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto num_blocks = num_bytes / BLOCK_SIZE;
+	auto block_idx = ((hash >> 32) * num_blocks) >> 32;
+	auto block = data.get() + block_idx * BLOCK_SIZE;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		auto word = Load<uint32_t>(block + i * sizeof(uint32_t));
+		word |= uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+		Store<uint32_t>(word, block + i * sizeof(uint32_t));
+	}
+}
+
+bool ParquetBloomFilter::Check(uint64_t hash) const {
+	auto num_blocks = num_bytes / BLOCK_SIZE;
+	auto block_idx = ((hash >> 32) * num_blocks) >> 32;
+	auto block = data.get() + block_idx * BLOCK_SIZE;
+	auto key = uint32_t(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		auto word = Load<uint32_t>(block + i * sizeof(uint32_t));
+		if (!(word & (uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// the algorithm, hash and compression of the header are unions that each have a single (empty) struct member
+static void WriteUnionField(TProtocol &protocol, const char *name, int16_t field_id, const char *member) {
+	protocol.writeFieldBegin(name, TType::T_STRUCT, field_id);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(member, TType::T_STRUCT, 1);
+	protocol.writeStructBegin(member);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+static int16_t ReadUnionField(TProtocol &protocol) {
+	int16_t result = -1;
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		result = field_id;
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return result;
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol, BufferedSerializer &target) const {
+	// the header is the thrift struct BloomFilterHeader, which our generated parquet types predate
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", TType::T_I32, 1);
+	protocol.writeI32(int32_t(num_bytes));
+	protocol.writeFieldEnd();
+	WriteUnionField(protocol, "algorithm", 2, "BLOCK");
+	WriteUnionField(protocol, "hash", 3, "XXHASH");
+	WriteUnionField(protocol, "compression", 4, "UNCOMPRESSED");
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+
+	target.WriteData(data.get(), num_bytes);
+}
+
+bool ParquetBloomFilter::ReadHeader(TProtocol &protocol, idx_t &result_bytes) {
+	int32_t filter_bytes = 0;
+	bool supported = true;
+
+	std::string name;
+	TType field_type;
+	int16_t field_id;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == TType::T_I32) {
+			protocol.readI32(filter_bytes);
+		} else if (field_id >= 2 && field_id <= 4 && field_type == TType::T_STRUCT) {
+			// the split block algorithm, xxhash and no compression are the first member of their union
+			if (ReadUnionField(protocol) != 1) {
+				supported = false;
+			}
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+
+	if (!supported || filter_bytes <= 0 || idx_t(filter_bytes) % BLOCK_SIZE != 0 ||
+	    idx_t(filter_bytes) > MAXIMUM_SIZE) {
+		return false;
+	}
+	result_bytes = idx_t(filter_bytes);
+	return true;
+}
+
+static bool IsPlainInteger(const duckdb_parquet::format::SchemaElement &schema_ele) {
+	if (schema_ele.__isset.logicalType) {
+		auto &logical_type = schema_ele.logicalType;
+		if (logical_type.__isset.DATE || logical_type.__isset.TIME || logical_type.__isset.TIMESTAMP ||
+		    logical_type.__isset.DECIMAL) {
+			return false;
+		}
+	}
+	if (!schema_ele.__isset.converted_type) {
+		return true;
+	}
+	switch (schema_ele.converted_type) {
+	case duckdb_parquet::format::ConvertedType::INT_8:
+	case duckdb_parquet::format::ConvertedType::INT_16:
+	case duckdb_parquet::format::ConvertedType::INT_32:
+	case duckdb_parquet::format::ConvertedType::INT_64:
+	case duckdb_parquet::format::ConvertedType::UINT_8:
+	case duckdb_parquet::format::ConvertedType::UINT_16:
+	case duckdb_parquet::format::ConvertedType::UINT_32:
+	case duckdb_parquet::format::ConvertedType::UINT_64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::HashConstant(const Value &constant, const LogicalType &type,
+                                      const duckdb_parquet::format::SchemaElement &schema_ele, uint64_t &result) {
+	if (constant.IsNull() || constant.type() != type) {
+		return false;
+	}
+	// the values are hashed in their plain encoding
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::DECIMAL: {
+		// only hash values that are stored without any conversion from the value we read
+		switch (type.id()) {
+		case LogicalTypeId::DATE:
+			if (!(schema_ele.__isset.converted_type &&
+			      schema_ele.converted_type == duckdb_parquet::format::ConvertedType::DATE) &&
+			    !(schema_ele.__isset.logicalType && schema_ele.logicalType.__isset.DATE)) {
+				return false;
+			}
+			break;
+		case LogicalTypeId::DECIMAL:
+			if (!schema_ele.__isset.scale || schema_ele.scale != DecimalType::GetScale(type)) {
+				return false;
+			}
+			break;
+		default:
+			if (!IsPlainInteger(schema_ele)) {
+				return false;
+			}
+			break;
+		}
+		int64_t integer;
+		switch (type.id()) {
+		case LogicalTypeId::DATE:
+			integer = constant.GetValue<date_t>().days;
+			break;
+		case LogicalTypeId::UBIGINT:
+			integer = int64_t(constant.GetValue<uint64_t>());
+			break;
+		case LogicalTypeId::DECIMAL:
+			// decimals are stored as their unscaled integer value
+			switch (type.InternalType()) {
+			case PhysicalType::INT16:
+				integer = constant.GetValueUnsafe<int16_t>();
+				break;
+			case PhysicalType::INT32:
+				integer = constant.GetValueUnsafe<int32_t>();
+				break;
+			case PhysicalType::INT64:
+				integer = constant.GetValueUnsafe<int64_t>();
+				break;
+			default:
+				return false;
+			}
+			break;
+		default:
+			integer = constant.GetValue<int64_t>();
+			break;
+		}
+		if (schema_ele.type == Type::INT32) {
+			result = Hash<int32_t>(int32_t(integer));
+			return true;
+		}
+		if (schema_ele.type == Type::INT64) {
+			result = Hash<int64_t>(integer);
+			return true;
+		}
+		return false;
+	}
+	case LogicalTypeId::FLOAT: {
+		auto value = constant.GetValue<float>();
+		// zero and NaN compare equal to values with a different bit pattern (-0.0, other NaNs)
+		if (schema_ele.type != Type::FLOAT || value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		result = Hash<float>(value);
+		return true;
+	}
+	case LogicalTypeId::DOUBLE: {
+		auto value = constant.GetValue<double>();
+		if (schema_ele.type != Type::DOUBLE || value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		result = Hash<double>(value);
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (schema_ele.type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		result = Hash((const_data_ptr_t)str.c_str(), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -122,6 +122,15 @@ void ParquetMetaDataOperatorData::BindMetaData(vector<LogicalType> &return_types
 
 	names.emplace_back("total_uncompressed_size");
 	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bloom_filter_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("column_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("offset_index_offset");
+	return_types.emplace_back(LogicalType::BIGINT);
 }
 
 Value ConvertParquetStats(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
@@ -246,6 +255,21 @@ void ParquetMetaDataOperatorData::LoadFileMetaData(ClientContext &context, const
 			// total_uncompressed_size, LogicalType::BIGINT
 			current_chunk.SetValue(22, count, Value::BIGINT(col_meta.total_uncompressed_size));
 
+			// bloom_filter_offset, LogicalType::BIGINT
+			current_chunk.SetValue(23, count,
+			                       col_meta.__isset.bloom_filter_offset ? Value::BIGINT(col_meta.bloom_filter_offset)
+			                                                            : Value(LogicalType::BIGINT));
+
+			// column_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(24, count,
+			                       column.__isset.column_index_offset ? Value::BIGINT(column.column_index_offset)
+			                                                          : Value(LogicalType::BIGINT));
+
+			// offset_index_offset, LogicalType::BIGINT
+			current_chunk.SetValue(25, count,
+			                       column.__isset.offset_index_offset ? Value::BIGINT(column.offset_index_offset)
+			                                                          : Value(LogicalType::BIGINT));
+
 			count++;
 			if (count >= STANDARD_VECTOR_SIZE) {
 				current_chunk.SetCardinality(count);
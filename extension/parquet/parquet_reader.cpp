@@ -1,4 +1,5 @@
 #include "parquet_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_timestamp.hpp"
 #include "parquet_statistics.hpp"
 #include "column_reader.hpp"
@@ -41,9 +42,11 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -696,12 +699,255 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t o
 				return;
 			}
 		}
+		if (filter_entry != state.filters->filters.end() && !parquet_options.union_by_name &&
+		    column_reader->MaxRepeat() == 0 && column_reader->Type().InternalType() != PhysicalType::STRUCT &&
+		    column_reader->FileIdx() < group.columns.size()) {
+			auto &chunk = group.columns[column_reader->FileIdx()];
+			if (chunk.meta_data.__isset.bloom_filter_offset &&
+			    BloomFilterExcludes(state, *column_reader, chunk, *filter_entry->second)) {
+				// the bloom filter shows that none of the values we are looking for are in this row group
+				state.group_offset = group.num_rows;
+				return;
+			}
+		}
 	}
 
 	state.root_reader->InitializeRead(state.group_idx_list[state.current_group], group.columns,
 	                                  *state.thrift_file_proto);
 }
 
+static bool HasEqualityFilter(TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return ((ConstantFilter &)filter).comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (HasEqualityFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!HasEqualityFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool FilterExcludedByBloomFilter(TableFilter &filter, ParquetBloomFilter &bloom_filter, ColumnReader &reader) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = (ConstantFilter &)filter;
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !ParquetBloomFilter::HashConstant(constant_filter.constant, reader.Type(), reader.Schema(), hash)) {
+			return false;
+		}
+		return !bloom_filter.Check(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = (ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (FilterExcludedByBloomFilter(*child_filter, bloom_filter, reader)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = (ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!FilterExcludedByBloomFilter(*child_filter, bloom_filter, reader)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Creates a protocol over a transport of its own, so that reading the indexes does not interfere with the
+//! (registered) prefetches of the scan
+static unique_ptr<duckdb_apache::thrift::protocol::TProtocol> CreateIndexProtocol(Allocator &allocator,
+                                                                                   FileHandle &file_handle,
+                                                                                   FileOpener &opener, idx_t offset,
+                                                                                   idx_t length) {
+	auto proto = CreateThriftProtocol(allocator, file_handle, opener, true);
+	auto &transport = (ThriftFileTransport &)*proto->getTransport();
+	transport.Prefetch(offset, length);
+	transport.SetLocation(offset);
+	return proto;
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                        const ColumnChunk &chunk, TableFilter &filter) {
+	if (!HasEqualityFilter(filter)) {
+		return false;
+	}
+	// the bloom filter header is small, but its size is not stored in the meta data
+	static constexpr const idx_t BLOOM_FILTER_HEADER_SIZE = 64;
+	auto file_size = state.file_handle->GetFileSize();
+	auto offset = idx_t(chunk.meta_data.bloom_filter_offset);
+	if (offset >= file_size) {
+		return false;
+	}
+	auto proto = CreateIndexProtocol(allocator, *state.file_handle, *file_opener, offset,
+	                                 MinValue<idx_t>(BLOOM_FILTER_HEADER_SIZE, file_size - offset));
+	auto &transport = (ThriftFileTransport &)*proto->getTransport();
+	idx_t num_bytes;
+	if (!ParquetBloomFilter::ReadHeader(*proto, num_bytes) || transport.GetLocation() + num_bytes > file_size) {
+		return false;
+	}
+	transport.Prefetch(transport.GetLocation(), num_bytes);
+	auto filter_data = unique_ptr<data_t[]>(new data_t[num_bytes]);
+	transport.read(filter_data.get(), num_bytes);
+	ParquetBloomFilter bloom_filter(std::move(filter_data), num_bytes);
+	return FilterExcludedByBloomFilter(filter, bloom_filter, column_reader);
+}
+
+void ParquetReader::PreparePageIndex(ParquetReaderScanState &state, idx_t column_count) {
+	state.skipped_ranges.clear();
+	state.skipped_range_idx = 0;
+	if (!state.filters || parquet_options.union_by_name) {
+		return;
+	}
+	auto &group = GetGroup(state);
+	auto file_size = state.file_handle->GetFileSize();
+	auto root_reader = ((StructColumnReader *)state.root_reader.get());
+	for (auto &filter_entry : state.filters->filters) {
+		auto out_col_idx = filter_entry.first;
+		auto file_col_idx = state.column_ids[out_col_idx];
+		if (IsRowIdColumnId(file_col_idx)) {
+			continue;
+		}
+		auto column_reader = root_reader->GetChildReader(file_col_idx);
+		if (column_reader->Type().InternalType() == PhysicalType::STRUCT ||
+		    column_reader->Type().InternalType() == PhysicalType::LIST || column_reader->MaxRepeat() > 0 ||
+		    column_reader->FileIdx() >= group.columns.size()) {
+			continue;
+		}
+		auto &chunk = group.columns[column_reader->FileIdx()];
+		if (!chunk.__isset.column_index_offset || !chunk.__isset.offset_index_offset ||
+		    idx_t(chunk.column_index_offset + chunk.column_index_length) > file_size ||
+		    idx_t(chunk.offset_index_offset + chunk.offset_index_length) > file_size) {
+			continue;
+		}
+		ColumnIndex column_index;
+		column_index.read(CreateIndexProtocol(allocator, *state.file_handle, *file_opener, chunk.column_index_offset,
+		                                      chunk.column_index_length)
+		                      .get());
+		OffsetIndex offset_index;
+		offset_index.read(CreateIndexProtocol(allocator, *state.file_handle, *file_opener, chunk.offset_index_offset,
+		                                      chunk.offset_index_length)
+		                      .get());
+		auto page_count = offset_index.page_locations.size();
+		if (column_index.min_values.size() != page_count || column_index.max_values.size() != page_count ||
+		    column_index.null_pages.size() != page_count) {
+			continue;
+		}
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			if (column_index.null_pages[page_idx]) {
+				continue;
+			}
+			// check the filter against the statistics of the page, as if it were a column chunk of its own
+			ColumnChunk page_chunk;
+			page_chunk.__isset.meta_data = true;
+			page_chunk.meta_data.type = chunk.meta_data.type;
+			page_chunk.meta_data.__isset.statistics = true;
+			auto &page_stats = page_chunk.meta_data.statistics;
+			page_stats.min_value = column_index.min_values[page_idx];
+			page_stats.max_value = column_index.max_values[page_idx];
+			page_stats.__isset.min_value = true;
+			page_stats.__isset.max_value = true;
+			if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+				page_stats.null_count = column_index.null_counts[page_idx];
+				page_stats.__isset.null_count = true;
+			}
+			auto stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader->Schema(),
+			                                                               column_reader->Type(), page_chunk);
+			if (!stats || filter_entry.second->CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				continue;
+			}
+			idx_t start = offset_index.page_locations[page_idx].first_row_index;
+			idx_t end = page_idx + 1 < page_count ? offset_index.page_locations[page_idx + 1].first_row_index
+			                                      : idx_t(group.num_rows);
+			state.skipped_ranges.emplace_back(start, end);
+		}
+	}
+	if (state.skipped_ranges.empty()) {
+		return;
+	}
+	// merge the ranges of the different columns: a row can be skipped if any of the filters excludes it
+	std::sort(state.skipped_ranges.begin(), state.skipped_ranges.end());
+	idx_t merged_count = 0;
+	for (idx_t i = 1; i < state.skipped_ranges.size(); i++) {
+		auto &last = state.skipped_ranges[merged_count];
+		if (state.skipped_ranges[i].first <= last.second) {
+			last.second = MaxValue<idx_t>(last.second, state.skipped_ranges[i].second);
+		} else {
+			state.skipped_ranges[++merged_count] = state.skipped_ranges[i];
+		}
+	}
+	state.skipped_ranges.resize(merged_count + 1);
+
+	// hand the offset indexes to the readers of the flat columns, so that the skipped pages are not even fetched
+	for (idx_t out_col_idx = 0; out_col_idx < column_count; out_col_idx++) {
+		auto file_col_idx = state.column_ids[out_col_idx];
+		if (IsRowIdColumnId(file_col_idx) || union_null_cols[out_col_idx]) {
+			continue;
+		}
+		auto column_reader = root_reader->GetChildReader(file_col_idx);
+		if (column_reader->Type().InternalType() == PhysicalType::STRUCT ||
+		    column_reader->Type().InternalType() == PhysicalType::LIST || column_reader->MaxRepeat() > 0 ||
+		    column_reader->FileIdx() >= group.columns.size()) {
+			continue;
+		}
+		auto &chunk = group.columns[column_reader->FileIdx()];
+		if (!chunk.__isset.offset_index_offset ||
+		    idx_t(chunk.offset_index_offset + chunk.offset_index_length) > file_size) {
+			continue;
+		}
+		auto offset_index = make_unique<OffsetIndex>();
+		offset_index->read(CreateIndexProtocol(allocator, *state.file_handle, *file_opener,
+		                                       chunk.offset_index_offset, chunk.offset_index_length)
+		                       .get());
+		column_reader->SetOffsetIndex(std::move(offset_index), state.skipped_ranges);
+	}
+}
+
+bool ParquetReader::SkipFilteredRows(ParquetReaderScanState &state, idx_t column_count) {
+	auto &ranges = state.skipped_ranges;
+	while (state.skipped_range_idx < ranges.size() && ranges[state.skipped_range_idx].second <= state.group_offset) {
+		state.skipped_range_idx++;
+	}
+	if (state.skipped_range_idx >= ranges.size() || ranges[state.skipped_range_idx].first > state.group_offset) {
+		return false;
+	}
+	auto skip_count = MinValue<idx_t>(ranges[state.skipped_range_idx].second, GetGroup(state).num_rows) -
+	                  state.group_offset;
+	auto root_reader = ((StructColumnReader *)state.root_reader.get());
+	for (idx_t out_col_idx = 0; out_col_idx < column_count; out_col_idx++) {
+		auto file_col_idx = state.column_ids[out_col_idx];
+		if (IsRowIdColumnId(file_col_idx) || union_null_cols[out_col_idx]) {
+			continue;
+		}
+		root_reader->GetChildReader(file_col_idx)->Skip(skip_count);
+	}
+	state.group_offset += skip_count;
+	return true;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -990,6 +1236,9 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		auto &group = GetGroup(state);
+		if (state.group_offset != (idx_t)group.num_rows) {
+			PreparePageIndex(state, result.ColumnCount());
+		}
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
 
 			uint64_t total_row_group_span = GetGroupSpan(state);
@@ -1040,6 +1289,11 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	if (!state.skipped_ranges.empty() && SkipFilteredRows(state, result.ColumnCount())) {
+		// the page index shows that none of these rows match the filters
+		return true;
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
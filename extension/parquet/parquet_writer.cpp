@@ -226,8 +226,9 @@ void VerifyUniqueNames(const vector<string> &names) {
 }
 
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *file_opener_p, vector<LogicalType> types_p,
-                             vector<string> names_p, CompressionCodec::type codec)
-    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec) {
+                             vector<string> names_p, CompressionCodec::type codec, bool bloom_filters)
+    : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
+      bloom_filters(bloom_filters) {
 	// initialize the file writer
 	writer = make_unique<BufferedFileWriter>(
 	    fs, file_name.c_str(), FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW, file_opener_p);
@@ -261,17 +262,17 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, FileOpener *fil
 	}
 }
 
-void ParquetWriter::Flush(ColumnDataCollection &buffer) {
-	if (buffer.Count() == 0) {
-		return;
-	}
+PreparedRowGroup::PreparedRowGroup() {
+	TCompactProtocolFactoryT<MyTransport> tproto_factory;
+	protocol = tproto_factory.getProtocol(make_shared<MyTransport>(buffer));
+}
 
+void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
 	// set up a new row group for this chunk collection
-	ParquetRowGroup row_group;
+	auto &row_group = result.row_group;
 	row_group.num_rows = buffer.Count();
 	row_group.__isset.file_offset = true;
 
-	vector<unique_ptr<ColumnWriterState>> states;
 	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
 	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
@@ -290,23 +291,91 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 		for (auto &chunk : buffer.Chunks()) {
 			col_writer->Write(*write_state, chunk.data[col_idx], chunk.size());
 		}
-		states.push_back(std::move(write_state));
+		// serialize the column chunk into the in-memory row group, so that the state can be released right away
+		col_writer->FinalizeWrite(*write_state, result);
 	}
+}
+
+void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
+	auto &row_group = prepared.row_group;
 
 	lock_guard<mutex> glock(lock);
-	row_group.file_offset = writer->GetTotalWritten();
-	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
-		const auto &col_writer = column_writers[col_idx];
-		auto write_state = std::move(states[col_idx]);
-		col_writer->FinalizeWrite(*write_state);
+	auto file_offset = writer->GetTotalWritten();
+	writer->WriteData(prepared.buffer.blob.data.get(), prepared.GetTotalWritten());
+
+	// the offsets of the column chunks are relative to the start of the row group: make them absolute
+	row_group.file_offset = file_offset;
+	for (auto &column_chunk : row_group.columns) {
+		column_chunk.meta_data.data_page_offset += file_offset;
+		if (column_chunk.meta_data.__isset.dictionary_page_offset) {
+			column_chunk.meta_data.dictionary_page_offset += file_offset;
+		}
+		if (column_chunk.meta_data.__isset.bloom_filter_offset) {
+			column_chunk.meta_data.bloom_filter_offset += file_offset;
+		}
 	}
+	for (auto &offset_index : prepared.offset_indexes) {
+		if (!offset_index) {
+			continue;
+		}
+		for (auto &location : offset_index->page_locations) {
+			location.offset += file_offset;
+		}
+	}
+	prepared.column_indexes.resize(row_group.columns.size());
+	prepared.offset_indexes.resize(row_group.columns.size());
+	column_indexes.push_back(std::move(prepared.column_indexes));
+	offset_indexes.push_back(std::move(prepared.offset_indexes));
 
 	// append the row group to the file meta data
-	file_meta_data.row_groups.push_back(row_group);
-	file_meta_data.num_rows += buffer.Count();
+	file_meta_data.num_rows += row_group.num_rows;
+	file_meta_data.row_groups.push_back(std::move(row_group));
+}
+
+void ParquetWriter::Flush(ColumnDataCollection &buffer) {
+	if (buffer.Count() == 0) {
+		return;
+	}
+	// encoding and compression happen in the calling thread, only appending the bytes to the file is serialized
+	PreparedRowGroup prepared;
+	PrepareRowGroup(buffer, prepared);
+	FlushRowGroup(prepared);
 }
 
 void ParquetWriter::Finalize() {
+	// write the page indexes: first the column indexes of all column chunks, then their offset indexes
+	D_ASSERT(column_indexes.size() == file_meta_data.row_groups.size());
+	for (idx_t rg_idx = 0; rg_idx < file_meta_data.row_groups.size(); rg_idx++) {
+		auto &columns = file_meta_data.row_groups[rg_idx].columns;
+		for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+			auto &column_index = column_indexes[rg_idx][col_idx];
+			if (!column_index) {
+				continue;
+			}
+			auto index_offset = writer->GetTotalWritten();
+			column_index->write(protocol.get());
+			columns[col_idx].column_index_offset = index_offset;
+			columns[col_idx].column_index_length = writer->GetTotalWritten() - index_offset;
+			columns[col_idx].__isset.column_index_offset = true;
+			columns[col_idx].__isset.column_index_length = true;
+		}
+	}
+	for (idx_t rg_idx = 0; rg_idx < file_meta_data.row_groups.size(); rg_idx++) {
+		auto &columns = file_meta_data.row_groups[rg_idx].columns;
+		for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+			auto &offset_index = offset_indexes[rg_idx][col_idx];
+			if (!offset_index) {
+				continue;
+			}
+			auto index_offset = writer->GetTotalWritten();
+			offset_index->write(protocol.get());
+			columns[col_idx].offset_index_offset = index_offset;
+			columns[col_idx].offset_index_length = writer->GetTotalWritten() - index_offset;
+			columns[col_idx].__isset.offset_index_offset = true;
+			columns[col_idx].__isset.offset_index_length = true;
+		}
+	}
+
 	auto start_offset = writer->GetTotalWritten();
 	file_meta_data.write(protocol.get());
 
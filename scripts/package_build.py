@@ -13,6 +13,7 @@ def third_party_includes():
     includes += [os.path.join('third_party', 'fsst')]
     includes += [os.path.join('third_party', 're2')]
     includes += [os.path.join('third_party', 'miniz')]
+    includes += [os.path.join('third_party', 'zstd', 'include')]
     includes += [os.path.join('third_party', 'utf8proc', 'include')]
     includes += [os.path.join('third_party', 'utf8proc')]
     includes += [os.path.join('third_party', 'hyperloglog')]
@@ -37,6 +38,7 @@ def third_party_sources():
     sources += [os.path.join('third_party', 'fmt')]
     sources += [os.path.join('third_party', 'fsst')]
     sources += [os.path.join('third_party', 'miniz')]
+    sources += [os.path.join('third_party', 'zstd')]
     sources += [os.path.join('third_party', 're2')]
     sources += [os.path.join('third_party', 'hyperloglog')]
     sources += [os.path.join('third_party', 'fastpforlib')]
@@ -0,0 +1,71 @@
+# Serves the files in a directory over HTTP with support for range requests, ETags and Last-Modified headers, as a
+# local stand-in for remote HTTP/S3 storage in tests. Usage:
+#   python3 scripts/run_http_test_server.py <directory> [port]
+# and run the tests with HTTP_TEST_SERVER_DIR=<directory> HTTP_TEST_SERVER_URL=http://localhost:<port>
+import email.utils
+import http.server
+import os
+import re
+import socketserver
+import sys
+
+serve_dir = os.path.abspath(sys.argv[1] if len(sys.argv) > 1 else '.')
+port = int(sys.argv[2]) if len(sys.argv) > 2 else 8123
+
+
+class RangeRequestHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = 'HTTP/1.1'
+
+    def resolve(self):
+        path = os.path.normpath(os.path.join(serve_dir, self.path.split('?')[0].lstrip('/')))
+        if not path.startswith(serve_dir) or not os.path.isfile(path):
+            self.send_response(404)
+            self.send_header('Content-Length', '0')
+            self.end_headers()
+            return None
+        return path
+
+    def send_file_headers(self, path, length):
+        stat = os.stat(path)
+        self.send_header('Content-Length', str(length))
+        self.send_header('Accept-Ranges', 'bytes')
+        self.send_header('ETag', '"%x-%x"' % (stat.st_mtime_ns, stat.st_size))
+        self.send_header('Last-Modified', email.utils.formatdate(stat.st_mtime, usegmt=True))
+        self.end_headers()
+
+    def do_HEAD(self):
+        path = self.resolve()
+        if path:
+            self.send_response(200)
+            self.send_file_headers(path, os.path.getsize(path))
+
+    def do_GET(self):
+        path = self.resolve()
+        if not path:
+            return
+        size = os.path.getsize(path)
+        begin, end = 0, size - 1
+        match = re.match(r'bytes=(\d+)-(\d*)', self.headers.get('Range', ''))
+        if match:
+            begin = int(match.group(1))
+            end = min(int(match.group(2)), size - 1) if match.group(2) else size - 1
+            if begin > end:
+                self.send_response(416)
+                self.send_header('Content-Length', '0')
+                self.end_headers()
+                return
+            self.send_response(206)
+            self.send_header('Content-Range', 'bytes %d-%d/%d' % (begin, end, size))
+        else:
+            self.send_response(200)
+        self.send_file_headers(path, end - begin + 1)
+        with open(path, 'rb') as f:
+            f.seek(begin)
+            self.wfile.write(f.read(end - begin + 1))
+
+
+class ThreadingServer(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+
+
+ThreadingServer(('localhost', port), RangeRequestHandler).serve_forever()
@@ -4,6 +4,9 @@
 #include "duckdb/common/array.hpp"
 #include "duckdb/common/types/interval.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/types/string_heap.hpp"
+#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/main/query_result.hpp"
 
 namespace duckdb {
 
@@ -31,6 +34,10 @@ struct ArrowAppendData {
 	// child data (if any)
 	vector<unique_ptr<ArrowAppendData>> child_data;
 
+	//! the strings of a dictionary-encoded VARCHAR column, mapped to their index in the dictionary
+	string_map_t<int32_t> dictionary_entries;
+	StringHeap dictionary_heap;
+
 	//! the arrow array C API data, only set after Finalize
 	unique_ptr<ArrowArray> array;
 	duckdb::array<const void *, 3> buffers = {{nullptr, nullptr, nullptr}};
@@ -40,7 +47,8 @@ struct ArrowAppendData {
 //===--------------------------------------------------------------------===//
 // ArrowAppender
 //===--------------------------------------------------------------------===//
-static unique_ptr<ArrowAppendData> InitializeArrowChild(const LogicalType &type, idx_t capacity);
+static unique_ptr<ArrowAppendData> InitializeArrowChild(const LogicalType &type, idx_t capacity,
+                                                        bool string_dictionary = false);
 static ArrowArray *FinalizeArrowChild(const LogicalType &type, ArrowAppendData &append_data);
 
 ArrowAppender::ArrowAppender(vector<LogicalType> types_p, idx_t initial_capacity) : types(std::move(types_p)) {
@@ -50,6 +58,14 @@ ArrowAppender::ArrowAppender(vector<LogicalType> types_p, idx_t initial_capacity
 	}
 }
 
+ArrowAppender::ArrowAppender(vector<LogicalType> types_p, idx_t initial_capacity, const ClientProperties &options)
+    : types(std::move(types_p)) {
+	for (auto &type : types) {
+		auto entry = InitializeArrowChild(type, initial_capacity, options.arrow_string_dictionary);
+		root_data.push_back(std::move(entry));
+	}
+}
+
 ArrowAppender::~ArrowAppender() {
 }
 
@@ -91,8 +107,21 @@ static void AppendValidity(ArrowAppendData &append_data, UnifiedVectorFormat &fo
 		return;
 	}
 
-	// otherwise we iterate through the validity mask
 	auto validity_data = (uint8_t *)append_data.validity.data();
+	if (!format.sel->data() && append_data.row_count % 8 == 0) {
+		// the rows are not selected and start at a byte boundary: both masks store a bit per row in the same order
+		// so we can copy the bytes of the validity mask directly
+		auto byte_count = (size + 7) / 8;
+		memcpy(validity_data + append_data.row_count / 8, format.validity.GetData(), byte_count);
+		if (size % 8 != 0) {
+			// the bits past the end of the appended rows are set to valid
+			validity_data[append_data.row_count / 8 + byte_count - 1] |= (uint8_t)(0xFF << (size % 8));
+		}
+		append_data.null_count += size - format.validity.CountValid(size);
+		return;
+	}
+
+	// otherwise we iterate through the validity mask
 	uint8_t current_bit;
 	idx_t current_byte;
 	GetBitPosition(append_data.row_count, current_byte, current_bit);
@@ -154,6 +183,12 @@ struct ArrowScalarBaseData {
 		auto data = (SRC *)format.data;
 		auto result_data = (TGT *)append_data.main_buffer.data();
 
+		if (std::is_same<TGT, SRC>::value && std::is_same<OP, ArrowScalarConverter>::value && !format.sel->data()) {
+			// the values of a flat vector have the arrow layout already: copy them in one go
+			memcpy(result_data + append_data.row_count, data, sizeof(TGT) * size);
+			append_data.row_count += size;
+			return;
+		}
 		for (idx_t i = 0; i < size; i++) {
 			auto source_idx = format.sel->get_index(i);
 			auto result_idx = append_data.row_count + i;
@@ -331,6 +366,85 @@ struct ArrowVarcharData {
 	}
 };
 
+//===--------------------------------------------------------------------===//
+// Dictionary-encoded Varchar
+//===--------------------------------------------------------------------===//
+struct ArrowVarcharDictionaryData {
+	static void Initialize(ArrowAppendData &result, const LogicalType &type, idx_t capacity) {
+		result.main_buffer.reserve(capacity * sizeof(int32_t));
+		// the distinct strings are collected in the dictionary child
+		auto dictionary = InitializeArrowChild(LogicalType::VARCHAR, 0);
+		dictionary->main_buffer.resize(sizeof(uint32_t));
+		*((uint32_t *)dictionary->main_buffer.data()) = 0;
+		result.child_data.push_back(std::move(dictionary));
+	}
+
+	static int32_t GetDictionaryIndex(ArrowAppendData &append_data, const string_t &input) {
+		auto entry = append_data.dictionary_entries.find(input);
+		if (entry != append_data.dictionary_entries.end()) {
+			return entry->second;
+		}
+		// a new string: append it to the dictionary
+		auto &dictionary = *append_data.child_data[0];
+		auto index = (int32_t)dictionary.row_count;
+		auto string_length = input.GetSize();
+		auto last_offset = ((uint32_t *)dictionary.main_buffer.data())[dictionary.row_count];
+		auto current_offset = last_offset + string_length;
+		dictionary.main_buffer.resize(dictionary.main_buffer.size() + sizeof(uint32_t));
+		((uint32_t *)dictionary.main_buffer.data())[dictionary.row_count + 1] = current_offset;
+		dictionary.aux_buffer.resize(current_offset);
+		memcpy(dictionary.aux_buffer.data() + last_offset, input.GetDataUnsafe(), string_length);
+		dictionary.row_count++;
+		ResizeValidity(dictionary.validity, dictionary.row_count);
+
+		append_data.dictionary_entries[append_data.dictionary_heap.AddBlob(input)] = index;
+		return index;
+	}
+
+	static void Append(ArrowAppendData &append_data, Vector &input, idx_t size) {
+		UnifiedVectorFormat format;
+		input.ToUnifiedFormat(size, format);
+
+		AppendValidity(append_data, format, size);
+		append_data.main_buffer.resize(append_data.main_buffer.size() + sizeof(int32_t) * size);
+		auto data = (string_t *)format.data;
+		auto result_data = (int32_t *)append_data.main_buffer.data() + append_data.row_count;
+
+		// the rows of a dictionary vector share their strings: every referenced string is looked up only once
+		vector<int32_t> source_indices;
+		if (input.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+			idx_t source_count = 0;
+			for (idx_t i = 0; i < size; i++) {
+				source_count = MaxValue<idx_t>(source_count, format.sel->get_index(i) + 1);
+			}
+			source_indices.resize(source_count, -1);
+		}
+		for (idx_t i = 0; i < size; i++) {
+			auto source_idx = format.sel->get_index(i);
+			if (!format.validity.RowIsValid(source_idx)) {
+				result_data[i] = 0;
+				continue;
+			}
+			if (source_indices.empty()) {
+				result_data[i] = GetDictionaryIndex(append_data, data[source_idx]);
+				continue;
+			}
+			if (source_indices[source_idx] < 0) {
+				source_indices[source_idx] = GetDictionaryIndex(append_data, data[source_idx]);
+			}
+			result_data[i] = source_indices[source_idx];
+		}
+		append_data.row_count += size;
+	}
+
+	static void Finalize(ArrowAppendData &append_data, const LogicalType &type, ArrowArray *result) {
+		result->n_buffers = 2;
+		result->buffers[1] = append_data.main_buffer.data();
+		// finalize the distinct strings, and assign them to the dictionary
+		result->dictionary = FinalizeArrowChild(LogicalType::VARCHAR, *append_data.child_data[0]);
+	}
+};
+
 //===--------------------------------------------------------------------===//
 // Structs
 //===--------------------------------------------------------------------===//
@@ -645,9 +759,13 @@ static void InitializeFunctionPointers(ArrowAppendData &append_data, const Logic
 	}
 }
 
-unique_ptr<ArrowAppendData> InitializeArrowChild(const LogicalType &type, idx_t capacity) {
+unique_ptr<ArrowAppendData> InitializeArrowChild(const LogicalType &type, idx_t capacity, bool string_dictionary) {
 	auto result = make_unique<ArrowAppendData>();
-	InitializeFunctionPointers(*result, type);
+	if (string_dictionary && type.id() == LogicalTypeId::VARCHAR) {
+		InitializeFunctionPointers<ArrowVarcharDictionaryData>(*result);
+	} else {
+		InitializeFunctionPointers(*result, type);
+	}
 
 	auto byte_count = (capacity + 7) / 8;
 	result->validity.reserve(byte_count);
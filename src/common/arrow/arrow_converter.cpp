@@ -10,6 +10,7 @@
 #include "duckdb/common/types/vector_cache.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/main/query_result.hpp"
 #include <list>
 #include "duckdb/common/arrow/arrow_appender.hpp"
 
@@ -249,8 +250,27 @@ void SetArrowFormat(DuckDBArrowSchemaHolder &root_holder, ArrowSchema &child, co
 	}
 }
 
+static void SetArrowStringDictionaryFormat(DuckDBArrowSchemaHolder &root_holder, ArrowSchema &child) {
+	// the indices are 32-bit integers into a dictionary of strings
+	child.format = "i";
+	root_holder.nested_children.emplace_back();
+	root_holder.nested_children.back().resize(1);
+	root_holder.nested_children_ptr.emplace_back();
+	root_holder.nested_children_ptr.back().push_back(&root_holder.nested_children.back()[0]);
+	InitializeChild(root_holder.nested_children.back()[0]);
+	child.dictionary = root_holder.nested_children_ptr.back()[0];
+	child.dictionary->format = "u";
+}
+
 void ArrowConverter::ToArrowSchema(ArrowSchema *out_schema, vector<LogicalType> &types, vector<string> &names,
                                    string &config_timezone) {
+	ClientProperties options;
+	options.timezone = config_timezone;
+	ToArrowSchema(out_schema, types, names, options);
+}
+
+void ArrowConverter::ToArrowSchema(ArrowSchema *out_schema, vector<LogicalType> &types, vector<string> &names,
+                                   const ClientProperties &options) {
 	D_ASSERT(out_schema);
 	D_ASSERT(types.size() == names.size());
 	idx_t column_count = types.size();
@@ -274,10 +294,15 @@ void ArrowConverter::ToArrowSchema(ArrowSchema *out_schema, vector<LogicalType>
 	out_schema->dictionary = nullptr;
 
 	// Configure all child schemas
+	auto config_timezone = options.timezone;
 	for (idx_t col_idx = 0; col_idx < column_count; col_idx++) {
 
 		auto &child = root_holder->children[col_idx];
 		InitializeChild(child, names[col_idx]);
+		if (options.arrow_string_dictionary && types[col_idx].id() == LogicalTypeId::VARCHAR) {
+			SetArrowStringDictionaryFormat(*root_holder, child);
+			continue;
+		}
 		SetArrowFormat(*root_holder, child, types[col_idx], config_timezone);
 	}
 
@@ -78,9 +78,11 @@ int ResultArrowArrayStreamWrapper::MyStreamGetSchema(struct ArrowArrayStream *st
 		return -1;
 	}
 	auto my_stream = (ResultArrowArrayStreamWrapper *)stream->private_data;
+	// the arrays are appended with the properties of the result, see ArrowUtil::TryFetchChunk
+	auto options = my_stream->result->client_properties;
+	options.timezone = my_stream->timezone_config;
 	if (!my_stream->column_types.empty()) {
-		ArrowConverter::ToArrowSchema(out, my_stream->column_types, my_stream->column_names,
-		                              my_stream->timezone_config);
+		ArrowConverter::ToArrowSchema(out, my_stream->column_types, my_stream->column_names, options);
 		return 0;
 	}
 
@@ -100,7 +102,7 @@ int ResultArrowArrayStreamWrapper::MyStreamGetSchema(struct ArrowArrayStream *st
 		my_stream->column_types = result.types;
 		my_stream->column_names = result.names;
 	}
-	ArrowConverter::ToArrowSchema(out, my_stream->column_types, my_stream->column_names, my_stream->timezone_config);
+	ArrowConverter::ToArrowSchema(out, my_stream->column_types, my_stream->column_names, options);
 	return 0;
 }
 
@@ -186,7 +188,7 @@ bool ArrowUtil::TryFetchNext(QueryResult &result, unique_ptr<DataChunk> &chunk,
 bool ArrowUtil::TryFetchChunk(QueryResult *result, idx_t chunk_size, ArrowArray *out, idx_t &count,
                               PreservedError &error) {
 	count = 0;
-	ArrowAppender appender(result->types, chunk_size);
+	ArrowAppender appender(result->types, chunk_size, result->client_properties);
 	while (count < chunk_size) {
 		unique_ptr<DataChunk> data_chunk;
 		if (!TryFetchNext(*result, data_chunk, error)) {
@@ -0,0 +1,44 @@
+#include "duckdb/common/enums/eviction_policy.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+string EvictionPolicyToString(EvictionPolicy policy) {
+	switch (policy) {
+	case EvictionPolicy::LRU:
+		return "lru";
+	case EvictionPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unrecognized eviction policy");
+	}
+}
+
+EvictionPolicy EvictionPolicyFromString(const string &input) {
+	auto parameter = StringUtil::Lower(input);
+	if (parameter == "lru") {
+		return EvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		return EvictionPolicy::TWO_QUEUE;
+	} else {
+		throw ParserException("Unrecognized eviction policy \"%s\", expected lru or 2q", input);
+	}
+}
+
+string EvictionQueueTypeToString(EvictionQueueType type) {
+	switch (type) {
+	case EvictionQueueType::PROBATIONARY:
+		return "probationary";
+	case EvictionQueueType::LRU:
+		return "lru";
+	case EvictionQueueType::PROTECTED:
+		return "protected";
+	case EvictionQueueType::TEMPORARY:
+		return "temporary";
+	default:
+		throw InternalException("Unrecognized eviction queue type");
+	}
+}
+
+} // namespace duckdb
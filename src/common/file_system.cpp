@@ -239,6 +239,12 @@ void FileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Write (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		Read(handle, requests[i].buffer, requests[i].nr_bytes, requests[i].location);
+	}
+}
+
 int64_t FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	throw NotImplementedException("%s: Read is not implemented!", GetName());
 }
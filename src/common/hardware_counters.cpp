@@ -0,0 +1,140 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#include "duckdb/common/exception.hpp"
+
+#include <cstring>
+
+#if defined(__linux__) && !defined(DUCKDB_DISABLE_HARDWARE_COUNTERS)
+#define DUCKDB_HARDWARE_COUNTERS_AVAILABLE
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+constexpr const idx_t HardwareCounterValues::COUNTER_COUNT;
+
+const char *HardwareCounterValues::GetName(idx_t counter) {
+	switch (HardwareCounterType(counter)) {
+	case HardwareCounterType::CYCLES:
+		return "cycles";
+	case HardwareCounterType::INSTRUCTIONS:
+		return "instructions";
+	case HardwareCounterType::LLC_MISSES:
+		return "llc_misses";
+	case HardwareCounterType::BRANCH_MISSES:
+		return "branch_misses";
+	case HardwareCounterType::DTLB_MISSES:
+		return "dtlb_misses";
+	default:
+		throw InternalException("Unrecognized hardware counter");
+	}
+}
+
+#ifdef DUCKDB_HARDWARE_COUNTERS_AVAILABLE
+static void GetPerfEventConfig(HardwareCounterType type, __u32 &event_type, __u64 &event_config) {
+	switch (type) {
+	case HardwareCounterType::CYCLES:
+		event_type = PERF_TYPE_HARDWARE;
+		event_config = PERF_COUNT_HW_CPU_CYCLES;
+		break;
+	case HardwareCounterType::INSTRUCTIONS:
+		event_type = PERF_TYPE_HARDWARE;
+		event_config = PERF_COUNT_HW_INSTRUCTIONS;
+		break;
+	case HardwareCounterType::LLC_MISSES:
+		event_type = PERF_TYPE_HARDWARE;
+		event_config = PERF_COUNT_HW_CACHE_MISSES;
+		break;
+	case HardwareCounterType::BRANCH_MISSES:
+		event_type = PERF_TYPE_HARDWARE;
+		event_config = PERF_COUNT_HW_BRANCH_MISSES;
+		break;
+	case HardwareCounterType::DTLB_MISSES:
+		event_type = PERF_TYPE_HW_CACHE;
+		event_config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		break;
+	default:
+		throw InternalException("Unrecognized hardware counter");
+	}
+}
+
+static int OpenPerfEvent(HardwareCounterType type, int group_fd) {
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	GetPerfEventConfig(type, attr.type, attr.config);
+	// count user-space events of the calling thread only: this is allowed without privileges
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+#endif
+
+HardwareCounters::HardwareCounters() : group_fd(-1), open_count(0) {
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		fds[i] = -1;
+		read_index[i] = 0;
+	}
+#ifdef DUCKDB_HARDWARE_COUNTERS_AVAILABLE
+	// the cycle counter leads the group, so that all counters are scheduled on the PMU together
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		auto fd = OpenPerfEvent(HardwareCounterType(i), group_fd);
+		if (fd < 0) {
+			if (i == 0) {
+				// no access to the PMU at all
+				return;
+			}
+			// this event is not supported (e.g. in a virtual machine): skip it
+			continue;
+		}
+		if (i == 0) {
+			group_fd = fd;
+		}
+		fds[i] = fd;
+		read_index[i] = open_count++;
+	}
+#endif
+}
+
+HardwareCounters::~HardwareCounters() {
+#ifdef DUCKDB_HARDWARE_COUNTERS_AVAILABLE
+	// close the group members before the leader
+	for (idx_t i = HardwareCounterValues::COUNTER_COUNT; i > 0; i--) {
+		if (fds[i - 1] >= 0) {
+			close(fds[i - 1]);
+		}
+	}
+#endif
+}
+
+HardwareCounters &HardwareCounters::Get() {
+	// perf events count the thread that opened them: every thread needs its own set of counters
+	static thread_local HardwareCounters counters;
+	return counters;
+}
+
+void HardwareCounters::Read(HardwareCounterValues &result) {
+#ifdef DUCKDB_HARDWARE_COUNTERS_AVAILABLE
+	if (group_fd < 0) {
+		return;
+	}
+	// with PERF_FORMAT_GROUP a single read returns the amount of counters followed by their values
+	uint64_t buffer[HardwareCounterValues::COUNTER_COUNT + 1];
+	auto bytes = read(group_fd, buffer, sizeof(uint64_t) * (open_count + 1));
+	if (bytes < ssize_t(sizeof(uint64_t) * (open_count + 1))) {
+		return;
+	}
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		if (fds[i] >= 0) {
+			result.values[i] = buffer[read_index[i] + 1];
+		}
+	}
+#endif
+}
+
+} // namespace duckdb
@@ -0,0 +1,157 @@
+#include "duckdb/common/io_thread_pool.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <condition_variable>
+#include <deque>
+
+namespace duckdb {
+
+//! The tasks of a single call to IOThreadPool::Run
+struct IOThreadPoolJob {
+	IOThreadPoolJob(idx_t count, idx_t max_helpers, const std::function<void(idx_t)> &task)
+	    : task(task), count(count), helpers_left(max_helpers), next_task(0) {
+	}
+
+	const std::function<void(idx_t)> &task;
+	idx_t count;
+	//! The amount of pool threads that can still join this job (protected by the lock of the pool)
+	idx_t helpers_left;
+	//! The index of the next task to run
+	atomic<idx_t> next_task;
+
+	mutex lock;
+	std::condition_variable runners_done;
+	//! The amount of pool threads that are running tasks of this job
+	idx_t runners = 0;
+	std::exception_ptr error;
+
+	void RunTasks() {
+		for (auto task_idx = next_task++; task_idx < count; task_idx = next_task++) {
+			try {
+				task(task_idx);
+			} catch (...) {
+				lock_guard<mutex> guard(lock);
+				if (!error) {
+					error = std::current_exception();
+				}
+				// do not start any further tasks
+				next_task = count;
+			}
+		}
+	}
+
+	void FinishRunner() {
+		lock_guard<mutex> guard(lock);
+		D_ASSERT(runners > 0);
+		if (--runners == 0) {
+			runners_done.notify_all();
+		}
+	}
+
+	void WaitForRunners() {
+		unique_lock<mutex> guard(lock);
+		runners_done.wait(guard, [&]() { return runners == 0; });
+	}
+};
+
+struct IOThreadPoolState {
+	mutex lock;
+	std::condition_variable jobs_available;
+	//! The jobs that threads of the pool can still join, oldest first
+	std::deque<IOThreadPoolJob *> jobs;
+	vector<thread> threads;
+	//! The amount of threads that are waiting for a job
+	idx_t idle_threads = 0;
+	bool shutdown = false;
+
+	void WorkerLoop() {
+		unique_lock<mutex> guard(lock);
+		// the thread is counted as idle from the moment it is started
+		while (true) {
+			jobs_available.wait(guard, [&]() { return shutdown || !jobs.empty(); });
+			if (shutdown) {
+				return;
+			}
+			idle_threads--;
+			auto job = jobs.front();
+			if (--job->helpers_left == 0) {
+				jobs.pop_front();
+			}
+			{
+				// the job cannot finish before this thread has registered: it is still in the queue
+				lock_guard<mutex> job_guard(job->lock);
+				job->runners++;
+			}
+			guard.unlock();
+			job->RunTasks();
+			job->FinishRunner();
+			guard.lock();
+			idle_threads++;
+		}
+	}
+};
+
+IOThreadPool::IOThreadPool() : state(make_unique<IOThreadPoolState>()) {
+}
+
+IOThreadPool::~IOThreadPool() {
+	{
+		lock_guard<mutex> guard(state->lock);
+		state->shutdown = true;
+	}
+	state->jobs_available.notify_all();
+	for (auto &pool_thread : state->threads) {
+		pool_thread.join();
+	}
+}
+
+IOThreadPool &IOThreadPool::Get() {
+	static IOThreadPool pool;
+	return pool;
+}
+
+void IOThreadPool::Run(idx_t count, idx_t max_threads, const std::function<void(idx_t)> &task) {
+#ifndef DUCKDB_NO_THREADS
+	auto helpers = MinValue<idx_t>(MinValue<idx_t>(count, max_threads), MAX_THREADS + 1);
+	if (helpers > 1) {
+		IOThreadPoolJob job(count, helpers - 1, task);
+		{
+			lock_guard<mutex> guard(state->lock);
+			state->jobs.push_back(&job);
+			// start the threads that this job can use if they are not running yet
+			while (state->idle_threads < helpers - 1 && state->threads.size() < MAX_THREADS) {
+				state->threads.emplace_back(&IOThreadPoolState::WorkerLoop, state.get());
+				state->idle_threads++;
+			}
+		}
+		state->jobs_available.notify_all();
+		job.RunTasks();
+		{
+			// all tasks have been started: threads of the pool can no longer join this job
+			lock_guard<mutex> guard(state->lock);
+			for (auto entry = state->jobs.begin(); entry != state->jobs.end(); entry++) {
+				if (*entry == &job) {
+					state->jobs.erase(entry);
+					break;
+				}
+			}
+		}
+		job.WaitForRunners();
+		if (job.error) {
+			std::rethrow_exception(job.error);
+		}
+		return;
+	}
+#endif
+	for (idx_t task_idx = 0; task_idx < count; task_idx++) {
+		task(task_idx);
+	}
+}
+
+} // namespace duckdb
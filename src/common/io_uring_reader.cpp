@@ -0,0 +1,291 @@
+#include "duckdb/common/io_uring_reader.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/thread.hpp"
+
+#if defined(__linux__) && !defined(DUCKDB_DISABLE_IO_URING) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+// linux/io_uring.h includes linux/fs.h, whose BLOCK_SIZE macro would clash with Storage::BLOCK_SIZE in any file that
+// follows this one in a unity build: keep the macro local to the include
+#pragma push_macro("BLOCK_SIZE")
+#include <linux/io_uring.h>
+#pragma pop_macro("BLOCK_SIZE")
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_IO_URING_AVAILABLE
+#endif
+#endif
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_IO_URING_AVAILABLE
+//! Whether or not setting up a ring failed: this happens on kernels without io_uring, or when it is disabled (e.g. by
+//! a seccomp profile), in which case we do not try again
+static atomic<bool> io_uring_unavailable {false};
+
+class IOUring {
+public:
+	//! The number of reads that can be in flight at once
+	static constexpr const unsigned RING_ENTRIES = 64;
+
+	IOUring() {
+		struct io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring_fd = (int)syscall(__NR_io_uring_setup, RING_ENTRIES, &params);
+		if (ring_fd < 0) {
+			return;
+		}
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_ring_size = cq_ring_size = MaxValue<size_t>(sq_ring_size, cq_ring_size);
+		}
+		sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		               IORING_OFF_SQ_RING);
+		if (sq_ring == MAP_FAILED) {
+			sq_ring = nullptr;
+			Close();
+			return;
+		}
+		if (single_mmap) {
+			cq_ring = sq_ring;
+		} else {
+			cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+			               IORING_OFF_CQ_RING);
+			if (cq_ring == MAP_FAILED) {
+				cq_ring = nullptr;
+				Close();
+				return;
+			}
+		}
+		sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+		auto sqes_map = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd,
+		                     IORING_OFF_SQES);
+		if (sqes_map == MAP_FAILED) {
+			Close();
+			return;
+		}
+		sqes = (struct io_uring_sqe *)sqes_map;
+
+		auto sq_base = (char *)sq_ring;
+		sq_head = (unsigned *)(sq_base + params.sq_off.head);
+		sq_tail = (unsigned *)(sq_base + params.sq_off.tail);
+		sq_mask = *(unsigned *)(sq_base + params.sq_off.ring_mask);
+		sq_array = (unsigned *)(sq_base + params.sq_off.array);
+		sq_entries = params.sq_entries;
+		auto cq_base = (char *)cq_ring;
+		cq_head = (unsigned *)(cq_base + params.cq_off.head);
+		cq_tail = (unsigned *)(cq_base + params.cq_off.tail);
+		cq_mask = *(unsigned *)(cq_base + params.cq_off.ring_mask);
+		cqes = (struct io_uring_cqe *)(cq_base + params.cq_off.cqes);
+		initialized = true;
+	}
+	~IOUring() {
+		Close();
+	}
+
+	bool IsInitialized() const {
+		return initialized;
+	}
+
+	void Read(int fd, const string &path, FileReadRequest requests[], idx_t count) {
+		vector<struct iovec> iovecs(MinValue<idx_t>(count, sq_entries));
+		for (idx_t batch_start = 0; batch_start < count; batch_start += sq_entries) {
+			auto batch_count = MinValue<idx_t>(count - batch_start, sq_entries);
+			ReadBatch(fd, path, requests + batch_start, batch_count, iovecs.data());
+		}
+	}
+
+private:
+	void ReadBatch(int fd, const string &path, FileReadRequest requests[], idx_t count, struct iovec iovecs[]) {
+		// fill the submission queue
+		auto tail = *sq_tail;
+		for (idx_t i = 0; i < count; i++) {
+			iovecs[i].iov_base = requests[i].buffer;
+			iovecs[i].iov_len = requests[i].nr_bytes;
+
+			auto index = tail & sq_mask;
+			auto &sqe = sqes[index];
+			memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READV;
+			sqe.fd = fd;
+			sqe.off = requests[i].location;
+			sqe.addr = (uint64_t)(uintptr_t)&iovecs[i];
+			sqe.len = 1;
+			sqe.user_data = i;
+			sq_array[index] = index;
+			tail++;
+		}
+		__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+		// submit the reads, and wait for all of them to complete
+		// errors are only thrown after that: the kernel may still write to the buffers of reads that are in flight
+		idx_t submitted = 0;
+		idx_t completed = 0;
+		bool submit_failed = false;
+		string error;
+		while (completed < submitted || (submitted < count && !submit_failed)) {
+			auto to_submit = submit_failed ? 0 : (unsigned)(count - submitted);
+			auto result = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (result < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				if (!submit_failed) {
+					// stop submitting, but wait for the reads that are already in flight
+					submit_failed = true;
+					if (error.empty()) {
+						error = StringUtil::Format("Could not read from file \"%s\": io_uring_enter failed: %s", path,
+						                           strerror(errno));
+					}
+					continue;
+				}
+				// waiting for the completions failed as well: poll the completion queue instead
+				completed += ReapCompletions(fd, path, requests, error);
+				std::this_thread::yield();
+				continue;
+			}
+			submitted += MinValue<idx_t>(result, to_submit);
+			completed += ReapCompletions(fd, path, requests, error);
+		}
+		if (submitted < count) {
+			// the kernel has not consumed the remaining entries: take them back out of the submission queue, so that
+			// they are not submitted along with the next batch
+			__atomic_store_n(sq_tail, __atomic_load_n(sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+		}
+		if (!error.empty()) {
+			throw IOException(error);
+		}
+	}
+
+	idx_t ReapCompletions(int fd, const string &path, FileReadRequest requests[], string &error) {
+		idx_t completed = 0;
+		auto head = *cq_head;
+		while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+			auto &cqe = cqes[head & cq_mask];
+			auto &request = requests[cqe.user_data];
+			auto result = cqe.res;
+			head++;
+			__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			completed++;
+			if (!error.empty()) {
+				continue;
+			}
+			if (result < 0) {
+				error = StringUtil::Format("Could not read from file \"%s\": %s", path, strerror(-result));
+			} else if (result < request.nr_bytes) {
+				// a short read: read the remainder synchronously
+				error = ReadRemainder(fd, path, request, result);
+			}
+		}
+		return completed;
+	}
+
+	static string ReadRemainder(int fd, const string &path, FileReadRequest &request, int64_t bytes_read) {
+		while (bytes_read < request.nr_bytes) {
+			auto result = pread(fd, (char *)request.buffer + bytes_read, request.nr_bytes - bytes_read,
+			                    request.location + bytes_read);
+			if (result == -1) {
+				return StringUtil::Format("Could not read from file \"%s\": %s", path, strerror(errno));
+			}
+			if (result == 0) {
+				return StringUtil::Format("Could not read all bytes from file \"%s\": wanted=%lld read=%lld", path,
+				                          request.nr_bytes, bytes_read);
+			}
+			bytes_read += result;
+		}
+		return string();
+	}
+
+	void Close() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+			sqes = nullptr;
+		}
+		if (cq_ring && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		cq_ring = nullptr;
+		if (sq_ring) {
+			munmap(sq_ring, sq_ring_size);
+			sq_ring = nullptr;
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+			ring_fd = -1;
+		}
+		initialized = false;
+	}
+
+private:
+	bool initialized = false;
+	int ring_fd = -1;
+	bool single_mmap = false;
+	void *sq_ring = nullptr;
+	size_t sq_ring_size = 0;
+	void *cq_ring = nullptr;
+	size_t cq_ring_size = 0;
+	struct io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+
+	unsigned *sq_head = nullptr;
+	unsigned *sq_tail = nullptr;
+	unsigned sq_mask = 0;
+	unsigned *sq_array = nullptr;
+	idx_t sq_entries = 0;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned cq_mask = 0;
+	struct io_uring_cqe *cqes = nullptr;
+};
+
+static IOUring *GetThreadRing() {
+	if (io_uring_unavailable) {
+		return nullptr;
+	}
+	static thread_local unique_ptr<IOUring> ring;
+	if (!ring) {
+		ring = make_unique<IOUring>();
+		if (!ring->IsInitialized()) {
+			io_uring_unavailable = true;
+			ring.reset();
+			return nullptr;
+		}
+	}
+	return ring.get();
+}
+
+bool IOUringReader::IsAvailable() {
+	return GetThreadRing() != nullptr;
+}
+
+bool IOUringReader::Read(int fd, const string &path, FileReadRequest requests[], idx_t count) {
+	auto ring = GetThreadRing();
+	if (!ring) {
+		return false;
+	}
+	ring->Read(fd, path, requests, count);
+	return true;
+}
+#else
+bool IOUringReader::IsAvailable() {
+	return false;
+}
+
+bool IOUringReader::Read(int fd, const string &path, FileReadRequest requests[], idx_t count) {
+	return false;
+}
+#endif
+
+} // namespace duckdb
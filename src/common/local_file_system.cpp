@@ -4,6 +4,8 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/io_thread_pool.hpp"
+#include "duckdb/common/io_uring_reader.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
@@ -797,6 +799,23 @@ FileType LocalFileSystem::GetFileType(FileHandle &handle) {
 }
 #endif
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) {
+	if (count <= 1) {
+		FileSystem::ReadBatch(handle, requests, count);
+		return;
+	}
+#ifndef _WIN32
+	if (IOUringReader::Read(((UnixFileHandle &)handle).fd, handle.path, requests, count)) {
+		return;
+	}
+#endif
+	// io_uring is not available: issue the reads from the threads of the I/O pool instead
+	IOThreadPool::Get().Run(count, IOThreadPool::MAX_THREADS, [&](idx_t request_idx) {
+		auto &request = requests[request_idx];
+		Read(handle, request.buffer, request.nr_bytes, request.location);
+	});
+}
+
 bool LocalFileSystem::CanSeek() {
 	return true;
 }
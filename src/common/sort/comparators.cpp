@@ -23,13 +23,17 @@ bool Comparators::TieIsBreakable(const idx_t &tie_col, const data_ptr_t &row_ptr
 	}
 	const auto &tie_col_offset = row_layout.GetOffsets()[col_idx];
 	auto tie_string = Load<string_t>(row_ptr + tie_col_offset);
-	if (tie_string.GetSize() < sort_layout.prefix_lengths[tie_col]) {
+	if (tie_string.GetSize() < TiedLength(tie_col, sort_layout)) {
 		// No need to break the tie - we already compared the full string
 		return false;
 	}
 	return true;
 }
 
+idx_t Comparators::TiedLength(const idx_t &tie_col, const SortLayout &sort_layout) {
+	return sort_layout.common_prefix_lengths[tie_col] + sort_layout.prefix_lengths[tie_col];
+}
+
 int Comparators::CompareTuple(const SBScanState &left, const SBScanState &right, const data_ptr_t &l_ptr,
                               const data_ptr_t &r_ptr, const SortLayout &sort_layout, const bool &external_sort) {
 	// Compare the sorting columns one by one
@@ -65,6 +69,27 @@ int Comparators::CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, cons
 	}
 }
 
+int Comparators::CompareTiedVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+                                const idx_t &tied_len) {
+	if (type.InternalType() == PhysicalType::VARCHAR) {
+		return CompareTiedString(Load<string_t>(l_ptr), Load<string_t>(r_ptr), tied_len);
+	}
+	return CompareVal(l_ptr, r_ptr, type);
+}
+
+int Comparators::CompareTiedString(const string_t &left, const string_t &right, idx_t tied_len) {
+	const auto l_size = left.GetSize();
+	const auto r_size = right.GetSize();
+	const auto min_size = MinValue(l_size, r_size);
+	// The prefix pads short strings with zero bytes, so we can only skip the bytes that both strings have
+	tied_len = MinValue(tied_len, min_size);
+	auto comp_res = memcmp(left.GetDataUnsafe() + tied_len, right.GetDataUnsafe() + tied_len, min_size - tied_len);
+	if (comp_res != 0) {
+		return comp_res < 0 ? -1 : 1;
+	}
+	return l_size == r_size ? 0 : (l_size < r_size ? -1 : 1);
+}
+
 int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, const SBScanState &right,
                               const SortLayout &sort_layout, const bool &external) {
 	data_ptr_t l_data_ptr = left.DataPtr(*left.sb->blob_sorting_data);
@@ -81,6 +106,7 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 	// Do the comparison
 	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
 	const auto &type = sort_layout.blob_layout.GetTypes()[col_idx];
+	const auto tied_len = TiedLength(tie_col, sort_layout);
 	int result;
 	if (external) {
 		// Store heap pointers
@@ -90,12 +116,12 @@ int Comparators::BreakBlobTie(const idx_t &tie_col, const SBScanState &left, con
 		UnswizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		UnswizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 		// Compare
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareTiedVal(l_data_ptr, r_data_ptr, type, tied_len);
 		// Swizzle the pointers back to offsets
 		SwizzleSingleValue(l_data_ptr, l_heap_ptr, type);
 		SwizzleSingleValue(r_data_ptr, r_heap_ptr, type);
 	} else {
-		result = CompareVal(l_data_ptr, r_data_ptr, type);
+		result = CompareTiedVal(l_data_ptr, r_data_ptr, type, tied_len);
 	}
 	return order * result;
 }
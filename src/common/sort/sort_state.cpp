@@ -38,6 +38,17 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! The number of leading bytes that all strings between the (truncated) min and max of the statistics share
+static idx_t GetCommonStringPrefixLength(const StringStatistics &str_stats) {
+	idx_t common_len = 0;
+	// The min and max are padded with zero bytes, so the prefix stops at the first zero byte
+	while (common_len < StringStatistics::MAX_STRING_MINMAX_SIZE && str_stats.min[common_len] != '\0' &&
+	       str_stats.min[common_len] == str_stats.max[common_len]) {
+		common_len++;
+	}
+	return MinValue<idx_t>(common_len, str_stats.max_string_length);
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -62,20 +73,23 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 
 		idx_t col_size = has_null.back() ? 1 : 0;
 		prefix_lengths.push_back(0);
+		common_prefix_lengths.push_back(0);
 		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
 			if (stats.back()) {
+				// Leave out the bytes that all strings share, and normalize the full strings if the rest is short
 				auto &str_stats = (StringStatistics &)*stats.back();
-				col_size += str_stats.max_string_length;
-				if (col_size > 12) {
-					col_size = 12;
+				common_prefix_lengths.back() = GetCommonStringPrefixLength(str_stats);
+				col_size += str_stats.max_string_length - common_prefix_lengths.back();
+				if (col_size > SortConstants::MAX_NORMALIZED_STRING_KEY_SIZE) {
+					col_size = SortConstants::STRING_KEY_SIZE;
 				} else {
 					constant_size.back() = true;
 				}
 			} else {
-				col_size = 12;
+				col_size = SortConstants::STRING_KEY_SIZE;
 			}
 			prefix_lengths.back() = col_size - size_before;
 		} else {
@@ -97,7 +111,7 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			}
 			if (logical_types[col_idx].InternalType() == PhysicalType::VARCHAR && stats[col_idx]) {
 				auto &str_stats = (StringStatistics &)*stats[col_idx];
-				idx_t diff = str_stats.max_string_length - prefix_lengths[col_idx];
+				idx_t diff = str_stats.max_string_length - common_prefix_lengths[col_idx] - prefix_lengths[col_idx];
 				if (diff > 0) {
 					// Increase all sizes accordingly
 					idx_t increase = MinValue(bytes_to_fill, diff);
@@ -141,6 +155,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 		result.column_sizes.push_back(column_sizes[col_idx]);
 
 		result.prefix_lengths.push_back(prefix_lengths[col_idx]);
+		result.common_prefix_lengths.push_back(common_prefix_lengths[col_idx]);
 		result.stats.push_back(stats[col_idx]);
 		result.has_null.push_back(has_null[col_idx]);
 	}
@@ -190,7 +205,8 @@ void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 		bool desc = sort_layout->order_types[sort_col] == OrderType::DESCENDING;
 		RowOperations::RadixScatter(sort.data[sort_col], sort.size(), sel_ptr, sort.size(), data_pointers, desc,
 		                            has_null, nulls_first, sort_layout->prefix_lengths[sort_col],
-		                            sort_layout->column_sizes[sort_col]);
+		                            sort_layout->column_sizes[sort_col], 0,
+		                            sort_layout->common_prefix_lengths[sort_col]);
 	}
 
 	// Also fully serialize blob sorting columns (to be able to break ties
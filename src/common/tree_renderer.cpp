@@ -503,6 +503,13 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNod
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+	if (op.info.has_counters) {
+		result->extra_text += "\n[INFOSEPARATOR]";
+		for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+			result->extra_text +=
+			    "\n" + string(HardwareCounterValues::GetName(i)) + ": " + to_string(op.info.counters.values[i]);
+		}
+	}
 	if (config.detailed) {
 		for (auto &info : op.info.executors_info) {
 			if (!info) {
@@ -144,8 +144,9 @@ void RowDataCollectionScanner::ScanState::PinData() {
 
 RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
                                                    const RowLayout &layout_p, bool external_p, bool flush_p)
-    : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), total_count(rows.count), total_scanned(0),
-      external(external_p), flush(flush_p), unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
+    : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), begin_block(0), end_block(rows.blocks.size()),
+      begin_entry(0), total_count(rows.count), total_scanned(0), external(external_p), flush(flush_p),
+      unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
 
 	if (unswizzling) {
 		D_ASSERT(rows.blocks.size() == heap.blocks.size());
@@ -154,6 +155,26 @@ RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, Ro
 	ValidateUnscannedBlock();
 }
 
+RowDataCollectionScanner::RowDataCollectionScanner(RowDataCollection &rows_p, RowDataCollection &heap_p,
+                                                   const RowLayout &layout_p, bool external_p, idx_t block_idx,
+                                                   idx_t entry_idx, idx_t count, bool flush_p)
+    : rows(rows_p), heap(heap_p), layout(layout_p), read_state(*this), begin_block(block_idx),
+      end_block(block_idx + 1), begin_entry(entry_idx), total_count(count), total_scanned(0), external(external_p),
+      flush(flush_p), unswizzling(!layout.AllConstant() && external && !heap.keep_pinned) {
+
+	if (unswizzling) {
+		D_ASSERT(rows.blocks.size() == heap.blocks.size());
+	}
+
+	// Flushing and (re)swizzling affect the whole block, so other threads can only scan other parts of it without them
+	D_ASSERT(entry_idx + count <= rows.blocks[block_idx]->count);
+	D_ASSERT((entry_idx == 0 && count == rows.blocks[block_idx]->count) || (!flush && !unswizzling));
+
+	read_state.block_idx = begin_block;
+	read_state.entry_idx = begin_entry;
+	ValidateUnscannedBlock();
+}
+
 void RowDataCollectionScanner::SwizzleBlock(RowDataBlock &data_block, RowDataBlock &heap_block) {
 	// Pin the data block and swizzle the pointers within the rows
 	D_ASSERT(!data_block.block->IsSwizzled());
@@ -189,7 +210,7 @@ void RowDataCollectionScanner::ReSwizzle() {
 }
 
 void RowDataCollectionScanner::ValidateUnscannedBlock() const {
-	if (unswizzling && read_state.block_idx < rows.blocks.size()) {
+	if (unswizzling && read_state.block_idx < end_block) {
 		D_ASSERT(rows.blocks[read_state.block_idx]->block->IsSwizzled());
 	}
 }
@@ -254,7 +275,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 
 	if (flush) {
 		// Release blocks we have passed.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = begin_block; i < read_state.block_idx; ++i) {
 			rows.blocks[i]->block = nullptr;
 			if (unswizzling) {
 				heap.blocks[i]->block = nullptr;
@@ -262,7 +283,7 @@ void RowDataCollectionScanner::Scan(DataChunk &chunk) {
 		}
 	} else if (unswizzling) {
 		// Reswizzle blocks we have passed so they can be flushed safely.
-		for (idx_t i = 0; i < read_state.block_idx; ++i) {
+		for (idx_t i = begin_block; i < read_state.block_idx; ++i) {
 			auto &data_block = rows.blocks[i];
 			if (data_block->block && !data_block->block->IsSwizzled()) {
 				SwizzleBlock(*data_block, *heap.blocks[i]);
@@ -275,8 +296,8 @@ void RowDataCollectionScanner::Reset(bool flush_p) {
 	flush = flush_p;
 	total_scanned = 0;
 
-	read_state.block_idx = 0;
-	read_state.entry_idx = 0;
+	read_state.block_idx = begin_block;
+	read_state.entry_idx = begin_entry;
 }
 
 } // namespace duckdb
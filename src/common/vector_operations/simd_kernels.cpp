@@ -0,0 +1,507 @@
+//===--------------------------------------------------------------------===//
+// simd_kernels.cpp
+// Description: This file contains hand-written AVX2/AVX-512 kernels for hot
+// fixed-width vector operations, dispatched at runtime
+//===--------------------------------------------------------------------===//
+
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(DUCKDB_DISABLE_SIMD_KERNELS)
+#define DUCKDB_X86_SIMD_KERNELS
+#include <immintrin.h>
+#define DUCKDB_TARGET_AVX2   __attribute__((target("avx2")))
+#define DUCKDB_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512dq,avx512vl")))
+#endif
+
+namespace duckdb {
+
+constexpr const idx_t SIMDKernels::CHARACTER_BLOCK_SIZE;
+
+static SIMDInstructionSet DetectInstructionSet() {
+#ifdef DUCKDB_X86_SIMD_KERNELS
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+	    __builtin_cpu_supports("avx512vl")) {
+		return SIMDInstructionSet::AVX512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return SIMDInstructionSet::AVX2;
+	}
+#endif
+	return SIMDInstructionSet::NONE;
+}
+
+SIMDInstructionSet SIMDKernels::GetSupportedInstructionSet() {
+	static const SIMDInstructionSet instruction_set = DetectInstructionSet();
+	return instruction_set;
+}
+
+static atomic<SIMDInstructionSet> &ActiveInstructionSet() {
+	static atomic<SIMDInstructionSet> instruction_set(SIMDKernels::GetSupportedInstructionSet());
+	return instruction_set;
+}
+
+SIMDInstructionSet SIMDKernels::GetInstructionSet() {
+	return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+void SIMDKernels::SetInstructionSet(SIMDInstructionSet instruction_set) {
+	// every instruction set includes the ones below it
+	if (uint8_t(instruction_set) > uint8_t(GetSupportedInstructionSet())) {
+		throw InvalidInputException("SIMD instruction set %d is not supported by this machine", int(instruction_set));
+	}
+	ActiveInstructionSet().store(instruction_set);
+}
+
+#ifdef DUCKDB_X86_SIMD_KERNELS
+//===--------------------------------------------------------------------===//
+// Scalar tails
+//===--------------------------------------------------------------------===//
+template <ExpressionType COMPARISON, class T>
+static inline bool CompareScalar(T left, T right) {
+	switch (COMPARISON) {
+	case ExpressionType::COMPARE_EQUAL:
+		return left == right;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return left != right;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return left < right;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return left <= right;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return left > right;
+	default:
+		D_ASSERT(COMPARISON == ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+		return left >= right;
+	}
+}
+
+template <ExpressionType COMPARISON, class T>
+static inline void SelectConstantScalar(const T *data, T constant, idx_t start, idx_t count, sel_t *true_sel,
+                                        sel_t *false_sel, idx_t &true_count, idx_t &false_count) {
+	for (idx_t i = start; i < count; i++) {
+		bool match = CompareScalar<COMPARISON, T>(data[i], constant);
+		if (true_sel) {
+			true_sel[true_count] = i;
+		}
+		if (false_sel) {
+			false_sel[false_count] = i;
+		}
+		true_count += match;
+		false_count += !match;
+	}
+}
+
+template <class T>
+static inline void HashScalar(const T *data, hash_t *result, idx_t start, idx_t count) {
+	for (idx_t i = start; i < count; i++) {
+		result[i] = duckdb::Hash<T>(data[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// AVX2
+//===--------------------------------------------------------------------===//
+//! For every 8-bit comparison mask, the positions of its set bits (packed to the front)
+struct SelectionLookupTable {
+	SelectionLookupTable() {
+		for (idx_t mask = 0; mask < 256; mask++) {
+			idx_t count = 0;
+			for (idx_t bit = 0; bit < 8; bit++) {
+				if (mask & (idx_t(1) << bit)) {
+					positions[mask][count++] = bit;
+				}
+			}
+			for (; count < 8; count++) {
+				positions[mask][count] = 0;
+			}
+		}
+	}
+
+	sel_t positions[256][8];
+};
+
+static const SelectionLookupTable &GetSelectionLookupTable() {
+	static const SelectionLookupTable table;
+	return table;
+}
+
+template <ExpressionType COMPARISON>
+DUCKDB_TARGET_AVX2 static inline uint32_t CompareMaskAVX2(__m256i left, __m256i right, int32_t) {
+	switch (COMPARISON) {
+	case ExpressionType::COMPARE_EQUAL:
+		return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(left, right)));
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(left, right))) & 0xFF;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(right, left)));
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(left, right))) & 0xFF;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(left, right)));
+	default:
+		D_ASSERT(COMPARISON == ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+		return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(right, left))) & 0xFF;
+	}
+}
+
+template <ExpressionType COMPARISON>
+DUCKDB_TARGET_AVX2 static inline uint32_t CompareMaskAVX2(__m256i left, __m256i right, int64_t) {
+	switch (COMPARISON) {
+	case ExpressionType::COMPARE_EQUAL:
+		return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(left, right)));
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(left, right))) & 0xF;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(right, left)));
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(left, right))) & 0xF;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(left, right)));
+	default:
+		D_ASSERT(COMPARISON == ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+		return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(right, left))) & 0xF;
+	}
+}
+
+DUCKDB_TARGET_AVX2 static inline __m256i BroadcastAVX2(int32_t value) {
+	return _mm256_set1_epi32(value);
+}
+
+DUCKDB_TARGET_AVX2 static inline __m256i BroadcastAVX2(int64_t value) {
+	return _mm256_set1_epi64x(value);
+}
+
+// every lane of the comparison mask produces one entry in the selection vector. Storing all positions of a register is
+// safe: the selection vectors hold at least "count" entries, and we never wrote more entries than rows we processed
+DUCKDB_TARGET_AVX2 static inline void StorePositionsAVX2(sel_t *target, const sel_t *positions, idx_t base,
+                                                         int32_t) {
+	auto result = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)positions), _mm256_set1_epi32((int32_t)base));
+	_mm256_storeu_si256((__m256i *)target, result);
+}
+
+DUCKDB_TARGET_AVX2 static inline void StorePositionsAVX2(sel_t *target, const sel_t *positions, idx_t base,
+                                                         int64_t) {
+	auto result = _mm_add_epi32(_mm_loadu_si128((const __m128i *)positions), _mm_set1_epi32((int32_t)base));
+	_mm_storeu_si128((__m128i *)target, result);
+}
+
+template <ExpressionType COMPARISON, class T>
+DUCKDB_TARGET_AVX2 static void SelectConstantAVX2(const T *data, T constant, idx_t count, sel_t *true_sel,
+                                                  sel_t *false_sel, idx_t &true_count, idx_t &false_count) {
+	static constexpr idx_t LANES = sizeof(__m256i) / sizeof(T);
+	static constexpr uint32_t ALL_LANES = (1 << LANES) - 1;
+	auto &lookup = GetSelectionLookupTable();
+	const auto constant_vector = BroadcastAVX2(constant);
+
+	idx_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		auto values = _mm256_loadu_si256((const __m256i *)(data + i));
+		auto mask = CompareMaskAVX2<COMPARISON>(values, constant_vector, T());
+		if (true_sel) {
+			StorePositionsAVX2(true_sel + true_count, lookup.positions[mask], i, T());
+		}
+		if (false_sel) {
+			StorePositionsAVX2(false_sel + false_count, lookup.positions[mask ^ ALL_LANES], i, T());
+		}
+		auto match_count = __builtin_popcount(mask);
+		true_count += match_count;
+		false_count += LANES - match_count;
+	}
+	SelectConstantScalar<COMPARISON, T>(data, constant, i, count, true_sel, false_sel, true_count, false_count);
+}
+
+//! 64-bit multiplication (modulo 2^64) of every lane, AVX2 only has 32x32->64 bit multiplications
+DUCKDB_TARGET_AVX2 static inline __m256i MultiplyAVX2(__m256i left, __m256i right) {
+	auto low = _mm256_mul_epu32(left, right);
+	auto cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(left, 32), right),
+	                              _mm256_mul_epu32(left, _mm256_srli_epi64(right, 32)));
+	return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+//! Vectorized murmurhash64 (see duckdb/common/types/hash.hpp)
+DUCKDB_TARGET_AVX2 static inline __m256i MurmurHash64AVX2(__m256i x) {
+	const auto multiplier = _mm256_set1_epi64x(0xd6e8feb86659fd93ULL);
+	x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+	x = MultiplyAVX2(x, multiplier);
+	x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+	x = MultiplyAVX2(x, multiplier);
+	return _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+}
+
+DUCKDB_TARGET_AVX2 static void HashAVX2(const int32_t *data, hash_t *result, idx_t count) {
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		// Hash<int32_t> hashes the zero-extended unsigned value
+		auto values = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i *)(data + i)));
+		_mm256_storeu_si256((__m256i *)(result + i), MurmurHash64AVX2(values));
+	}
+	HashScalar<int32_t>(data, result, i, count);
+}
+
+DUCKDB_TARGET_AVX2 static void HashAVX2(const int64_t *data, hash_t *result, idx_t count) {
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		auto values = _mm256_loadu_si256((const __m256i *)(data + i));
+		_mm256_storeu_si256((__m256i *)(result + i), MurmurHash64AVX2(values));
+	}
+	HashScalar<int64_t>(data, result, i, count);
+}
+
+DUCKDB_TARGET_AVX2 static void MatchCharactersAVX2(const char *data, const char *characters, idx_t group_count,
+                                                   uint64_t *masks) {
+	auto low = _mm256_loadu_si256((const __m256i *)data);
+	auto high = _mm256_loadu_si256((const __m256i *)(data + 32));
+	for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+		auto low_match = _mm256_setzero_si256();
+		auto high_match = _mm256_setzero_si256();
+		for (idx_t char_idx = 0; char_idx < 4; char_idx++) {
+			auto character = _mm256_set1_epi8(characters[group_idx * 4 + char_idx]);
+			low_match = _mm256_or_si256(low_match, _mm256_cmpeq_epi8(low, character));
+			high_match = _mm256_or_si256(high_match, _mm256_cmpeq_epi8(high, character));
+		}
+		masks[group_idx] = uint64_t(uint32_t(_mm256_movemask_epi8(low_match))) |
+		                   (uint64_t(uint32_t(_mm256_movemask_epi8(high_match))) << 32);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// AVX-512
+//===--------------------------------------------------------------------===//
+template <ExpressionType COMPARISON>
+struct AVX512Predicate {};
+
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_EQUAL> {
+	static constexpr const int VALUE = _MM_CMPINT_EQ;
+};
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_NOTEQUAL> {
+	static constexpr const int VALUE = _MM_CMPINT_NE;
+};
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_LESSTHAN> {
+	static constexpr const int VALUE = _MM_CMPINT_LT;
+};
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_LESSTHANOREQUALTO> {
+	static constexpr const int VALUE = _MM_CMPINT_LE;
+};
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_GREATERTHAN> {
+	static constexpr const int VALUE = _MM_CMPINT_NLE;
+};
+template <>
+struct AVX512Predicate<ExpressionType::COMPARE_GREATERTHANOREQUALTO> {
+	static constexpr const int VALUE = _MM_CMPINT_NLT;
+};
+
+// the compress stores only write the selected positions, so no over-allocation of the selection vectors is needed
+template <ExpressionType COMPARISON>
+DUCKDB_TARGET_AVX512 static void SelectConstantAVX512(const int32_t *data, int32_t constant, idx_t count,
+                                                      sel_t *true_sel, sel_t *false_sel, idx_t &true_count,
+                                                      idx_t &false_count) {
+	const auto constant_vector = _mm512_set1_epi32(constant);
+	const auto step = _mm512_set1_epi32(16);
+	auto positions = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+	idx_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		auto values = _mm512_loadu_si512((const void *)(data + i));
+		__mmask16 mask = _mm512_cmp_epi32_mask(values, constant_vector, AVX512Predicate<COMPARISON>::VALUE);
+		if (true_sel) {
+			_mm512_mask_compressstoreu_epi32(true_sel + true_count, mask, positions);
+		}
+		if (false_sel) {
+			_mm512_mask_compressstoreu_epi32(false_sel + false_count, (__mmask16)~mask, positions);
+		}
+		auto match_count = __builtin_popcount(mask);
+		true_count += match_count;
+		false_count += 16 - match_count;
+		positions = _mm512_add_epi32(positions, step);
+	}
+	SelectConstantScalar<COMPARISON, int32_t>(data, constant, i, count, true_sel, false_sel, true_count,
+	                                          false_count);
+}
+
+template <ExpressionType COMPARISON>
+DUCKDB_TARGET_AVX512 static void SelectConstantAVX512(const int64_t *data, int64_t constant, idx_t count,
+                                                      sel_t *true_sel, sel_t *false_sel, idx_t &true_count,
+                                                      idx_t &false_count) {
+	const auto constant_vector = _mm512_set1_epi64(constant);
+	const auto step = _mm256_set1_epi32(8);
+	auto positions = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto values = _mm512_loadu_si512((const void *)(data + i));
+		__mmask8 mask = _mm512_cmp_epi64_mask(values, constant_vector, AVX512Predicate<COMPARISON>::VALUE);
+		if (true_sel) {
+			_mm256_mask_compressstoreu_epi32(true_sel + true_count, mask, positions);
+		}
+		if (false_sel) {
+			_mm256_mask_compressstoreu_epi32(false_sel + false_count, (__mmask8)~mask, positions);
+		}
+		auto match_count = __builtin_popcount(mask);
+		true_count += match_count;
+		false_count += 8 - match_count;
+		positions = _mm256_add_epi32(positions, step);
+	}
+	SelectConstantScalar<COMPARISON, int64_t>(data, constant, i, count, true_sel, false_sel, true_count,
+	                                          false_count);
+}
+
+DUCKDB_TARGET_AVX512 static inline __m512i MurmurHash64AVX512(__m512i x) {
+	const auto multiplier = _mm512_set1_epi64(0xd6e8feb86659fd93ULL);
+	x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+	x = _mm512_mullo_epi64(x, multiplier);
+	x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+	x = _mm512_mullo_epi64(x, multiplier);
+	return _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+}
+
+DUCKDB_TARGET_AVX512 static void HashAVX512(const int32_t *data, hash_t *result, idx_t count) {
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto values = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i *)(data + i)));
+		_mm512_storeu_si512((void *)(result + i), MurmurHash64AVX512(values));
+	}
+	HashScalar<int32_t>(data, result, i, count);
+}
+
+DUCKDB_TARGET_AVX512 static void HashAVX512(const int64_t *data, hash_t *result, idx_t count) {
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto values = _mm512_loadu_si512((const void *)(data + i));
+		_mm512_storeu_si512((void *)(result + i), MurmurHash64AVX512(values));
+	}
+	HashScalar<int64_t>(data, result, i, count);
+}
+
+//===--------------------------------------------------------------------===//
+// Dispatch
+//===--------------------------------------------------------------------===//
+template <ExpressionType COMPARISON, class T>
+static void SelectConstantDispatch(SIMDInstructionSet instruction_set, const T *data, T constant, idx_t count,
+                                   sel_t *true_sel, sel_t *false_sel, idx_t &true_count, idx_t &false_count) {
+	if (instruction_set == SIMDInstructionSet::AVX512) {
+		SelectConstantAVX512<COMPARISON>(data, constant, count, true_sel, false_sel, true_count, false_count);
+	} else {
+		SelectConstantAVX2<COMPARISON, T>(data, constant, count, true_sel, false_sel, true_count, false_count);
+	}
+}
+
+template <class T>
+static bool TemplatedSelectConstant(const T *data, T constant, ExpressionType comparison_type, idx_t count,
+                                    SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count) {
+	auto instruction_set = SIMDKernels::GetInstructionSet();
+	if (instruction_set == SIMDInstructionSet::NONE) {
+		return false;
+	}
+	D_ASSERT(true_sel || false_sel);
+	auto true_data = true_sel ? true_sel->data() : nullptr;
+	auto false_data = false_sel ? false_sel->data() : nullptr;
+	if ((true_sel && !true_data) || (false_sel && !false_data)) {
+		// we can only write into selection vectors that own their data
+		return false;
+	}
+
+	true_count = 0;
+	idx_t false_count = 0;
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		SelectConstantDispatch<ExpressionType::COMPARE_EQUAL, T>(instruction_set, data, constant, count, true_data,
+		                                                         false_data, true_count, false_count);
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		SelectConstantDispatch<ExpressionType::COMPARE_NOTEQUAL, T>(instruction_set, data, constant, count,
+		                                                            true_data, false_data, true_count, false_count);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		SelectConstantDispatch<ExpressionType::COMPARE_LESSTHAN, T>(instruction_set, data, constant, count,
+		                                                            true_data, false_data, true_count, false_count);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		SelectConstantDispatch<ExpressionType::COMPARE_LESSTHANOREQUALTO, T>(
+		    instruction_set, data, constant, count, true_data, false_data, true_count, false_count);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		SelectConstantDispatch<ExpressionType::COMPARE_GREATERTHAN, T>(instruction_set, data, constant, count,
+		                                                               true_data, false_data, true_count, false_count);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		SelectConstantDispatch<ExpressionType::COMPARE_GREATERTHANOREQUALTO, T>(
+		    instruction_set, data, constant, count, true_data, false_data, true_count, false_count);
+		break;
+	default:
+		return false;
+	}
+	D_ASSERT(true_count + false_count == count);
+	return true;
+}
+
+template <class T>
+static bool TemplatedHash(const T *data, hash_t *result, idx_t count) {
+	switch (SIMDKernels::GetInstructionSet()) {
+	case SIMDInstructionSet::AVX512:
+		HashAVX512(data, result, count);
+		return true;
+	case SIMDInstructionSet::AVX2:
+		HashAVX2(data, result, count);
+		return true;
+	default:
+		return false;
+	}
+}
+#else
+template <class T>
+static bool TemplatedSelectConstant(const T *data, T constant, ExpressionType comparison_type, idx_t count,
+                                    SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count) {
+	return false;
+}
+
+template <class T>
+static bool TemplatedHash(const T *data, hash_t *result, idx_t count) {
+	return false;
+}
+#endif
+
+bool SIMDKernels::MatchCharacters(const char *data, const char *characters, idx_t group_count, uint64_t *masks) {
+	static_assert(CHARACTER_BLOCK_SIZE == 64, "the character masks are 64 bits");
+#ifdef DUCKDB_X86_SIMD_KERNELS
+	// byte comparisons into a mask require AVX-512BW: machines with AVX-512 use the AVX2 kernel here
+	if (GetInstructionSet() != SIMDInstructionSet::NONE) {
+		MatchCharactersAVX2(data, characters, group_count, masks);
+		return true;
+	}
+#endif
+	return false;
+}
+
+template <>
+bool SIMDKernels::SelectConstant(const int32_t *data, int32_t constant, ExpressionType comparison_type, idx_t count,
+                                 SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count) {
+	return TemplatedSelectConstant<int32_t>(data, constant, comparison_type, count, true_sel, false_sel, true_count);
+}
+
+template <>
+bool SIMDKernels::SelectConstant(const int64_t *data, int64_t constant, ExpressionType comparison_type, idx_t count,
+                                 SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count) {
+	return TemplatedSelectConstant<int64_t>(data, constant, comparison_type, count, true_sel, false_sel, true_count);
+}
+
+template <>
+bool SIMDKernels::Hash(const int32_t *data, hash_t *result, idx_t count) {
+	return TemplatedHash<int32_t>(data, result, count);
+}
+
+template <>
+bool SIMDKernels::Hash(const int64_t *data, hash_t *result, idx_t count) {
+	return TemplatedHash<int64_t>(data, result, count);
+}
+
+} // namespace duckdb
@@ -6,6 +6,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 
 #include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 
@@ -34,6 +35,9 @@ static inline void TightLoopHash(T *__restrict ldata, hash_t *__restrict result_
 			result_data[ridx] = HashOp::Operation(ldata[idx], !mask.RowIsValid(idx));
 		}
 	} else {
+		if (!HAS_RSEL && !sel_vector->data() && SIMDKernels::Hash<T>(ldata, result_data, count)) {
+			return;
+		}
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
 			auto idx = sel_vector->get_index(ridx);
@@ -3,6 +3,7 @@
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
 
 #include <algorithm>
 
@@ -61,6 +62,54 @@ template <typename OP>
 static idx_t NestedSelectOperation(Vector &left, Vector &right, const SelectionVector *sel, idx_t count,
                                    SelectionVector *true_sel, SelectionVector *false_sel);
 
+//! Maps a comparison operator to the comparison type used by the SIMD kernels
+template <class OP>
+struct SIMDComparison;
+
+#define DUCKDB_SIMD_COMPARISON(OP, TYPE)                                                                               \
+	template <>                                                                                                        \
+	struct SIMDComparison<OP> {                                                                                        \
+		static ExpressionType Type() {                                                                                 \
+			return TYPE;                                                                                               \
+		}                                                                                                              \
+	}
+
+DUCKDB_SIMD_COMPARISON(duckdb::Equals, ExpressionType::COMPARE_EQUAL);
+DUCKDB_SIMD_COMPARISON(duckdb::NotEquals, ExpressionType::COMPARE_NOTEQUAL);
+DUCKDB_SIMD_COMPARISON(duckdb::LessThan, ExpressionType::COMPARE_LESSTHAN);
+DUCKDB_SIMD_COMPARISON(duckdb::LessThanEquals, ExpressionType::COMPARE_LESSTHANOREQUALTO);
+DUCKDB_SIMD_COMPARISON(duckdb::GreaterThan, ExpressionType::COMPARE_GREATERTHAN);
+DUCKDB_SIMD_COMPARISON(duckdb::GreaterThanEquals, ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+
+#undef DUCKDB_SIMD_COMPARISON
+
+template <class T, class OP>
+static idx_t FixedWidthSelectOperation(Vector &left, Vector &right, const SelectionVector *sel, idx_t count,
+                                       SelectionVector *true_sel, SelectionVector *false_sel) {
+	// constant-vs-flat comparisons over dense input without NULLs can use the SIMD kernels
+	auto comparison_type = SIMDComparison<OP>::Type();
+	Vector *flat = nullptr;
+	Vector *constant = nullptr;
+	if (left.GetVectorType() == VectorType::FLAT_VECTOR && right.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		flat = &left;
+		constant = &right;
+	} else if (left.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+	           right.GetVectorType() == VectorType::FLAT_VECTOR) {
+		flat = &right;
+		constant = &left;
+		comparison_type = FlipComparisionExpression(comparison_type);
+	}
+	if (flat && (!sel || !sel->data()) && !ConstantVector::IsNull(*constant) &&
+	    FlatVector::Validity(*flat).AllValid()) {
+		idx_t true_count;
+		if (SIMDKernels::SelectConstant<T>(FlatVector::GetData<T>(*flat), *ConstantVector::GetData<T>(*constant),
+		                                   comparison_type, count, true_sel, false_sel, true_count)) {
+			return true_count;
+		}
+	}
+	return BinaryExecutor::Select<T, T, OP>(left, right, sel, count, true_sel, false_sel);
+}
+
 template <class OP>
 static idx_t TemplatedSelectOperation(Vector &left, Vector &right, const SelectionVector *sel, idx_t count,
                                       SelectionVector *true_sel, SelectionVector *false_sel) {
@@ -72,9 +121,9 @@ static idx_t TemplatedSelectOperation(Vector &left, Vector &right, const Selecti
 	case PhysicalType::INT16:
 		return BinaryExecutor::Select<int16_t, int16_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::INT32:
-		return BinaryExecutor::Select<int32_t, int32_t, OP>(left, right, sel, count, true_sel, false_sel);
+		return FixedWidthSelectOperation<int32_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::INT64:
-		return BinaryExecutor::Select<int64_t, int64_t, OP>(left, right, sel, count, true_sel, false_sel);
+		return FixedWidthSelectOperation<int64_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::UINT8:
 		return BinaryExecutor::Select<uint8_t, uint8_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::UINT16:
@@ -5,6 +5,7 @@
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/partitionable_hashtable.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
@@ -773,6 +774,7 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeDistinct(Pipeline &pipeline, Eve
 			if (partitioned) {
 				any_partitioned = true;
 			}
+			QueryProfiler::Get(context).AddExtraInfo(this, radix_table->GetProfilingInfo(radix_state));
 		}
 	}
 	if (any_partitioned) {
@@ -807,6 +809,8 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 		if (is_partitioned) {
 			any_partitioned = true;
 		}
+		QueryProfiler::Get(context).AddExtraInfo(this,
+		                                         grouping.table_data.GetProfilingInfo(*grouping_gstate.table_state));
 	}
 	if (any_partitioned) {
 		auto new_event = make_shared<HashAggregateMergeEvent>(*this, gstate, &pipeline);
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
 #include <numeric>
 
 namespace duckdb {
@@ -689,6 +690,10 @@ struct WindowBoundariesState {
 	int64_t window_end = -1;
 	bool is_same_partition = false;
 	bool is_peer = false;
+	//! Whether the row does not follow the previous row, e.g., because other threads evaluated the rows in between
+	bool is_resumed = false;
+	//! The row after the previous row
+	idx_t next_row = 0;
 };
 
 static bool WindowNeedsRank(BoundWindowExpression *wexpr) {
@@ -834,16 +839,20 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
                                    const ValidityMask &partition_mask, const ValidityMask &order_mask) {
 
 	auto &bounds = *this;
+	bounds.is_resumed = (row_idx != bounds.next_row);
+	bounds.next_row = row_idx + 1;
 	if (bounds.partition_count + bounds.order_count > 0) {
 
 		// determine partition and peer group boundaries to ultimately figure out window size
 		bounds.is_same_partition = !partition_mask.RowIsValidUnsafe(row_idx);
 		bounds.is_peer = !order_mask.RowIsValidUnsafe(row_idx);
 
-		// when the partition changes, recompute the boundaries
-		if (!bounds.is_same_partition) {
-			bounds.partition_start = row_idx;
-			bounds.peer_start = row_idx;
+		// when the partition changes, or we resume in the middle of one, recompute the boundaries
+		if (!bounds.is_same_partition || bounds.is_resumed) {
+			idx_t n = 1;
+			bounds.partition_start = FindPrevStart(partition_mask, 0, row_idx + 1, n);
+			n = 1;
+			bounds.peer_start = FindPrevStart(order_mask, bounds.partition_start, row_idx + 1, n);
 
 			// find end of partition
 			bounds.partition_end = bounds.input_size;
@@ -993,23 +1002,24 @@ void WindowBoundariesState::Update(const idx_t row_idx, WindowInputColumn &range
 	}
 }
 
+struct WindowExecutorState;
+
 struct WindowExecutor {
 	WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count);
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count);
 	void Finalize(WindowAggregationMode mode);
 
-	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-	              const ValidityMask &order_mask);
+	//! Helps the other threads that evaluate the partition to build the segment tree, if any
+	void ConstructTree(WindowExecutorState &lstate);
+
+	void Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+	              const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
 	// The function
 	BoundWindowExpression *wexpr;
-
-	// Frame management
-	WindowBoundariesState bounds;
-	uint64_t dense_rank = 1;
-	uint64_t rank_equal = 0;
-	uint64_t rank = 1;
+	// The partition size
+	const idx_t count;
 
 	// Expression collections
 	DataChunk payload_collection;
@@ -1021,14 +1031,6 @@ struct WindowExecutor {
 	vector<validity_t> filter_bits;
 	SelectionVector filter_sel;
 
-	// LEAD/LAG Evaluation
-	WindowInputExpression leadlag_offset;
-	WindowInputExpression leadlag_default;
-
-	// evaluate boundaries if present. Parser has checked boundary types.
-	WindowInputExpression boundary_start;
-	WindowInputExpression boundary_end;
-
 	// evaluate RANGE expressions, if needed
 	WindowInputColumn range;
 
@@ -1040,12 +1042,47 @@ struct WindowExecutor {
 	unique_ptr<WindowSegmentTree> segment_tree = nullptr;
 };
 
+//! The per-thread state of a WindowExecutor: the executor itself is only read after Finalize,
+//! so any number of threads can evaluate different rows of the same partition.
+struct WindowExecutorState {
+	WindowExecutorState(WindowExecutor &executor, ClientContext &context);
+
+	// Frame management
+	WindowBoundariesState bounds;
+	uint64_t dense_rank = 1;
+	uint64_t rank_equal = 0;
+	uint64_t rank = 1;
+
+	// LEAD/LAG Evaluation
+	WindowInputExpression leadlag_offset;
+	WindowInputExpression leadlag_default;
+
+	// evaluate boundaries if present. Parser has checked boundary types.
+	WindowInputExpression boundary_start;
+	WindowInputExpression boundary_end;
+
+	// the aggregation state for reading the segment tree
+	unique_ptr<WindowSegmentTreeState> segment_tree_state;
+};
+
+WindowExecutorState::WindowExecutorState(WindowExecutor &executor, ClientContext &context)
+    : bounds(executor.wexpr, executor.count), leadlag_offset(executor.wexpr->offset_expr.get(), context),
+      leadlag_default(executor.wexpr->default_expr.get(), context),
+      boundary_start(executor.wexpr->start_expr.get(), context),
+      boundary_end(executor.wexpr->end_expr.get(), context) {
+	if (executor.segment_tree) {
+		segment_tree_state = make_unique<WindowSegmentTreeState>(*executor.segment_tree);
+	}
+}
+
+static bool WindowNeedsRange(BoundWindowExpression *wexpr) {
+	return wexpr->start == WindowBoundary::EXPR_PRECEDING_RANGE || wexpr->end == WindowBoundary::EXPR_PRECEDING_RANGE ||
+	       wexpr->start == WindowBoundary::EXPR_FOLLOWING_RANGE || wexpr->end == WindowBoundary::EXPR_FOLLOWING_RANGE;
+}
+
 WindowExecutor::WindowExecutor(BoundWindowExpression *wexpr, ClientContext &context, const idx_t count)
-    : wexpr(wexpr), bounds(wexpr, count), payload_collection(), payload_executor(context), filter_executor(context),
-      leadlag_offset(wexpr->offset_expr.get(), context), leadlag_default(wexpr->default_expr.get(), context),
-      boundary_start(wexpr->start_expr.get(), context), boundary_end(wexpr->end_expr.get(), context),
-      range((bounds.has_preceding_range || bounds.has_following_range) ? wexpr->orders[0].expression.get() : nullptr,
-            context, count)
+    : wexpr(wexpr), count(count), payload_collection(), payload_executor(context), filter_executor(context),
+      range(WindowNeedsRange(wexpr) ? wexpr->orders[0].expression.get() : nullptr, context, count)
 
 {
 	// TODO we could evaluate those expressions in parallel
@@ -1150,8 +1187,23 @@ void WindowExecutor::Finalize(WindowAggregationMode mode) {
 	}
 }
 
-void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, const ValidityMask &partition_mask,
-                              const ValidityMask &order_mask) {
+void WindowExecutor::ConstructTree(WindowExecutorState &lstate) {
+	if (segment_tree) {
+		segment_tree->ConstructTree(*lstate.segment_tree_state);
+	}
+}
+
+void WindowExecutor::Evaluate(WindowExecutorState &lstate, idx_t row_idx, DataChunk &input_chunk, Vector &result,
+                              const ValidityMask &partition_mask, const ValidityMask &order_mask) {
+	auto &bounds = lstate.bounds;
+	auto &boundary_start = lstate.boundary_start;
+	auto &boundary_end = lstate.boundary_end;
+	auto &leadlag_offset = lstate.leadlag_offset;
+	auto &leadlag_default = lstate.leadlag_default;
+	auto &dense_rank = lstate.dense_rank;
+	auto &rank = lstate.rank;
+	auto &rank_equal = lstate.rank_equal;
+
 	// Evaluate the row-level arguments
 	boundary_start.Execute(input_chunk);
 	boundary_end.Execute(input_chunk);
@@ -1168,6 +1220,12 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 				dense_rank = 1;
 				rank = 1;
 				rank_equal = 0;
+			} else if (bounds.is_resumed) {
+				// another thread evaluated the rows before, so count the peer groups from the start of the partition
+				dense_rank = order_mask.CountValid(bounds.peer_start + 1);
+				dense_rank -= order_mask.CountValid(bounds.partition_start);
+				rank = bounds.peer_start - bounds.partition_start + 1;
+				rank_equal = row_idx - bounds.peer_start;
 			} else if (!bounds.is_peer) {
 				dense_rank++;
 				rank += rank_equal;
@@ -1184,7 +1242,8 @@ void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &res
 
 		switch (wexpr->type) {
 		case ExpressionType::WINDOW_AGGREGATE: {
-			segment_tree->Compute(result, output_offset, bounds.window_start, bounds.window_end);
+			segment_tree->Compute(*lstate.segment_tree_state, result, output_offset, bounds.window_start,
+			                      bounds.window_end);
 			break;
 		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
@@ -1662,87 +1721,56 @@ SinkFinalizeType PhysicalWindow::Finalize(Pipeline &pipeline, Event &event, Clie
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-class WindowGlobalSourceState : public GlobalSourceState {
-public:
-	explicit WindowGlobalSourceState(const PhysicalWindow &op) : op(op), next_bin(0) {
-	}
-
-	const PhysicalWindow &op;
-	//! The output read position.
-	atomic<idx_t> next_bin;
-
-public:
-	idx_t MaxThreads() override {
-		auto &state = (WindowGlobalSinkState &)*op.sink_state;
-
-		// If there is only one partition, we have to process it on one thread.
-		if (!state.grouping_data) {
-			return 1;
-		}
-
-		// If there is not a lot of data, process serially.
-		if (state.count < STANDARD_ROW_GROUPS_SIZE) {
-			return 1;
-		}
-
-		return state.hash_groups.size();
-	}
-};
-
-// Per-thread read state
-class WindowLocalSourceState : public LocalSourceState {
+// The materialised data of a hash group, shared by the threads that evaluate its rows
+class WindowPartitionSourceState {
 public:
 	using HashGroupPtr = unique_ptr<WindowGlobalHashGroup>;
 	using WindowExecutorPtr = unique_ptr<WindowExecutor>;
 	using WindowExecutors = vector<WindowExecutorPtr>;
 
-	WindowLocalSourceState(const PhysicalWindow &op, ExecutionContext &context, WindowGlobalSourceState &gstate)
-	    : context(context.client), allocator(Allocator::Get(context.client)) {
-		vector<LogicalType> output_types;
-		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
-			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
-			auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.select_list[expr_idx].get());
-			output_types.emplace_back(wexpr->return_type);
-		}
-		output_chunk.Initialize(allocator, output_types);
+	//! A range of rows of a single block, which one thread evaluates
+	struct BlockRange {
+		idx_t block_idx;
+		idx_t entry_idx;
+		idx_t count;
+		//! The partition row index of the first row
+		idx_t row_idx;
+	};
 
-		const auto &input_types = op.children[0]->types;
-		layout.Initialize(input_types);
-		input_chunk.Initialize(allocator, input_types);
+	WindowPartitionSourceState(ClientContext &context, const PhysicalWindow &op)
+	    : context(context), external(false), next_range(0) {
+		layout.Initialize(op.children[0]->types);
 	}
 
 	void MaterializeSortedData();
-	void GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
-	void Scan(DataChunk &chunk);
+	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
 
-	HashGroupPtr hash_group;
 	ClientContext &context;
-	Allocator &allocator;
+	HashGroupPtr hash_group;
 
 	//! The generated input chunks
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> heap;
 	RowLayout layout;
+	bool external;
 	//! The partition boundary mask
 	vector<validity_t> partition_bits;
 	ValidityMask partition_mask;
 	//! The order boundary mask
 	vector<validity_t> order_bits;
 	ValidityMask order_mask;
-	//! The current execution functions
+	//! The execution functions, which are read-only once the partition is built
 	WindowExecutors window_execs;
 
 	//! The read partition
 	idx_t hash_bin;
-	//! The read cursor
-	unique_ptr<RowDataCollectionScanner> scanner;
-	//! Buffer for the inputs
-	DataChunk input_chunk;
-	//! Buffer for window results
-	DataChunk output_chunk;
+	//! The ranges of rows to evaluate
+	vector<BlockRange> ranges;
+	//! The next range to evaluate (protected by the global source lock)
+	idx_t next_range;
 };
 
-void WindowLocalSourceState::MaterializeSortedData() {
+void WindowPartitionSourceState::MaterializeSortedData() {
 	auto &global_sort_state = *hash_group->global_sort;
 	if (global_sort_state.sorted_blocks.empty()) {
 		return;
@@ -1781,7 +1809,7 @@ void WindowLocalSourceState::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
-void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
+void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin_p) {
 	auto &op = (PhysicalWindow &)gstate.op;
 
 	//	Get rid of any stale data
@@ -1822,7 +1850,7 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	order_mask.Initialize(order_bits.data());
 
 	// Scan the sorted data into new Collections
-	auto external = gstate.external;
+	external = gstate.external;
 	if (gstate.rows && !hash_bin) {
 		// Simple mask
 		partition_mask.SetValidUnsafe(0);
@@ -1842,33 +1870,161 @@ void WindowLocalSourceState::GeneratePartition(WindowGlobalSinkState &gstate, co
 	}
 
 	//	First pass over the input without flushing
-	//	TODO: Factor out the constructor data as global state
-	scanner = make_unique<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+	DataChunk input_chunk;
+	input_chunk.Initialize(Allocator::Get(context), layout.GetTypes());
+	RowDataCollectionScanner scanner(*rows, *heap, layout, external, false);
 	idx_t input_idx = 0;
 	while (true) {
 		input_chunk.Reset();
-		scanner->Scan(input_chunk);
+		scanner.Scan(input_chunk);
 		if (input_chunk.size() == 0) {
 			break;
 		}
 
 		//	TODO: Parallelization opportunity
 		for (auto &wexec : window_execs) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+			wexec->Sink(input_chunk, input_idx, scanner.Count());
 		}
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
+	//	The segment trees are built by all the threads that evaluate the partition
 	for (auto &wexec : window_execs) {
 		wexec->Finalize(gstate.mode);
 	}
 
 	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
+	scanner.ReSwizzle();
+
+	//	The second pass evaluates ranges of rows, possibly on different threads.
+	//	External blocks are unswizzled while they are scanned, so only whole blocks can be evaluated in parallel.
+	const auto range_size = external ? NumericLimits<idx_t>::Maximum() : idx_t(STANDARD_ROW_GROUPS_SIZE);
+	idx_t row_idx = 0;
+	for (idx_t block_idx = 0; block_idx < rows->blocks.size(); ++block_idx) {
+		const auto block_count = rows->blocks[block_idx]->count;
+		for (idx_t entry_idx = 0; entry_idx < block_count;) {
+			const auto count = MinValue(block_count - entry_idx, range_size);
+			ranges.push_back({block_idx, entry_idx, count, row_idx});
+			entry_idx += count;
+			row_idx += count;
+		}
+	}
+}
+
+class WindowLocalSourceState;
+
+class WindowGlobalSourceState : public GlobalSourceState {
+public:
+	using PartitionSourcePtr = shared_ptr<WindowPartitionSourceState>;
+
+	WindowGlobalSourceState(ClientContext &context, const PhysicalWindow &op)
+	    : context(context), op(op), next_bin(0), building(0) {
+	}
+
+	//! Assigns the next range of rows to evaluate, building the next partition if there are none left.
+	//! Returns false when there is nothing left to evaluate.
+	bool AssignTask(WindowLocalSourceState &lstate);
+
+	ClientContext &context;
+	const PhysicalWindow &op;
+	//! Protects the partitions and the build state
+	mutex lock;
+	//! The next hash bin to build
+	idx_t next_bin;
+	//! The number of partitions that are being built
+	idx_t building;
+	//! The built partitions that have ranges left to evaluate
+	vector<PartitionSourcePtr> partitions;
+	//! Signalled whenever a partition has been built
+	std::condition_variable partition_built;
+
+public:
+	idx_t MaxThreads() override {
+		auto &state = (WindowGlobalSinkState &)*op.sink_state;
+
+		// If there is only one partition, we have to process it on one thread.
+		if (!state.grouping_data) {
+			return 1;
+		}
+
+		// If there is not a lot of data, process serially.
+		if (state.count < STANDARD_ROW_GROUPS_SIZE) {
+			return 1;
+		}
+
+		// The rows of large partitions are evaluated in parallel, so skewed partitions can still use every thread
+		return MaxValue<idx_t>(state.hash_groups.size(), state.count / STANDARD_ROW_GROUPS_SIZE + 1);
+	}
+};
+
+// Per-thread read state
+class WindowLocalSourceState : public LocalSourceState {
+public:
+	using PartitionSourcePtr = shared_ptr<WindowPartitionSourceState>;
+	using WindowExecutorStatePtr = unique_ptr<WindowExecutorState>;
+
+	WindowLocalSourceState(const PhysicalWindow &op, ExecutionContext &context, WindowGlobalSourceState &gstate)
+	    : context(context.client), allocator(Allocator::Get(context.client)), range_start(0) {
+		vector<LogicalType> output_types;
+		for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
+			D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
+			auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.select_list[expr_idx].get());
+			output_types.emplace_back(wexpr->return_type);
+		}
+		output_chunk.Initialize(allocator, output_types);
+
+		const auto &input_types = op.children[0]->types;
+		input_chunk.Initialize(allocator, input_types);
+	}
+
+	//! Starts evaluating a range of rows of a built partition
+	void BeginRange(PartitionSourcePtr partition_p, const idx_t range_idx);
+	//! Releases the current partition
+	void EndPartition();
+	void Scan(DataChunk &chunk);
+
+	ClientContext &context;
+	Allocator &allocator;
+
+	//! The partition being evaluated
+	PartitionSourcePtr partition;
+	//! The thread-local states of the partition's executors
+	vector<WindowExecutorStatePtr> window_states;
+
+	//! The partition row index of the first row of the range
+	idx_t range_start;
+	//! The read cursor
+	unique_ptr<RowDataCollectionScanner> scanner;
+	//! Buffer for the inputs
+	DataChunk input_chunk;
+	//! Buffer for window results
+	DataChunk output_chunk;
+};
+
+void WindowLocalSourceState::BeginRange(PartitionSourcePtr partition_p, const idx_t range_idx) {
+	scanner.reset();
+	if (partition != partition_p) {
+		EndPartition();
+		partition = std::move(partition_p);
+		for (auto &wexec : partition->window_execs) {
+			window_states.emplace_back(make_unique<WindowExecutorState>(*wexec, context));
+			wexec->ConstructTree(*window_states.back());
+		}
+	}
+
+	// Only release the block if no other thread scans it
+	const auto &range = partition->ranges[range_idx];
+	const auto flush = (range.count == partition->rows->blocks[range.block_idx]->count);
+	range_start = range.row_idx;
+	scanner = make_unique<RowDataCollectionScanner>(*partition->rows, *partition->heap, partition->layout,
+	                                                partition->external, range.block_idx, range.entry_idx,
+	                                                range.count, flush);
+}
 
-	//	Second pass can flush
-	scanner->Reset(true);
+void WindowLocalSourceState::EndPartition() {
+	scanner.reset();
+	window_states.clear();
+	partition.reset();
 }
 
 void WindowLocalSourceState::Scan(DataChunk &result) {
@@ -1877,14 +2033,16 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 		return;
 	}
 
-	const auto position = scanner->Scanned();
+	const auto position = range_start + scanner->Scanned();
 	input_chunk.Reset();
 	scanner->Scan(input_chunk);
 
+	auto &window_execs = partition->window_execs;
 	output_chunk.Reset();
 	for (idx_t expr_idx = 0; expr_idx < window_execs.size(); ++expr_idx) {
 		auto &executor = *window_execs[expr_idx];
-		executor.Evaluate(position, input_chunk, output_chunk.data[expr_idx], partition_mask, order_mask);
+		executor.Evaluate(*window_states[expr_idx], position, input_chunk, output_chunk.data[expr_idx],
+		                  partition->partition_mask, partition->order_mask);
 	}
 	output_chunk.SetCardinality(input_chunk);
 	output_chunk.Verify();
@@ -1900,6 +2058,75 @@ void WindowLocalSourceState::Scan(DataChunk &result) {
 	result.Verify();
 }
 
+bool WindowGlobalSourceState::AssignTask(WindowLocalSourceState &lstate) {
+	auto &gstate = (WindowGlobalSinkState &)*op.sink_state;
+	const auto bin_count = gstate.hash_groups.empty() ? 1 : gstate.hash_groups.size();
+
+	unique_lock<mutex> guard(lock);
+	while (true) {
+		// Evaluate the next range of a built partition, if any
+		PartitionSourcePtr partition;
+		idx_t range_idx = 0;
+		while (!partitions.empty() && !partition) {
+			auto &front = partitions.front();
+			if (front->next_range < front->ranges.size()) {
+				partition = front;
+				range_idx = front->next_range++;
+			} else {
+				partitions.erase(partitions.begin());
+			}
+		}
+		if (partition) {
+			guard.unlock();
+			lstate.BeginRange(std::move(partition), range_idx);
+			return true;
+		}
+
+		// Otherwise build the next partition
+		for (; next_bin < gstate.hash_groups.size(); ++next_bin) {
+			if (gstate.hash_groups[next_bin]) {
+				break;
+			}
+		}
+		if (next_bin < bin_count) {
+			const auto hash_bin = next_bin++;
+			++building;
+			guard.unlock();
+
+			//	Build the partition outside the lock
+			PartitionSourcePtr built;
+			try {
+				lstate.EndPartition();
+				built = make_shared<WindowPartitionSourceState>(context, op);
+				built->BuildPartition(gstate, hash_bin);
+			} catch (...) {
+				guard.lock();
+				--building;
+				partition_built.notify_all();
+				throw;
+			}
+
+			guard.lock();
+			--building;
+			if (!built->ranges.empty()) {
+				partitions.emplace_back(std::move(built));
+			}
+			partition_built.notify_all();
+			continue;
+		}
+
+		if (!building) {
+			break;
+		}
+		//	Other threads are building the remaining partitions, so wait until one of them is done
+		partition_built.wait(guard);
+	}
+	guard.unlock();
+
+	lstate.EndPartition();
+	return false;
+}
+
 unique_ptr<LocalSourceState> PhysicalWindow::GetLocalSourceState(ExecutionContext &context,
                                                                  GlobalSourceState &gstate_p) const {
 	auto &gstate = (WindowGlobalSourceState &)gstate_p;
@@ -1907,35 +2134,20 @@ unique_ptr<LocalSourceState> PhysicalWindow::GetLocalSourceState(ExecutionContex
 }
 
 unique_ptr<GlobalSourceState> PhysicalWindow::GetGlobalSourceState(ClientContext &context) const {
-	return make_unique<WindowGlobalSourceState>(*this);
+	return make_unique<WindowGlobalSourceState>(context, *this);
 }
 
 void PhysicalWindow::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
                              LocalSourceState &lstate_p) const {
 	auto &state = (WindowLocalSourceState &)lstate_p;
 	auto &global_source = (WindowGlobalSourceState &)gstate_p;
-	auto &gstate = (WindowGlobalSinkState &)*sink_state;
-
-	const auto bin_count = gstate.hash_groups.empty() ? 1 : gstate.hash_groups.size();
 
 	while (chunk.size() == 0) {
-		//	Move to the next bin if we are done.
+		//	Move to the next range if we are done.
 		while (!state.scanner || !state.scanner->Remaining()) {
-			state.scanner.reset();
-			state.rows.reset();
-			state.heap.reset();
-			state.hash_group.reset();
-			auto hash_bin = global_source.next_bin++;
-			if (hash_bin >= bin_count) {
+			if (!global_source.AssignTask(state)) {
 				return;
 			}
-
-			for (; hash_bin < gstate.hash_groups.size(); hash_bin = global_source.next_bin++) {
-				if (gstate.hash_groups[hash_bin]) {
-					break;
-				}
-			}
-			state.GeneratePartition(gstate, hash_bin);
 		}
 
 		state.Scan(chunk);
@@ -794,6 +794,20 @@ unique_ptr<OperatorState> PhysicalHashJoin::GetOperatorState(ExecutionContext &c
 	return std::move(state);
 }
 
+bool PhysicalHashJoin::CanReorderProbe() const {
+	if (join_type != JoinType::INNER || !can_go_external || !sink_state) {
+		return false;
+	}
+	auto &sink = (HashJoinGlobalSinkState &)*sink_state;
+	return sink.finalized && !sink.external;
+}
+
+idx_t PhysicalHashJoin::BuildCardinality() const {
+	D_ASSERT(sink_state);
+	auto &sink = (HashJoinGlobalSinkState &)*sink_state;
+	return sink.hash_table->Count();
+}
+
 OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
 #if RATCHET_PRINT >= 1
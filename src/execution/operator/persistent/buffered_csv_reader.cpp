@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/persistent/buffered_csv_reader.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_classifier.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/to_string.hpp"
@@ -1182,6 +1183,7 @@ final_state:
 
 bool BufferedCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message) {
 	// used for parsing algorithm
+	CSVCharacterClassifier classifier(options.delimiter[0], options.quote[0], options.escape[0]);
 	bool finished_chunk = false;
 	idx_t column = 0;
 	idx_t offset = 0;
@@ -1215,6 +1217,11 @@ normal:
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
 		for (; position < buffer_size; position++) {
+			// skip to the next delimiter or newline
+			position = classifier.NextValueEnd(buffer.get(), position, buffer_size);
+			if (position >= buffer_size) {
+				break;
+			}
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
 				goto add_value;
@@ -1275,6 +1282,11 @@ in_quotes:
 	position++;
 	do {
 		for (; position < buffer_size; position++) {
+			// skip to the next quote or escape
+			position = classifier.NextQuoteOrEscape(buffer.get(), position, buffer_size);
+			if (position >= buffer_size) {
+				break;
+			}
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
 				goto unquote;
@@ -0,0 +1,55 @@
+#include "duckdb/execution/operator/persistent/csv_character_classifier.hpp"
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+CSVCharacterClassifier::CSVCharacterClassifier(char delimiter, char quote, char escape) {
+	use_simd = SIMDKernels::GetInstructionSet() != SIMDInstructionSet::NONE;
+	const char group[8] = {delimiter, '\n', '\r', delimiter, quote, escape, quote, escape};
+	memcpy(characters, group, sizeof(characters));
+
+	memset(value_end_characters, 0, sizeof(value_end_characters));
+	memset(quoted_end_characters, 0, sizeof(quoted_end_characters));
+	value_end_characters[uint8_t(delimiter)] = true;
+	value_end_characters[uint8_t('\n')] = true;
+	value_end_characters[uint8_t('\r')] = true;
+	quoted_end_characters[uint8_t(quote)] = true;
+	quoted_end_characters[uint8_t(escape)] = true;
+}
+
+void CSVCharacterClassifier::ClassifyBlock(const char *data, idx_t position) {
+	SIMDKernels::MatchCharacters(data + position, characters, 2, masks);
+	block_data = data;
+	block_start = position;
+}
+
+idx_t CSVCharacterClassifier::Next(const char *data, idx_t position, idx_t end, bool value_end) {
+	constexpr idx_t BLOCK_SIZE = SIMDKernels::CHARACTER_BLOCK_SIZE;
+	if (use_simd) {
+		while (position < end) {
+			if (data != block_data || position < block_start || position >= block_start + BLOCK_SIZE) {
+				if (position + BLOCK_SIZE > end) {
+					// not enough data left for a block: scan the remainder
+					break;
+				}
+				ClassifyBlock(data, position);
+			}
+			auto mask = masks[value_end ? 0 : 1] >> (position - block_start);
+			if (mask != 0) {
+				return MinValue<idx_t>(position + CountZeros<uint64_t>::Trailing(mask), end);
+			}
+			position = block_start + BLOCK_SIZE;
+		}
+	}
+	auto &end_characters = value_end ? value_end_characters : quoted_end_characters;
+	while (position < end && !end_characters[uint8_t(data[position])]) {
+		position++;
+	}
+	return MinValue<idx_t>(position, end);
+}
+
+} // namespace duckdb
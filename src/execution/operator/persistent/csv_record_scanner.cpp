@@ -0,0 +1,164 @@
+#include "duckdb/execution/operator/persistent/csv_record_scanner.hpp"
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
+
+#include <cstring>
+
+namespace duckdb {
+
+CSVRecordScanner::CSVRecordScanner(char delimiter_p, char quote_p, char escape_p)
+    : state(ScannerState::VALUE_START), delimiter(delimiter_p), quote(quote_p), escape(escape_p) {
+	memset(value_end, 0, sizeof(value_end));
+	value_end[uint8_t(delimiter)] = true;
+	value_end[uint8_t('\n')] = true;
+	value_end[uint8_t('\r')] = true;
+
+	scan_blocks = quote == escape && SIMDKernels::GetInstructionSet() != SIMDInstructionSet::NONE;
+	const char groups[12] = {quote,     quote,     quote, quote, delimiter, delimiter,
+	                         delimiter, delimiter, '\n',  '\r',  '\n',      '\r'};
+	memcpy(block_characters, groups, sizeof(block_characters));
+}
+
+void CSVRecordScanner::Reset() {
+	state = ScannerState::VALUE_START;
+	scalar_end = 0;
+}
+
+//! Computes the prefix XOR of the bits: bit i of the result is the XOR of the bits [0, i] of the input
+static inline uint64_t PrefixXor(uint64_t bits) {
+	bits ^= bits << 1;
+	bits ^= bits << 2;
+	bits ^= bits << 4;
+	bits ^= bits << 8;
+	bits ^= bits << 16;
+	bits ^= bits << 32;
+	return bits;
+}
+
+bool CSVRecordScanner::ScanBlock(const char *block, bool find_record, bool &found_record, idx_t &record_offset) {
+	D_ASSERT(state == ScannerState::VALUE_START || state == ScannerState::UNQUOTED || state == ScannerState::QUOTED);
+	uint64_t masks[3];
+	SIMDKernels::MatchCharacters(block, block_characters, 3, masks);
+	auto quotes = masks[0];
+	auto separators = masks[1] | masks[2];
+	auto newlines = masks[2];
+	if (quotes >> 63) {
+		// whether or not a quote at the end of the block is escaped depends on the next block
+		return false;
+	}
+	// every quote toggles between quoted and unquoted: bit i is set if character i is inside a quoted value, where an
+	// opening quote counts as inside and a closing quote as outside
+	auto inside = PrefixXor(quotes) ^ (state == ScannerState::QUOTED ? ~uint64_t(0) : uint64_t(0));
+	// this only holds if quotes open values at their start, which is after a separator or after the closing quote
+	// of an escaped quote ("")...
+	auto opening = quotes & inside;
+	auto value_starts = (separators << 1) | (quotes << 1) | (state == ScannerState::VALUE_START ? 1 : 0);
+	if (opening & ~value_starts) {
+		return false;
+	}
+	// ...and if they close values at their end, which is before a separator or before the second quote of an
+	// escaped quote
+	auto closing = quotes & ~inside;
+	if (closing & ~((separators | quotes) >> 1)) {
+		return false;
+	}
+	auto record_ends = newlines & ~inside;
+	if (find_record && record_ends) {
+		found_record = true;
+		record_offset = CountZeros<uint64_t>::Trailing(record_ends) + 1;
+		state = ScannerState::VALUE_START;
+		return true;
+	}
+	found_record = false;
+	if (inside >> 63) {
+		state = ScannerState::QUOTED;
+	} else if (separators >> 63) {
+		state = ScannerState::VALUE_START;
+	} else {
+		state = ScannerState::UNQUOTED;
+	}
+	return true;
+}
+
+bool CSVRecordScanner::Scan(const char *data, idx_t start, idx_t end, bool find_record, idx_t &record_start) {
+	// this follows the states of ParallelCSVReader::TryParseSimpleCSV, but only looks at the structural characters
+	constexpr idx_t BLOCK_SIZE = SIMDKernels::CHARACTER_BLOCK_SIZE;
+	if (start < scalar_end) {
+		// the scalar range refers to other data (or an earlier part of this data)
+		scalar_end = 0;
+	}
+	idx_t position = start;
+	while (position < end) {
+		if (scan_blocks && position >= scalar_end && position + BLOCK_SIZE <= end &&
+		    state != ScannerState::UNQUOTE && state != ScannerState::ESCAPE) {
+			bool found_record;
+			idx_t record_offset;
+			if (ScanBlock(data + position, find_record, found_record, record_offset)) {
+				if (found_record) {
+					record_start = position + record_offset;
+					return true;
+				}
+				position += BLOCK_SIZE;
+				continue;
+			}
+			// follow this block character by character
+			scalar_end = position + BLOCK_SIZE;
+		}
+		switch (state) {
+		case ScannerState::VALUE_START:
+			if (data[position] == quote) {
+				state = ScannerState::QUOTED;
+				position++;
+				break;
+			}
+			state = ScannerState::UNQUOTED;
+			break;
+		case ScannerState::UNQUOTED: {
+			// skip to the end of the value
+			while (position < end && !value_end[uint8_t(data[position])]) {
+				position++;
+			}
+			if (position == end) {
+				break;
+			}
+			auto c = data[position++];
+			state = ScannerState::VALUE_START;
+			if (find_record && StringUtil::CharacterIsNewline(c)) {
+				record_start = position;
+				return true;
+			}
+			break;
+		}
+		case ScannerState::QUOTED:
+			// skip to the closing quote
+			while (position < end && data[position] != quote && data[position] != escape) {
+				position++;
+			}
+			if (position == end) {
+				break;
+			}
+			state = data[position] == quote ? ScannerState::UNQUOTE : ScannerState::ESCAPE;
+			position++;
+			break;
+		case ScannerState::UNQUOTE:
+			if (data[position] == quote && escape == quote) {
+				// an escaped quote: the value continues
+				state = ScannerState::QUOTED;
+				position++;
+				break;
+			}
+			// the quoted value has ended: what follows is handled as if the value was unquoted
+			state = ScannerState::UNQUOTED;
+			break;
+		case ScannerState::ESCAPE:
+			state = ScannerState::QUOTED;
+			position++;
+			break;
+		}
+	}
+	return false;
+}
+
+} // namespace duckdb
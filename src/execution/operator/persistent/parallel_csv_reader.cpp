@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/persistent/parallel_csv_reader.hpp"
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/execution/operator/persistent/csv_character_classifier.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/to_string.hpp"
@@ -79,6 +80,23 @@ bool ParallelCSVReader::SetPosition(DataChunk &insert_chunk) {
 		return true;
 	}
 
+	if (buffer->has_record_start) {
+		if (start_buffer != buffer->buffer_start) {
+			// we are already past the first record of this piece
+			return true;
+		}
+		// the start of the first record was found when the file was split up in pieces
+		verification_positions.beginning_of_first_line = buffer->record_start;
+		verification_positions.end_of_last_line = buffer->record_start;
+		if (buffer->record_start > end_buffer) {
+			// no record starts in this piece: the record that covers it is read by the previous piece
+			return false;
+		}
+		start_buffer = position_buffer = buffer->record_start;
+		finished = false;
+		return true;
+	}
+
 	// We have to move position up to next new line
 	idx_t end_buffer_real = end_buffer;
 	// Check if we already start in a valid line
@@ -182,9 +200,31 @@ bool ParallelCSVReader::BufferRemainder() {
 	return true;
 }
 
+//! Returns the position of the first delimiter or newline (VALUE_END) or quote or escape (!VALUE_END) in the range
+//! [position, end) of the buffer, which continues in the next buffer. Returns end if there is none.
+template <bool VALUE_END>
+static idx_t NextCharacter(CSVCharacterClassifier &classifier, CSVBufferRead &buffer, idx_t position, idx_t end) {
+	auto current_size = buffer.buffer->GetBufferSize();
+	if (position < current_size) {
+		auto current_end = MinValue<idx_t>(end, current_size);
+		auto data = buffer.buffer->Ptr();
+		position = VALUE_END ? classifier.NextValueEnd(data, position, current_end)
+		                     : classifier.NextQuoteOrEscape(data, position, current_end);
+		if (position < current_end || current_end == end) {
+			return position;
+		}
+	}
+	D_ASSERT(buffer.next_buffer);
+	auto next_data = buffer.next_buffer->Ptr();
+	auto next_position = VALUE_END ? classifier.NextValueEnd(next_data, position - current_size, end - current_size)
+	                               : classifier.NextQuoteOrEscape(next_data, position - current_size, end - current_size);
+	return current_size + next_position;
+}
+
 bool ParallelCSVReader::TryParseSimpleCSV(DataChunk &insert_chunk, string &error_message, bool try_add_line) {
 	// used for parsing algorithm
 	D_ASSERT(end_buffer <= buffer_size);
+	CSVCharacterClassifier classifier(options.delimiter[0], options.quote[0], options.escape[0]);
 	bool finished_chunk = false;
 	idx_t column = 0;
 	idx_t offset = 0;
@@ -230,6 +270,11 @@ normal : {
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip to the next delimiter or newline
+		position_buffer = NextCharacter<true>(classifier, *buffer, position_buffer, end_buffer);
+		if (position_buffer >= end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.delimiter[0]) {
 			// delimiter: end the value and add it to the chunk
@@ -335,6 +380,11 @@ in_quotes:
 	has_quotes = true;
 	position_buffer++;
 	for (; position_buffer < end_buffer; position_buffer++) {
+		// skip to the next quote or escape
+		position_buffer = NextCharacter<false>(classifier, *buffer, position_buffer, end_buffer);
+		if (position_buffer >= end_buffer) {
+			break;
+		}
 		auto c = (*buffer)[position_buffer];
 		if (c == options.quote[0]) {
 			// quote: move to unquoted state
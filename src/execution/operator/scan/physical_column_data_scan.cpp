@@ -8,30 +8,56 @@ namespace duckdb {
 
 class PhysicalColumnDataScanState : public GlobalSourceState {
 public:
-	explicit PhysicalColumnDataScanState() : initialized(false) {
+	explicit PhysicalColumnDataScanState(ColumnDataCollection &collection) : collection(collection), initialized(false) {
 	}
 
-	//! The current position in the scan
-	ColumnDataScanState scan_state;
+	idx_t MaxThreads() override {
+		return collection.ChunkCount();
+	}
+
+	//! The collection that is scanned
+	ColumnDataCollection &collection;
+	//! The current position in the scan, shared by all threads
+	ColumnDataParallelScanState scan_state;
+	//! The scan is set up by the first thread, as the collection might only be filled after the plan is scheduled
 	bool initialized;
+	mutex lock;
+};
+
+class PhysicalColumnDataScanLocalState : public LocalSourceState {
+public:
+	ColumnDataLocalScanState scan_state;
 };
 
 unique_ptr<GlobalSourceState> PhysicalColumnDataScan::GetGlobalSourceState(ClientContext &context) const {
-	return make_unique<PhysicalColumnDataScanState>();
+	D_ASSERT(collection);
+	return make_unique<PhysicalColumnDataScanState>(*collection);
 }
 
-void PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
-                                     LocalSourceState &lstate) const {
-	auto &state = (PhysicalColumnDataScanState &)gstate;
-	D_ASSERT(collection);
-	if (collection->Count() == 0) {
-		return;
+unique_ptr<LocalSourceState> PhysicalColumnDataScan::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate_p) const {
+	auto &gstate = (PhysicalColumnDataScanState &)gstate_p;
+	lock_guard<mutex> guard(gstate.lock);
+	if (!gstate.initialized) {
+		collection->InitializeScan(gstate.scan_state);
+		gstate.initialized = true;
 	}
-	if (!state.initialized) {
-		collection->InitializeScan(state.scan_state);
-		state.initialized = true;
-	}
-	collection->Scan(state.scan_state, chunk);
+	return make_unique<PhysicalColumnDataScanLocalState>();
+}
+
+void PhysicalColumnDataScan::GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate_p,
+                                     LocalSourceState &lstate_p) const {
+	auto &gstate = (PhysicalColumnDataScanState &)gstate_p;
+	auto &lstate = (PhysicalColumnDataScanLocalState &)lstate_p;
+	D_ASSERT(collection);
+	collection->Scan(gstate.scan_state, lstate.scan_state, chunk);
+}
+
+idx_t PhysicalColumnDataScan::GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+                                            LocalSourceState &lstate_p) const {
+	auto &lstate = (PhysicalColumnDataScanLocalState &)lstate_p;
+	// chunks are handed out in order: the row index of the first row of a chunk identifies it
+	return lstate.scan_state.current_row_index;
 }
 
 //===--------------------------------------------------------------------===//
@@ -55,6 +81,14 @@ void PhysicalColumnDataScan::BuildPipelines(Pipeline &current, MetaPipeline &met
 		state.SetPipelineSource(current, (PhysicalOperator *)delim_join.distinct.get());
 		return;
 	}
+	case PhysicalOperatorType::CTE_SCAN: {
+		auto entry = state.cte_dependencies.find(this);
+		D_ASSERT(entry != state.cte_dependencies.end());
+		// the scan of a materialized CTE depends on the pipeline that materializes the CTE
+		auto cte_dependency = entry->second->shared_from_this();
+		current.AddDependency(cte_dependency);
+		break;
+	}
 	case PhysicalOperatorType::RECURSIVE_CTE_SCAN:
 		if (!meta_pipeline.HasRecursiveCTE()) {
 			throw InternalException("Recursive CTE scan found without recursive CTE node");
@@ -0,0 +1,90 @@
+#include "duckdb/execution/operator/set/physical_cte.hpp"
+
+#include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+
+namespace duckdb {
+
+PhysicalCTE::PhysicalCTE(vector<LogicalType> types, bool parallel, unique_ptr<PhysicalOperator> cte,
+                         unique_ptr<PhysicalOperator> child, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CTE, std::move(types), estimated_cardinality), parallel(parallel) {
+	children.push_back(std::move(cte));
+	children.push_back(std::move(child));
+}
+
+PhysicalCTE::~PhysicalCTE() {
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class CTEGlobalState : public GlobalSinkState {
+public:
+	mutex glock;
+};
+
+class CTELocalState : public LocalSinkState {
+public:
+	unique_ptr<ColumnDataCollection> collection;
+	ColumnDataAppendState append_state;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCTE::GetGlobalSinkState(ClientContext &context) const {
+	// the CTE can be materialized more than once when it is part of a recursive CTE
+	working_table->Reset();
+	return make_unique<CTEGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalCTE::GetLocalSinkState(ExecutionContext &context) const {
+	auto state = make_unique<CTELocalState>();
+	state->collection = make_unique<ColumnDataCollection>(context.client, children[0]->types);
+	state->collection->InitializeAppend(state->append_state);
+	return std::move(state);
+}
+
+SinkResultType PhysicalCTE::Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p,
+                                 DataChunk &input) const {
+	auto &lstate = (CTELocalState &)lstate_p;
+	lstate.collection->Append(lstate.append_state, input);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalCTE::Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate_p) const {
+	auto &gstate = (CTEGlobalState &)state;
+	auto &lstate = (CTELocalState &)lstate_p;
+	if (lstate.collection->Count() == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(gstate.glock);
+	working_table->Combine(*lstate.collection);
+}
+
+//===--------------------------------------------------------------------===//
+// Pipeline Construction
+//===--------------------------------------------------------------------===//
+void PhysicalCTE::BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) {
+	op_state.reset();
+	sink_state.reset();
+
+	// the CTE is materialized in its own pipeline
+	auto child_meta_pipeline = meta_pipeline.CreateChildMetaPipeline(current, this);
+	child_meta_pipeline->Build(children[0].get());
+
+	// any scan of the materialized CTE depends on this pipeline, also the ones outside of the current pipeline
+	auto &state = meta_pipeline.GetState();
+	for (auto &cte_scan : cte_scans) {
+		state.cte_dependencies[cte_scan] = child_meta_pipeline->GetBasePipeline().get();
+	}
+	children[1]->BuildPipelines(current, meta_pipeline);
+}
+
+vector<const PhysicalOperator *> PhysicalCTE::GetSources() const {
+	return children[1]->GetSources();
+}
+
+bool PhysicalCTE::AllOperatorsPreserveOrder() const {
+	// the order of the result only depends on the main query
+	return children[1]->AllOperatorsPreserveOrder();
+}
+
+} // namespace duckdb
@@ -192,6 +192,14 @@ void PhysicalRecursiveCTE::BuildPipelines(Pipeline &current, MetaPipeline &meta_
 	recursive_meta_pipeline = make_shared<MetaPipeline>(executor, state, this);
 	recursive_meta_pipeline->SetRecursiveCTE();
 	recursive_meta_pipeline->Build(children[1].get());
+
+	// the recursive pipelines are only scheduled by this operator: any pipeline outside of them that they depend on
+	// (e.g. a materialized CTE that is scanned in the recursion) has to finish before this operator is executed
+	vector<shared_ptr<Pipeline>> external_dependencies;
+	recursive_meta_pipeline->GetExternalDependencies(external_dependencies);
+	for (auto &dependency : external_dependencies) {
+		current.AddDependency(dependency);
+	}
 }
 
 vector<const PhysicalOperator *> PhysicalRecursiveCTE::GetSources() const {
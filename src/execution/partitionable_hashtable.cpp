@@ -1,4 +1,5 @@
 #include "duckdb/execution/partitionable_hashtable.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -50,7 +51,8 @@ PartitionableHashTable::PartitionableHashTable(ClientContext &context, Allocator
                                                vector<BoundAggregateExpression *> bindings_p)
     : context(context), allocator(allocator), group_types(std::move(group_types_p)),
       payload_types(std::move(payload_types_p)), bindings(std::move(bindings_p)), is_partitioned(false),
-      partition_info(partition_info_p), hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH) {
+      partition_info(partition_info_p), hashes(LogicalType::HASH), hashes_subset(LogicalType::HASH),
+      is_bypassed(false) {
 
 	sel_vectors.resize(partition_info.n_partitions);
 	sel_vector_sizes.resize(partition_info.n_partitions);
@@ -127,6 +129,10 @@ idx_t PartitionableHashTable::AddChunk(DataChunk &groups, DataChunk &payload, bo
 		}
 		hashes_subset.Slice(hashes, sel_vectors[r], sel_vector_sizes[r]);
 
+		if (IsBypassed()) {
+			BypassAppend(r, group_subset, hashes_subset, payload_subset);
+			continue;
+		}
 		group_count += ListAddChunk(radix_partitioned_hts[r], group_subset, hashes_subset, payload_subset, filter);
 	}
 	return group_count;
@@ -155,6 +161,80 @@ bool PartitionableHashTable::IsPartitioned() {
 	return is_partitioned;
 }
 
+void PartitionableHashTable::Bypass(const vector<idx_t> &filter) {
+	D_ASSERT(IsPartitioned());
+	D_ASSERT(!IsBypassed());
+
+	// raw rows are stored as [groups, payload, hash] so they do not have to be hashed again when they are aggregated
+	auto types = group_types;
+	types.insert(types.end(), payload_types.begin(), payload_types.end());
+	types.push_back(LogicalType::HASH);
+	bypass_chunk.InitializeEmpty(types);
+
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	for (idx_t r = 0; r < partition_info.n_partitions; r++) {
+		bypassed_partitions.push_back(make_unique<ColumnDataCollection>(buffer_manager, types));
+		bypass_append_states.push_back(make_unique<ColumnDataAppendState>());
+		bypassed_partitions[r]->InitializeAppend(*bypass_append_states[r]);
+	}
+	bypass_filter = filter;
+	is_bypassed = true;
+}
+
+bool PartitionableHashTable::IsBypassed() {
+	return is_bypassed;
+}
+
+void PartitionableHashTable::BypassAppend(idx_t partition, DataChunk &groups, Vector &group_hashes,
+                                          DataChunk &payload) {
+	if (groups.size() == 0) {
+		return;
+	}
+	idx_t col_idx = 0;
+	for (idx_t i = 0; i < groups.ColumnCount(); i++) {
+		bypass_chunk.data[col_idx++].Reference(groups.data[i]);
+	}
+	for (idx_t i = 0; i < payload_types.size(); i++) {
+		bypass_chunk.data[col_idx++].Reference(payload.data[i]);
+	}
+	bypass_chunk.data[col_idx].Reference(group_hashes);
+	bypass_chunk.SetCardinality(groups.size());
+	bypassed_partitions[partition]->Append(*bypass_append_states[partition], bypass_chunk);
+}
+
+void PartitionableHashTable::CombineBypassed(idx_t partition, GroupedAggregateHashTable &target) {
+	D_ASSERT(IsBypassed());
+	D_ASSERT(partition < bypassed_partitions.size());
+	auto data = std::move(bypassed_partitions[partition]);
+	if (!data || data->Count() == 0) {
+		return;
+	}
+
+	DataChunk scan_chunk;
+	data->InitializeScanChunk(scan_chunk);
+	DataChunk groups;
+	groups.InitializeEmpty(group_types);
+	DataChunk payload;
+	if (!payload_types.empty()) {
+		payload.InitializeEmpty(payload_types);
+	}
+
+	ColumnDataScanState scan_state;
+	data->InitializeScan(scan_state);
+	while (data->Scan(scan_state, scan_chunk)) {
+		idx_t col_idx = 0;
+		for (idx_t i = 0; i < group_types.size(); i++) {
+			groups.data[i].Reference(scan_chunk.data[col_idx++]);
+		}
+		for (idx_t i = 0; i < payload_types.size(); i++) {
+			payload.data[i].Reference(scan_chunk.data[col_idx++]);
+		}
+		groups.SetCardinality(scan_chunk.size());
+		payload.SetCardinality(scan_chunk.size());
+		target.AddChunk(groups, scan_chunk.data[col_idx], payload, bypass_filter);
+	}
+}
+
 HashTableList PartitionableHashTable::GetPartition(idx_t partition) {
 	D_ASSERT(IsPartitioned());
 	D_ASSERT(partition < partition_info.n_partitions);
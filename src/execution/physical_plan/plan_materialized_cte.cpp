@@ -0,0 +1,30 @@
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/execution/operator/set/physical_cte.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+
+namespace duckdb {
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalMaterializedCTE &op) {
+	D_ASSERT(op.children.size() == 2);
+
+	// Create the working_table that the PhysicalCTE will materialize the CTE into
+	auto working_table = std::make_shared<ColumnDataCollection>(context, op.children[0]->types);
+
+	// Add the ColumnDataCollection to the context of this PhysicalPlanGenerator, the CTE scans are collected while
+	// planning the main query
+	materialized_cte_tables[op.table_index] = working_table;
+
+	auto cte_plan = CreatePlan(*op.children[0]);
+	auto child = CreatePlan(*op.children[1]);
+
+	// the materialized CTE only needs to keep its order if the CTE itself is ordered
+	bool parallel = !PreserveInsertionOrder(*cte_plan);
+	auto cte = make_unique<PhysicalCTE>(op.types, parallel, std::move(cte_plan), std::move(child),
+	                                    op.estimated_cardinality);
+	cte->working_table = working_table;
+	cte->cte_scans = std::move(materialized_cte_scans[op.table_index]);
+	return std::move(cte);
+}
+
+} // namespace duckdb
@@ -30,6 +30,16 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalRecursiveC
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCTERef &op) {
 	D_ASSERT(op.children.empty());
 
+	// the reference is either to a materialized CTE or to the working table of a recursive CTE
+	auto materialized_cte = materialized_cte_tables.find(op.cte_index);
+	if (materialized_cte != materialized_cte_tables.end()) {
+		auto chunk_scan =
+		    make_unique<PhysicalColumnDataScan>(op.types, PhysicalOperatorType::CTE_SCAN, op.estimated_cardinality);
+		chunk_scan->collection = materialized_cte->second.get();
+		materialized_cte_scans[op.cte_index].push_back(chunk_scan.get());
+		return std::move(chunk_scan);
+	}
+
 	auto chunk_scan = make_unique<PhysicalColumnDataScan>(op.types, PhysicalOperatorType::RECURSIVE_CTE_SCAN,
 	                                                      op.estimated_cardinality);
 
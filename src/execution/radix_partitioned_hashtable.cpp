@@ -2,6 +2,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/parallel/event.hpp"
+#include "duckdb/common/string_util.hpp"
 
 #include <iostream>
 
@@ -38,6 +39,9 @@ RadixPartitionedHashTable::RadixPartitionedHashTable(GroupingSet &grouping_set_p
 
 	// 10000 seems like a good compromise here
 	radix_limit = 10000;
+	// threads that see (nearly) unique groups only pay for hashing and inserting rows twice when pre-aggregating
+	bypass_min_rows = 10 * radix_limit;
+	bypass_reduction_threshold = 1.1;
 
 	if (grouping_set.empty()) {
 		// fake a single group with a constant value for aggregation without groups
@@ -56,7 +60,7 @@ RadixPartitionedHashTable::RadixPartitionedHashTable(GroupingSet &grouping_set_p
 class RadixHTGlobalState : public GlobalSinkState {
 public:
 	explicit RadixHTGlobalState(ClientContext &context)
-	    : is_empty(true), multi_scan(true), total_groups(0),
+	    : is_empty(true), multi_scan(true), total_groups(0), bypassed_threads(0), bypassed_rows(0),
 	      partition_info((idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads()) {
 	}
 
@@ -71,6 +75,9 @@ public:
 	mutex lock;
 	//! a counter to determine if we should switch over to partitioning
 	atomic<idx_t> total_groups;
+	//! how many threads stopped pre-aggregating, and how many rows they passed on without aggregating them
+	atomic<idx_t> bypassed_threads;
+	atomic<idx_t> bypassed_rows;
 
 	bool is_finalized = false;
 	bool is_partitioned = false;
@@ -80,7 +87,7 @@ public:
 
 class RadixHTLocalState : public LocalSinkState {
 public:
-	explicit RadixHTLocalState(const RadixPartitionedHashTable &ht) : is_empty(true) {
+	explicit RadixHTLocalState(const RadixPartitionedHashTable &ht) : is_empty(true), sunk_rows(0), sunk_groups(0) {
 		// if there are no groups we create a fake group so everything has the same group
 		group_chunk.InitializeEmpty(ht.group_types);
 		if (ht.grouping_set.empty()) {
@@ -94,6 +101,9 @@ public:
 
 	//! Whether or not any tuples were added to the HT
 	bool is_empty;
+	//! The number of rows sunk into and groups created in the local HT, used to monitor the reduction factor
+	idx_t sunk_rows;
+	idx_t sunk_groups;
 };
 
 void RadixPartitionedHashTable::SetMultiScan(GlobalSinkState &state) {
@@ -164,9 +174,24 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, GlobalSinkState
 		                                        group_types, op.payload_types, op.bindings);
 	}
 
-	gstate.total_groups +=
-	    llstate.ht->AddChunk(group_chunk, payload_input,
-	                         gstate.total_groups > radix_limit && gstate.partition_info.n_partitions > 1, filter);
+	auto &ht = *llstate.ht;
+	if (ht.IsPartitioned() && !ht.IsBypassed() && llstate.sunk_rows >= bypass_min_rows &&
+	    double(llstate.sunk_rows) < double(llstate.sunk_groups) * bypass_reduction_threshold) {
+		// (nearly) every row creates a new group: stop aggregating locally, the rows are aggregated once in the
+		// partitioned merge
+		ht.Bypass(filter);
+		gstate.bypassed_threads++;
+	}
+	if (ht.IsBypassed()) {
+		gstate.bypassed_rows += group_chunk.size();
+	}
+
+	auto new_groups =
+	    ht.AddChunk(group_chunk, payload_input,
+	                gstate.total_groups > radix_limit && gstate.partition_info.n_partitions > 1, filter);
+	llstate.sunk_rows += group_chunk.size();
+	llstate.sunk_groups += new_groups;
+	gstate.total_groups += new_groups;
 }
 
 void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkState &state,
@@ -291,6 +316,9 @@ public:
 				gstate.finalized_hts[radix]->Combine(*ht);
 				ht.reset();
 			}
+			if (pht->IsBypassed()) {
+				pht->CombineBypassed(radix, *gstate.finalized_hts[radix]);
+			}
 		}
 		gstate.finalized_hts[radix]->Finalize();
 	}
@@ -328,6 +356,15 @@ bool RadixPartitionedHashTable::ForceSingleHT(GlobalSinkState &state) const {
 	return gstate.partition_info.n_partitions < 2;
 }
 
+string RadixPartitionedHashTable::GetProfilingInfo(GlobalSinkState &state) const {
+	auto &gstate = (RadixHTGlobalState &)state;
+	if (gstate.bypassed_threads == 0) {
+		return string();
+	}
+	return StringUtil::Format("Pre-Aggregation Bypassed: %llu rows (%llu threads)", (idx_t)gstate.bypassed_rows,
+	                          (idx_t)gstate.bypassed_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
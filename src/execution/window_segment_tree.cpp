@@ -6,42 +6,88 @@
 
 namespace duckdb {
 
-WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info,
-                                     const LogicalType &result_type_p, DataChunk *input,
-                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
-    : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p), state(aggregate.state_size()),
-      statep(Value::POINTER((idx_t)state.data())), frame(0, 0), statev(Value::POINTER((idx_t)state.data())),
-      internal_nodes(0), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
-	statep.Flatten(input->size());
+WindowSegmentTreeState::WindowSegmentTreeState(const WindowSegmentTree &tree)
+    : tree(tree), state(tree.state_size), statep(Value::POINTER((idx_t)state.data())), frame(0, 0),
+      statev(Value::POINTER((idx_t)state.data())) {
+	// the tree combines at most TREE_FANOUT states or rows at once, otherwise entire frames are aggregated
+	const auto input_count = tree.input_ref->size();
+	const auto fanout = idx_t(WindowSegmentTree::TREE_FANOUT);
+	const auto capacity = tree.HasTree() ? MinValue<idx_t>(input_count, fanout) : input_count;
+	statep.Flatten(capacity);
 	statev.SetVectorType(VectorType::FLAT_VECTOR); // Prevent conversion of results to constants
 
-	if (input_ref && input_ref->ColumnCount() > 0) {
-		filter_sel.Initialize(input->size());
-		inputs.Initialize(Allocator::DefaultAllocator(), input_ref->GetTypes());
-		// if we have a frame-by-frame method, share the single state
-		if (aggregate.window && UseWindowAPI()) {
-			AggregateInit();
-			inputs.Reference(*input_ref);
+	// if we have a frame-by-frame method, every frame updates the single state
+	if (tree.HasWindowAPI()) {
+		tree.AggregateInit(*this);
+	}
+	if (tree.input_ref->ColumnCount() > 0) {
+		filter_sel.Initialize(capacity);
+		inputs.Initialize(Allocator::DefaultAllocator(), tree.input_ref->GetTypes());
+		if (tree.HasWindowAPI()) {
+			inputs.Reference(*tree.input_ref);
 		} else {
-			inputs.SetCapacity(*input_ref);
-			if (aggregate.combine && UseCombineAPI()) {
-				ConstructTree();
-			}
+			inputs.SetCapacity(*tree.input_ref);
 		}
 	}
 }
 
+WindowSegmentTreeState::~WindowSegmentTreeState() {
+	if (tree.HasWindowAPI() && tree.aggregate.destructor) {
+		tree.aggregate.destructor(statev, 1);
+	}
+}
+
+WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData *bind_info,
+                                     const LogicalType &result_type_p, DataChunk *input,
+                                     const ValidityMask &filter_mask_p, WindowAggregationMode mode_p)
+    : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p), state_size(aggregate.state_size()),
+      internal_nodes(0), build_nodes(0), build_next(0), build_completed(0),
+      build_failed(false), input_ref(input), filter_mask(filter_mask_p), mode(mode_p) {
+	if (HasWindowAPI()) {
+		gstate.resize(state_size);
+		aggregate.initialize(gstate.data());
+	}
+	if (!HasTree()) {
+		return;
+	}
+
+	// compute space required to store internal nodes of segment tree
+	idx_t level_nodes = input_ref->size();
+	do {
+		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		internal_nodes += level_nodes;
+	} while (level_nodes > 1);
+	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state_size]);
+
+	// lay out the levels up front, so the nodes can be computed by several threads
+	// level 0 is data itself
+	levels_flat_start.push_back(0);
+	for (auto level_size = input_ref->size(); level_size > 1;) {
+		level_size = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		build_nodes += level_size;
+		levels_flat_start.push_back(build_nodes);
+	}
+
+	// Corner case: single element in the window
+	if (build_nodes == 0 && internal_nodes > 0) {
+		aggregate.initialize(levels_flat_native.get());
+	}
+}
+
 WindowSegmentTree::~WindowSegmentTree() {
 	if (!aggregate.destructor) {
 		// nothing to destroy
 		return;
 	}
-	// call the destructor for all the intermediate states
+	// call the destructor for the shared state and all the intermediate states
 	data_ptr_t address_data[STANDARD_VECTOR_SIZE];
 	Vector addresses(LogicalType::POINTER, (data_ptr_t)address_data);
 	idx_t count = 0;
+	if (!gstate.empty()) {
+		address_data[count++] = gstate.data();
+	}
 	for (idx_t i = 0; i < internal_nodes; i++) {
-		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state.size());
+		address_data[count++] = data_ptr_t(levels_flat_native.get() + i * state_size);
 		if (count == STANDARD_VECTOR_SIZE) {
 			aggregate.destructor(addresses, count);
 			count = 0;
@@ -50,29 +96,26 @@ WindowSegmentTree::~WindowSegmentTree() {
 	if (count > 0) {
 		aggregate.destructor(addresses, count);
 	}
-
-	if (aggregate.window && UseWindowAPI()) {
-		aggregate.destructor(statev, 1);
-	}
 }
 
-void WindowSegmentTree::AggregateInit() {
-	aggregate.initialize(state.data());
+void WindowSegmentTree::AggregateInit(WindowSegmentTreeState &lstate) const {
+	aggregate.initialize(lstate.state.data());
 }
 
-void WindowSegmentTree::AggegateFinal(Vector &result, idx_t rid) {
+void WindowSegmentTree::AggegateFinal(WindowSegmentTreeState &lstate, Vector &result, idx_t rid) const {
 	AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
-	aggregate.finalize(statev, aggr_input_data, result, 1, rid);
+	aggregate.finalize(lstate.statev, aggr_input_data, result, 1, rid);
 
 	if (aggregate.destructor) {
-		aggregate.destructor(statev, 1);
+		aggregate.destructor(lstate.statev, 1);
 	}
 }
 
-void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
+void WindowSegmentTree::ExtractFrame(WindowSegmentTreeState &lstate, idx_t begin, idx_t end) const {
 	const auto size = end - begin;
 
 	auto &chunk = *input_ref;
+	auto &inputs = lstate.inputs;
 	const auto input_count = input_ref->ColumnCount();
 	inputs.SetCardinality(size);
 	for (idx_t i = 0; i < input_count; ++i) {
@@ -84,6 +127,7 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 
 	// Slice to any filtered rows
 	if (!filter_mask.AllValid()) {
+		auto &filter_sel = lstate.filter_sel;
 		idx_t filtered = 0;
 		for (idx_t i = begin; i < end; ++i) {
 			if (filter_mask.RowIsValid(i)) {
@@ -96,27 +140,29 @@ void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 	}
 }
 
-void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end) {
+void WindowSegmentTree::WindowSegmentValue(WindowSegmentTreeState &lstate, idx_t l_idx, idx_t begin,
+                                           idx_t end) const {
 	D_ASSERT(begin <= end);
+	auto &inputs = lstate.inputs;
 	if (begin == end || inputs.ColumnCount() == 0) {
 		return;
 	}
 
 	const auto count = end - begin;
-	Vector s(statep, 0, count);
+	Vector s(lstate.statep, 0, count);
 	if (l_idx == 0) {
-		ExtractFrame(begin, end);
+		ExtractFrame(lstate, begin, end);
 		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
 		D_ASSERT(inputs.data.size() > 0);
 		aggregate.update(&inputs.data[0], aggr_input_data, input_ref->ColumnCount(), s, inputs.size());
 	} else {
 		// find out where the states begin
-		data_ptr_t begin_ptr = levels_flat_native.get() + state.size() * (begin + levels_flat_start[l_idx - 1]);
+		data_ptr_t begin_ptr = levels_flat_native.get() + state_size * (begin + levels_flat_start[l_idx - 1]);
 		// set up a vector of pointers that point towards the set of states
 		Vector v(LogicalType::POINTER, count);
 		auto pdata = FlatVector::GetData<data_ptr_t>(v);
 		for (idx_t i = 0; i < count; i++) {
-			pdata[i] = begin_ptr + i * state.size();
+			pdata[i] = begin_ptr + i * state_size;
 		}
 		v.Verify(count);
 		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
@@ -124,93 +170,109 @@ void WindowSegmentTree::WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end)
 	}
 }
 
-void WindowSegmentTree::ConstructTree() {
-	D_ASSERT(input_ref);
-	D_ASSERT(inputs.ColumnCount() > 0);
+void WindowSegmentTree::ConstructNode(WindowSegmentTreeState &lstate, idx_t node_idx) {
+	// find the level of the node: level 0 is the data itself, so the nodes start at level 1
+	idx_t level_current = 0;
+	while (levels_flat_start[level_current + 1] <= node_idx) {
+		level_current++;
+	}
+	const auto level_size = level_current == 0
+	                            ? input_ref->size()
+	                            : levels_flat_start[level_current] - levels_flat_start[level_current - 1];
+	const auto pos = (node_idx - levels_flat_start[level_current]) * TREE_FANOUT;
 
-	// compute space required to store internal nodes of segment tree
-	internal_nodes = 0;
-	idx_t level_nodes = input_ref->size();
-	do {
-		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
-		internal_nodes += level_nodes;
-	} while (level_nodes > 1);
-	levels_flat_native = unique_ptr<data_t[]>(new data_t[internal_nodes * state.size()]);
-	levels_flat_start.push_back(0);
+	// the node combines the nodes of the level below, which have to be computed first
+	WaitForNodes(levels_flat_start[level_current]);
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size = (level_current == 0 ? input_ref->size()
-	                                         : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			AggregateInit();
-			WindowSegmentValue(level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
-
-			memcpy(levels_flat_native.get() + (levels_flat_offset * state.size()), state.data(), state.size());
-
-			levels_flat_offset++;
-		}
+	// compute the aggregate for this entry in the segment tree
+	try {
+		AggregateInit(lstate);
+		WindowSegmentValue(lstate, level_current, pos, MinValue(level_size, pos + TREE_FANOUT));
+	} catch (...) {
+		lock_guard<mutex> guard(build_lock);
+		build_failed = true;
+		build_progress.notify_all();
+		throw;
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	memcpy(levels_flat_native.get() + (node_idx * state_size), lstate.state.data(), state_size);
+	lock_guard<mutex> guard(build_lock);
+	++build_completed;
+	build_progress.notify_all();
+}
+
+void WindowSegmentTree::WaitForNodes(idx_t node_count) {
+	// nodes are claimed in level order, so once node_count nodes are computed, these are the first node_count nodes
+	unique_lock<mutex> guard(build_lock);
+	build_progress.wait(guard, [&]() { return build_completed >= node_count || build_failed; });
+	if (build_completed < node_count) {
+		throw InternalException("Another thread failed to build the window segment tree");
 	}
+}
 
-	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
-		aggregate.initialize(levels_flat_native.get());
+void WindowSegmentTree::ConstructTree(WindowSegmentTreeState &lstate) {
+	if (!HasTree()) {
+		return;
 	}
+	D_ASSERT(lstate.inputs.ColumnCount() > 0);
+
+	// nodes are claimed in level order, so the nodes a claimed node depends on are always being computed
+	for (auto node_idx = build_next++; node_idx < build_nodes; node_idx = build_next++) {
+		ConstructNode(lstate, node_idx);
+	}
+
+	// wait for the nodes that other threads are still computing
+	WaitForNodes(build_nodes);
 }
 
-void WindowSegmentTree::Compute(Vector &result, idx_t rid, idx_t begin, idx_t end) {
+void WindowSegmentTree::Compute(WindowSegmentTreeState &lstate, Vector &result, idx_t rid, idx_t begin,
+                                idx_t end) const {
 	D_ASSERT(input_ref);
 
 	// If we have a window function, use that
-	if (aggregate.window && UseWindowAPI()) {
+	if (HasWindowAPI()) {
 		// Frame boundaries
-		auto prev = frame;
-		frame = FrameBounds(begin, end);
+		auto prev = lstate.frame;
+		lstate.frame = FrameBounds(begin, end);
 
 		// Extract the range
 		AggregateInputData aggr_input_data(bind_info, Allocator::DefaultAllocator());
-		aggregate.window(input_ref->data.data(), filter_mask, aggr_input_data, inputs.ColumnCount(), state.data(),
-		                 frame, prev, result, rid, 0);
+		aggregate.window(input_ref->data.data(), filter_mask, aggr_input_data, input_ref->ColumnCount(),
+		                 input_ref->size(), gstate.data(), lstate.state.data(), lstate.frame, prev, result, rid, 0);
 		return;
 	}
 
-	AggregateInit();
+	AggregateInit(lstate);
 
 	// Aggregate everything at once if we can't combine states
-	if (!aggregate.combine || !UseCombineAPI()) {
-		WindowSegmentValue(0, begin, end);
-		AggegateFinal(result, rid);
+	if (!HasTree()) {
+		WindowSegmentValue(lstate, 0, begin, end);
+		AggegateFinal(lstate, result, rid);
 		return;
 	}
 
+	D_ASSERT(build_completed == build_nodes);
 	for (idx_t l_idx = 0; l_idx < levels_flat_start.size() + 1; l_idx++) {
 		idx_t parent_begin = begin / TREE_FANOUT;
 		idx_t parent_end = end / TREE_FANOUT;
 		if (parent_begin == parent_end) {
-			WindowSegmentValue(l_idx, begin, end);
+			WindowSegmentValue(lstate, l_idx, begin, end);
 			break;
 		}
 		idx_t group_begin = parent_begin * TREE_FANOUT;
 		if (begin != group_begin) {
-			WindowSegmentValue(l_idx, begin, group_begin + TREE_FANOUT);
+			WindowSegmentValue(lstate, l_idx, begin, group_begin + TREE_FANOUT);
 			parent_begin++;
 		}
 		idx_t group_end = parent_end * TREE_FANOUT;
 		if (end != group_end) {
-			WindowSegmentValue(l_idx, group_end, end);
+			WindowSegmentValue(lstate, l_idx, group_end, end);
 		}
 		begin = parent_begin;
 		end = parent_end;
 	}
 
-	AggegateFinal(result, rid);
+	AggegateFinal(lstate, result, rid);
 }
 
 } // namespace duckdb
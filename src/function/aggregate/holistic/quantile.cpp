@@ -8,6 +8,8 @@
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/queue.hpp"
 #include "duckdb/common/field_writer.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/execution/merge_sort_tree.hpp"
 
 #include <algorithm>
 #include <stdlib.h>
@@ -37,6 +39,8 @@ inline interval_t operator-(const interval_t &lhs, const interval_t &rhs) {
 
 using FrameBounds = std::pair<idx_t, idx_t>;
 
+struct QuantileSortTree;
+
 template <typename SAVE_TYPE>
 struct QuantileState {
 	using SaveType = SAVE_TYPE;
@@ -51,7 +55,14 @@ struct QuantileState {
 	// Windowed MAD indirection
 	std::vector<idx_t> m;
 
-	QuantileState() : pos(0) {
+	// Windowed Quantile order statistics for large frames (only built in the shared state of a partition, by the first
+	// frame that needs them)
+	mutable mutex qst_lock;
+	mutable unique_ptr<QuantileSortTree> qst;
+	// Whether the frames of this state are computed with the shared order statistics
+	bool use_qst;
+
+	QuantileState() : pos(0), use_qst(false) {
 	}
 
 	~QuantileState() {
@@ -313,6 +324,17 @@ struct Interpolator {
 		}
 	}
 
+	template <class INPUT_TYPE, class TARGET_TYPE>
+	TARGET_TYPE Extract(const INPUT_TYPE &lo_data, const INPUT_TYPE &hi_data, Vector &result) const {
+		if (CRN == FRN) {
+			return CastInterpolation::Cast<INPUT_TYPE, TARGET_TYPE>(lo_data, result);
+		} else {
+			auto lo = CastInterpolation::Cast<INPUT_TYPE, TARGET_TYPE>(lo_data, result);
+			auto hi = CastInterpolation::Cast<INPUT_TYPE, TARGET_TYPE>(hi_data, result);
+			return CastInterpolation::Interpolate<TARGET_TYPE>(lo, RN - FRN, hi);
+		}
+	}
+
 	const bool desc;
 	const double RN;
 	const idx_t FRN;
@@ -365,6 +387,11 @@ struct Interpolator<true> {
 		return CastInterpolation::Cast<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[FRN]), result);
 	}
 
+	template <class INPUT_TYPE, class TARGET_TYPE>
+	TARGET_TYPE Extract(const INPUT_TYPE &lo_data, const INPUT_TYPE &hi_data, Vector &result) const {
+		return CastInterpolation::Cast<INPUT_TYPE, TARGET_TYPE>(lo_data, result);
+	}
+
 	const bool desc;
 	const idx_t FRN;
 	const idx_t CRN;
@@ -373,6 +400,73 @@ struct Interpolator<true> {
 	idx_t end;
 };
 
+//	Order statistics over all the rows of a partition, which answers the quantiles of any frame in O(log^2 n).
+//	Maintaining the frame indexes costs O(frame) per row when the frame does not slide by one row,
+//	so large frames switch to this instead.
+struct QuantileSortTree {
+	//	The frame size from which the tree is built
+	static constexpr const idx_t FRAME_THRESHOLD = 4096;
+
+	template <typename INPUT_TYPE>
+	QuantileSortTree(const INPUT_TYPE *data, const QuantileIncluded &included, idx_t count, idx_t bias_p)
+	    : bias(bias_p) {
+		if (count <= NumericLimits<uint32_t>::Maximum()) {
+			index32 = Build<uint32_t>(data, included, count);
+		} else {
+			index64 = Build<uint64_t>(data, included, count);
+		}
+	}
+
+	//	The number of rows of the frame that are included
+	idx_t Count(const FrameBounds &frame) const {
+		if (index32) {
+			return index32->Count(frame.first - bias, frame.second - bias);
+		} else {
+			return index64->Count(frame.first - bias, frame.second - bias);
+		}
+	}
+
+	//	The row of the frame with the n-th smallest included value
+	idx_t SelectNth(const FrameBounds &frame, idx_t n) const {
+		if (index32) {
+			return bias + index32->SelectNth(frame.first - bias, frame.second - bias, n);
+		} else {
+			return bias + index64->SelectNth(frame.first - bias, frame.second - bias, n);
+		}
+	}
+
+	template <typename INPUT_TYPE, typename RESULT_TYPE, bool DISCRETE>
+	RESULT_TYPE WindowScalar(const INPUT_TYPE *data, const FrameBounds &frame, const idx_t n, Vector &result,
+	                         const Value &q) const {
+		D_ASSERT(n > 0);
+		Interpolator<DISCRETE> interp(q, n, false);
+		const auto lo_idx = SelectNth(frame, interp.FRN);
+		const auto hi_idx = (interp.CRN == interp.FRN) ? lo_idx : SelectNth(frame, interp.CRN);
+		return interp.template Extract<INPUT_TYPE, RESULT_TYPE>(data[lo_idx], data[hi_idx], result);
+	}
+
+	template <typename E, typename INPUT_TYPE>
+	unique_ptr<MergeSortTree<E>> Build(const INPUT_TYPE *data, const QuantileIncluded &included, idx_t count) {
+		vector<E> lowest;
+		lowest.reserve(count);
+		for (idx_t i = 0; i < count; ++i) {
+			if (included(bias + i)) {
+				lowest.emplace_back(E(i));
+			}
+		}
+		using ID = QuantileIndirect<INPUT_TYPE>;
+		ID indirect(data + bias);
+		QuantileCompare<ID> lt(indirect, false);
+		std::sort(lowest.begin(), lowest.end(), lt);
+		return make_unique<MergeSortTree<E>>(std::move(lowest));
+	}
+
+	//	The offset of the first row in the data
+	const idx_t bias;
+	unique_ptr<MergeSortTree<uint32_t>> index32;
+	unique_ptr<MergeSortTree<uint64_t>> index64;
+};
+
 template <typename T>
 static inline T QuantileAbs(const T &t) {
 	return AbsOperator::Operation<T, T>(t);
@@ -484,6 +578,26 @@ struct QuantileOperation {
 	static bool IgnoreNull() {
 		return true;
 	}
+
+	//	The sort tree of the partition once the frames get large. The first frame that needs it builds it in the
+	//	shared state, so all the threads use the same tree. It is used from then on: the frame indexes of the state
+	//	are not maintained for the frames that use the tree, so they cannot be reused for the frames after them.
+	template <class STATE, class INPUT_TYPE>
+	static const QuantileSortTree *GetSortTree(const STATE *gstate, STATE *state, const INPUT_TYPE *data,
+	                                           const QuantileIncluded &included, idx_t count, const FrameBounds &frame,
+	                                           idx_t bias) {
+		if (!state->use_qst) {
+			if (frame.second - frame.first < QuantileSortTree::FRAME_THRESHOLD) {
+				return nullptr;
+			}
+			lock_guard<mutex> guard(gstate->qst_lock);
+			if (!gstate->qst) {
+				gstate->qst = make_unique<QuantileSortTree>(data, included, count, bias);
+			}
+			state->use_qst = true;
+		}
+		return gstate->qst.get();
+	}
 };
 
 template <class STATE_TYPE, class RESULT_TYPE, class OP>
@@ -548,13 +662,30 @@ struct QuantileScalarOperation : public QuantileOperation {
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
-	                   AggregateInputData &aggr_input_data, STATE *state, const FrameBounds &frame,
-	                   const FrameBounds &prev, Vector &result, idx_t ridx, idx_t bias) {
+	                   AggregateInputData &aggr_input_data, idx_t count, const STATE *gstate, STATE *state,
+	                   const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t ridx, idx_t bias) {
 		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
 		auto &rmask = FlatVector::Validity(result);
 
 		QuantileIncluded included(fmask, dmask, bias);
 
+		D_ASSERT(aggr_input_data.bind_data);
+		auto bind_data = (QuantileBindData *)aggr_input_data.bind_data;
+
+		// Find the two positions needed
+		const auto q = bind_data->quantiles[0];
+
+		auto qst = GetSortTree(gstate, state, data, included, count, frame, bias);
+		if (qst) {
+			const auto n = qst->Count(frame);
+			if (n) {
+				rdata[ridx] = qst->template WindowScalar<INPUT_TYPE, RESULT_TYPE, DISCRETE>(data, frame, n, result, q);
+			} else {
+				rmask.Set(ridx, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		auto prev_pos = state->pos;
 		state->SetPos(frame.second - frame.first);
@@ -562,12 +693,6 @@ struct QuantileScalarOperation : public QuantileOperation {
 		auto index = state->w.data();
 		D_ASSERT(index);
 
-		D_ASSERT(aggr_input_data.bind_data);
-		auto bind_data = (QuantileBindData *)aggr_input_data.bind_data;
-
-		// Find the two positions needed
-		const auto q = bind_data->quantiles[0];
-
 		bool replace = false;
 		if (frame.first == prev.first + 1 && frame.second == prev.second + 1) {
 			//  Fixed frame size
@@ -697,8 +822,8 @@ struct QuantileListOperation : public QuantileOperation {
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
-	                   AggregateInputData &aggr_input_data, STATE *state, const FrameBounds &frame,
-	                   const FrameBounds &prev, Vector &list, idx_t lidx, idx_t bias) {
+	                   AggregateInputData &aggr_input_data, idx_t count, const STATE *gstate, STATE *state,
+	                   const FrameBounds &frame, const FrameBounds &prev, Vector &list, idx_t lidx, idx_t bias) {
 		D_ASSERT(aggr_input_data.bind_data);
 		auto bind_data = (QuantileBindData *)aggr_input_data.bind_data;
 
@@ -716,6 +841,21 @@ struct QuantileListOperation : public QuantileOperation {
 		auto &result = ListVector::GetEntry(list);
 		auto rdata = FlatVector::GetData<CHILD_TYPE>(result);
 
+		auto qst = GetSortTree(gstate, state, data, included, count, frame, bias);
+		if (qst) {
+			const auto n = qst->Count(frame);
+			if (n) {
+				for (const auto &q : bind_data->order) {
+					const auto &quantile = bind_data->quantiles[q];
+					rdata[lentry.offset + q] =
+					    qst->template WindowScalar<INPUT_TYPE, CHILD_TYPE, DISCRETE>(data, frame, n, result, quantile);
+				}
+			} else {
+				lmask.Set(lidx, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		auto prev_pos = state->pos;
 		state->SetPos(frame.second - frame.first);
@@ -1049,8 +1189,8 @@ struct MedianAbsoluteDeviationOperation : public QuantileOperation {
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &fmask, const ValidityMask &dmask,
-	                   AggregateInputData &, STATE *state, const FrameBounds &frame, const FrameBounds &prev,
-	                   Vector &result, idx_t ridx, idx_t bias) {
+	                   AggregateInputData &, idx_t count, const STATE *gstate, STATE *state,
+	                   const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t ridx, idx_t bias) {
 		auto rdata = FlatVector::GetData<RESULT_TYPE>(result);
 		auto &rmask = FlatVector::Validity(result);
 
@@ -255,6 +255,8 @@ bool ArrowTableFunction::ArrowScanParallelStateNext(ClientContext &context, cons
 		current_chunk = parallel_state.stream->GetNextChunk();
 	}
 	state.chunk = std::move(current_chunk);
+	//! every array carries its own dictionaries
+	state.arrow_dictionary_vectors.clear();
 	//! have we run out of chunks? we are done
 	if (!state.chunk->arrow_array.release) {
 		parallel_state.done = true;
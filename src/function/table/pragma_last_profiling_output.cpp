@@ -43,16 +43,25 @@ static unique_ptr<FunctionData> PragmaLastProfilingOutputBind(ClientContext &con
 	names.emplace_back("DESCRIPTION");
 	return_types.emplace_back(LogicalType::VARCHAR);
 
+	// the hardware counters are NULL unless they were collected (see enable_hardware_counters)
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		names.emplace_back(StringUtil::Upper(HardwareCounterValues::GetName(i)));
+		return_types.emplace_back(LogicalType::BIGINT);
+	}
+
 	return make_unique<PragmaLastProfilingOutputData>(return_types);
 }
 
 static void SetValue(DataChunk &output, int index, int op_id, string name, double time, int64_t car,
-                     string description) {
+                     string description, const OperatorInformation &info) {
 	output.SetValue(0, index, op_id);
 	output.SetValue(1, index, std::move(name));
 	output.SetValue(2, index, time);
 	output.SetValue(3, index, car);
 	output.SetValue(4, index, std::move(description));
+	for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+		output.SetValue(5 + i, index, info.has_counters ? Value::BIGINT(info.counters.values[i]) : Value());
+	}
 }
 
 unique_ptr<GlobalTableFunctionState> PragmaLastProfilingOutputInit(ClientContext &context,
@@ -74,7 +83,7 @@ static void PragmaLastProfilingOutputFunction(ClientContext &context, TableFunct
 			for (auto op :
 			     ClientData::Get(context).query_profiler_history->GetPrevProfilers().back().second->GetTreeMap()) {
 				SetValue(chunk, chunk.size(), operator_counter++, op.second->name, op.second->info.time,
-				         op.second->info.elements, " ");
+				         op.second->info.elements, " ", op.second->info);
 				chunk.SetCardinality(chunk.size() + 1);
 				if (chunk.size() == STANDARD_VECTOR_SIZE) {
 					collection->Append(chunk);
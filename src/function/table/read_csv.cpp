@@ -5,6 +5,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/union_by_name.hpp"
+#include "duckdb/execution/operator/persistent/csv_record_scanner.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
@@ -256,7 +257,7 @@ struct ParallelCSVGlobalState : public GlobalTableFunctionState {
 public:
 	ParallelCSVGlobalState(ClientContext &context, unique_ptr<CSVFileHandle> file_handle_p,
 	                       vector<string> &files_path_p, idx_t system_threads_p, idx_t buffer_size_p,
-	                       idx_t rows_to_skip, bool force_parallelism_p)
+	                       idx_t rows_to_skip, bool force_parallelism_p, const BufferedCSVReaderOptions &options)
 	    : file_handle(std::move(file_handle_p)), system_threads(system_threads_p), buffer_size(buffer_size_p),
 	      force_parallelism(force_parallelism_p) {
 		current_file_path = files_path_p[0];
@@ -272,6 +273,8 @@ public:
 		current_buffer = make_shared<CSVBuffer>(context, buffer_size, *file_handle, current_csv_position);
 		next_buffer = current_buffer->Next(*file_handle, buffer_size, current_csv_position);
 		running_threads = MaxThreads();
+		record_scanner = make_unique<CSVRecordScanner>(options.delimiter[0], options.quote[0], options.escape[0]);
+		scan_position = current_buffer->GetStart();
 	}
 	ParallelCSVGlobalState() {
 	}
@@ -293,6 +296,14 @@ public:
 
 	bool Finished();
 
+	//! Finds the start of the first record after the given position of the current buffer
+	idx_t FindRecordStart(idx_t position);
+	//! Advances the record scanner up to the given position, relative to the current buffer. If find_record is set,
+	//! it stops at the first record boundary instead. Returns false if no record boundary was found.
+	bool ScanRecords(idx_t end, bool find_record);
+	//! Returns the character at the given position of the current (and next) buffer, or '\0' if there is none
+	char GetCharacter(idx_t position);
+
 	//! How many bytes were read up to this point
 	atomic<idx_t> bytes_read;
 	//! Size of current file
@@ -351,6 +362,12 @@ private:
 	vector<idx_t> tuple_end;
 	set<idx_t> tuple_start;
 	idx_t running_threads = 0;
+	//! Follows the quoting state of the current file, to split it in pieces at the exact start of records
+	unique_ptr<CSVRecordScanner> record_scanner;
+	//! The position (relative to the current buffer) up to which the record scanner has scanned
+	idx_t scan_position = 0;
+	//! Whether or not the scan position is the start of a record
+	bool scan_at_record_start = true;
 };
 
 idx_t ParallelCSVGlobalState::MaxThreads() const {
@@ -410,6 +427,64 @@ void ParallelCSVGlobalState::Verify() {
 	}
 }
 
+bool ParallelCSVGlobalState::ScanRecords(idx_t end, bool find_record) {
+	CSVBuffer *buffers[] = {current_buffer.get(), next_buffer.get()};
+	idx_t buffer_offset = 0;
+	for (auto buffer : buffers) {
+		if (!buffer) {
+			break;
+		}
+		auto buffer_end = buffer_offset + buffer->GetBufferSize();
+		if (scan_position < buffer_end && scan_position < end) {
+			auto scan_end = MinValue<idx_t>(end, buffer_end);
+			idx_t record_start;
+			if (record_scanner->Scan(buffer->Ptr(), scan_position - buffer_offset, scan_end - buffer_offset,
+			                         find_record, record_start)) {
+				scan_position = buffer_offset + record_start;
+				scan_at_record_start = true;
+				return true;
+			}
+			scan_position = scan_end;
+			scan_at_record_start = false;
+		}
+		buffer_offset = buffer_end;
+	}
+	return false;
+}
+
+idx_t ParallelCSVGlobalState::FindRecordStart(idx_t position) {
+	// a record that starts exactly at the position is read by the previous piece, which finishes the line that ends
+	// at its end, so that record is skipped here (see the final state of ParallelCSVReader::TryParseSimpleCSV)
+	if (scan_position > position && scan_at_record_start) {
+		// the first record after the previous piece also is the first record after this position
+		return scan_position;
+	}
+	if (scan_position < position) {
+		ScanRecords(position, false);
+	}
+	// the first record starts after the first newline that is not inside quotes
+	if (!ScanRecords(NumericLimits<idx_t>::Maximum(), true)) {
+		// the record that covers this position does not end before the end of the next buffer (or the file)
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// a \r\n newline ends the record after the \n
+	if (GetCharacter(scan_position - 1) == '\r' && GetCharacter(scan_position) == '\n') {
+		scan_position++;
+	}
+	return scan_position;
+}
+
+char ParallelCSVGlobalState::GetCharacter(idx_t position) {
+	auto current_size = current_buffer->GetBufferSize();
+	if (position < current_size) {
+		return current_buffer->Ptr()[position];
+	}
+	if (next_buffer && position - current_size < next_buffer->GetBufferSize()) {
+		return next_buffer->Ptr()[position - current_size];
+	}
+	return '\0';
+}
+
 unique_ptr<CSVBufferRead> ParallelCSVGlobalState::Next(ClientContext &context, ReadCSVData &bind_data) {
 	lock_guard<mutex> parallel_lock(main_mutex);
 	if (!current_buffer) {
@@ -420,6 +495,9 @@ unique_ptr<CSVBufferRead> ParallelCSVGlobalState::Next(ClientContext &context, R
 			current_csv_position = 0;
 			current_buffer = make_shared<CSVBuffer>(context, buffer_size, *file_handle, current_csv_position);
 			next_buffer = current_buffer->Next(*file_handle, buffer_size, current_csv_position);
+			record_scanner->Reset();
+			scan_position = current_buffer->GetStart();
+			scan_at_record_start = true;
 		} else {
 			// We are done scanning.
 			return nullptr;
@@ -428,12 +506,21 @@ unique_ptr<CSVBufferRead> ParallelCSVGlobalState::Next(ClientContext &context, R
 	// set up the current buffer
 	auto result = make_unique<CSVBufferRead>(current_buffer, next_buffer, next_byte, next_byte + bytes_per_local_state,
 	                                         batch_index++, estimated_linenr);
+	if (next_byte > 0 || !current_buffer->IsCSVFileFirstBuffer()) {
+		// the first piece of a file starts at the first record (or the header) and is set up by the reader itself
+		result->has_record_start = true;
+		result->record_start = FindRecordStart(next_byte);
+	}
 	// move the byte index of the CSV reader to the next buffer
 	next_byte += bytes_per_local_state;
 	estimated_linenr += bytes_per_local_state / (bind_data.sql_types.size() * 5); // estimate 5 bytes per column
 	if (next_byte >= current_buffer->GetBufferSize()) {
 		// We replace the current buffer with the next buffer
 		next_byte = 0;
+		if (scan_position < current_buffer->GetBufferSize()) {
+			ScanRecords(current_buffer->GetBufferSize(), false);
+		}
+		scan_position -= current_buffer->GetBufferSize();
 		bytes_read += current_buffer->GetBufferSize();
 		current_buffer = next_buffer;
 		if (next_buffer) {
@@ -469,7 +556,8 @@ static unique_ptr<GlobalTableFunctionState> ParallelCSVInitGlobal(ClientContext
 	    bind_data.options.skip_rows + (bind_data.options.has_header && bind_data.options.header ? 1 : 0);
 	return make_unique<ParallelCSVGlobalState>(context, std::move(file_handle), bind_data.files,
 	                                           context.db->NumberOfThreads(), bind_data.options.buffer_size,
-	                                           rows_to_skip, ClientConfig::GetConfig(context).verify_parallelism);
+	                                           rows_to_skip, ClientConfig::GetConfig(context).verify_parallelism,
+	                                           bind_data.options);
 }
 
 //===--------------------------------------------------------------------===//
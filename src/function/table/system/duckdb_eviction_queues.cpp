@@ -0,0 +1,66 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBEvictionQueuesData : public GlobalTableFunctionState {
+	DuckDBEvictionQueuesData() : offset(0) {
+	}
+
+	vector<EvictionQueueInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBEvictionQueuesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("queue");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBEvictionQueuesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_unique<DuckDBEvictionQueuesData>();
+
+	result->entries = BufferManager::GetBufferManager(context).GetEvictionQueues();
+	return std::move(result);
+}
+
+void DuckDBEvictionQueuesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = (DuckDBEvictionQueuesData &)*data_p.global_state;
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		idx_t col = 0;
+		// queue, VARCHAR
+		output.SetValue(col++, count, Value(entry.queue));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.hits));
+		// misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.misses));
+		// evictions, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.evictions));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBEvictionQueuesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_eviction_queues", {}, DuckDBEvictionQueuesFunction, DuckDBEvictionQueuesBind,
+	                              DuckDBEvictionQueuesInit));
+}
+
+} // namespace duckdb
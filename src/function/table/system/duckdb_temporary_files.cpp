@@ -19,6 +19,12 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("bytes_written");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_read");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -46,6 +52,10 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(entry.size));
+		// bytes_written, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.bytes_written));
+		// bytes_read, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(entry.bytes_read));
 		count++;
 	}
 	output.SetCardinality(count);
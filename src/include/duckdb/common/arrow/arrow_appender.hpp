@@ -15,11 +15,14 @@ struct ArrowSchema;
 namespace duckdb {
 
 struct ArrowAppendData;
+struct ClientProperties;
 
 //! The ArrowAppender class can be used to incrementally construct an arrow array by appending data chunks into it
 class ArrowAppender {
 public:
 	DUCKDB_API ArrowAppender(vector<LogicalType> types, idx_t initial_capacity);
+	//! Creates an appender whose arrays match ArrowConverter::ToArrowSchema with the same client properties
+	DUCKDB_API ArrowAppender(vector<LogicalType> types, idx_t initial_capacity, const ClientProperties &options);
 	DUCKDB_API ~ArrowAppender();
 
 	//! Append a data chunk to the underlying arrow array
@@ -14,10 +14,14 @@
 struct ArrowSchema;
 
 namespace duckdb {
+struct ClientProperties;
 
 struct ArrowConverter {
 	DUCKDB_API static void ToArrowSchema(ArrowSchema *out_schema, vector<LogicalType> &types, vector<string> &names,
 	                                     string &config_timezone);
+	//! Creates the schema of arrays that are appended with the given client properties (see ArrowAppender)
+	DUCKDB_API static void ToArrowSchema(ArrowSchema *out_schema, vector<LogicalType> &types, vector<string> &names,
+	                                     const ClientProperties &options);
 	DUCKDB_API static void ToArrowArray(DataChunk &input, ArrowArray *out_array);
 };
 
@@ -24,6 +24,7 @@ enum class CompressionType : uint8_t {
 	COMPRESSION_FSST = 7,
 	COMPRESSION_CHIMP = 8,
 	COMPRESSION_PATAS = 9,
+	COMPRESSION_ALP = 10,
 	COMPRESSION_COUNT // This has to stay the last entry of the type!
 };
 
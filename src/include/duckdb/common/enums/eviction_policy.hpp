@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy that the buffer manager uses to pick the blocks to evict
+enum class EvictionPolicy : uint8_t {
+	//! Evict the least recently used block
+	LRU = 0,
+	//! Scan-resistant 2Q: blocks that are referenced once are evicted before blocks that are referenced again, and
+	//! temporary blocks are kept in a separate queue
+	TWO_QUEUE = 1
+};
+
+//! The eviction queues of the buffer manager, in the order in which they are evicted from
+enum class EvictionQueueType : uint8_t {
+	//! (2Q) Persistent blocks that have been referenced once
+	PROBATIONARY = 0,
+	//! (LRU) All blocks
+	LRU = 1,
+	//! (2Q) Persistent blocks that have been referenced again after they were evicted from the probationary queue
+	PROTECTED = 2,
+	//! (2Q) Temporary blocks, which have to be written to the temporary directory when they are evicted
+	TEMPORARY = 3
+};
+
+static constexpr const idx_t EVICTION_QUEUE_COUNT = 4;
+
+string EvictionPolicyToString(EvictionPolicy policy);
+EvictionPolicy EvictionPolicyFromString(const string &policy);
+string EvictionQueueTypeToString(EvictionQueueType type);
+
+} // namespace duckdb
@@ -81,6 +81,19 @@ public:
 	string path;
 };
 
+//! A read of nr_bytes at the specified location of a file into the buffer, as part of a batch of reads
+struct FileReadRequest {
+	FileReadRequest() : buffer(nullptr), nr_bytes(0), location(0) {
+	}
+	FileReadRequest(void *buffer, int64_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	void *buffer;
+	int64_t nr_bytes;
+	idx_t location;
+};
+
 enum class FileLockType : uint8_t { NO_LOCK = 0, READ_LOCK = 1, WRITE_LOCK = 2 };
 
 class FileFlags {
@@ -125,6 +138,10 @@ public:
 	//! Read nr_bytes from the specified file into the buffer, moving the file pointer forward by nr_bytes. Returns the
 	//! amount of bytes read.
 	DUCKDB_API virtual int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes);
+	//! Read a batch of ranges (each exactly) from the file. The reads of the batch are all issued before any of them
+	//! is waited for, where the file system supports that, and the call returns once all of them have completed. The
+	//! default implementation reads the ranges one after the other.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count);
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	DUCKDB_API virtual int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes);
 
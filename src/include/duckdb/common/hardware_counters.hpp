@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The hardware events that are counted when profiling with hardware counters
+enum class HardwareCounterType : uint8_t {
+	CYCLES = 0,
+	INSTRUCTIONS = 1,
+	LLC_MISSES = 2,
+	BRANCH_MISSES = 3,
+	DTLB_MISSES = 4
+};
+
+//! A snapshot (or difference of snapshots) of the hardware counters of a thread
+struct HardwareCounterValues {
+	static constexpr const idx_t COUNTER_COUNT = 5;
+
+	HardwareCounterValues() {
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			values[i] = 0;
+		}
+	}
+
+	uint64_t values[COUNTER_COUNT];
+
+	uint64_t Get(HardwareCounterType type) const {
+		return values[uint8_t(type)];
+	}
+	HardwareCounterValues &operator+=(const HardwareCounterValues &other) {
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			values[i] += other.values[i];
+		}
+		return *this;
+	}
+	//! Returns the difference between this (later) snapshot and an earlier snapshot
+	HardwareCounterValues Difference(const HardwareCounterValues &start) const {
+		HardwareCounterValues result;
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			result.values[i] = values[i] >= start.values[i] ? values[i] - start.values[i] : 0;
+		}
+		return result;
+	}
+
+	//! The name of a counter, as used in the profiling output
+	DUCKDB_API static const char *GetName(idx_t counter);
+};
+
+//! HardwareCounters reads the CPU performance counters (cycles, instructions, LLC misses, branch misses and dTLB
+//! misses) of the calling thread. The counters are opened through perf_event_open on Linux; on other platforms, or if
+//! the kernel does not allow user-space counting (see /proc/sys/kernel/perf_event_paranoid), no counters are
+//! available.
+class HardwareCounters {
+public:
+	HardwareCounters();
+	~HardwareCounters();
+
+	//! Returns the counters of the calling thread, which are opened on first use
+	DUCKDB_API static HardwareCounters &Get();
+
+	//! Whether or not any counters could be opened
+	bool IsAvailable() const {
+		return group_fd >= 0;
+	}
+	//! Whether or not a specific counter could be opened
+	bool IsAvailable(idx_t counter) const {
+		return fds[counter] >= 0;
+	}
+	//! Reads the current values of the counters; counters that are not available read as 0
+	DUCKDB_API void Read(HardwareCounterValues &result);
+
+private:
+	//! The file descriptor of the group leader, or -1 if counters are not available
+	int group_fd;
+	//! The file descriptors of the individual counters, or -1 if a counter could not be opened
+	int fds[HardwareCounterValues::COUNTER_COUNT];
+	//! The position of every opened counter in the group read buffer
+	idx_t read_index[HardwareCounterValues::COUNTER_COUNT];
+	//! The amount of counters in the group
+	idx_t open_count;
+};
+
+} // namespace duckdb
@@ -23,6 +23,8 @@ public:
 	atomic<idx_t> post_count {0};
 	atomic<idx_t> total_bytes_received {0};
 	atomic<idx_t> total_bytes_sent {0};
+	atomic<idx_t> cache_hit_count {0};
+	atomic<idx_t> cache_miss_count {0};
 
 	void Reset() {
 		head_count = 0;
@@ -31,6 +33,8 @@ public:
 		post_count = 0;
 		total_bytes_received = 0;
 		total_bytes_sent = 0;
+		cache_hit_count = 0;
+		cache_miss_count = 0;
 	}
 
 	//! helper function to get the HTTP
@@ -44,7 +48,7 @@ public:
 
 	bool IsEmpty() {
 		return head_count == 0 && get_count == 0 && put_count == 0 && post_count == 0 && total_bytes_received == 0 &&
-		       total_bytes_sent == 0;
+		       total_bytes_sent == 0 && cache_hit_count == 0 && cache_miss_count == 0;
 	}
 };
 
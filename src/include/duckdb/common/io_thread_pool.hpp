@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_thread_pool.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+#include <functional>
+
+namespace duckdb {
+struct IOThreadPoolState;
+
+//! The IOThreadPool is a small process-wide pool of threads that issue blocking I/O requests for the batched reads of
+//! the file systems (when io_uring is not available, or for HTTP range requests). The threads are started when they
+//! are first needed and are kept for later batches. The calling thread always takes part in the work, so a batch
+//! completes even if all threads of the pool are busy with other batches.
+class IOThreadPool {
+public:
+	//! The maximum amount of threads in the pool
+	static constexpr const idx_t MAX_THREADS = 8;
+
+	DUCKDB_API static IOThreadPool &Get();
+
+	//! Runs the task for every index in [0, count) on the calling thread and on at most (max_threads - 1) threads of
+	//! the pool, and returns once all of them have finished. If any of the tasks throws, no further tasks are started
+	//! and the first exception is rethrown.
+	DUCKDB_API void Run(idx_t count, idx_t max_threads, const std::function<void(idx_t)> &task);
+
+	~IOThreadPool();
+
+private:
+	IOThreadPool();
+
+	unique_ptr<IOThreadPoolState> state;
+};
+
+} // namespace duckdb
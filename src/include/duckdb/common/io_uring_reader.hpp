@@ -0,0 +1,30 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/io_uring_reader.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+struct FileReadRequest;
+
+//! The IOUringReader reads batches of file ranges through io_uring on Linux: all reads of a batch are submitted to the
+//! kernel at once, after which the calling thread waits for all of them to complete. This keeps many reads in flight
+//! for a single thread, which fast (NVMe) drives need to reach their bandwidth. Every thread has its own ring, which
+//! is set up the first time the thread reads a batch.
+class IOUringReader {
+public:
+	//! Whether or not io_uring can be used on this system
+	static bool IsAvailable();
+	//! Reads all requests from the file descriptor, throwing an IOException if any of the reads fails. Returns false
+	//! without reading anything if io_uring is not available, in which case the caller has to read the requests in
+	//! another way.
+	static bool Read(int fd, const string &path, FileReadRequest requests[], idx_t count);
+};
+
+} // namespace duckdb
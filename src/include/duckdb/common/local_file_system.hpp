@@ -29,6 +29,8 @@ public:
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 	//! Write nr_bytes from the buffer into the file, moving the file pointer forward by nr_bytes.
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	//! Read a batch of ranges from the file: through io_uring where it is available, or from a set of threads
+	void ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) override;
 
 	//! Returns the file size of a file handle, returns -1 on error
 	int64_t GetFileSize(FileHandle &handle) override;
@@ -48,9 +48,13 @@ public:
 		throw NotImplementedException("Cannot create data from this type");
 	}
 
-	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
-		auto len = value.GetSize();
-		memcpy(dataptr, value.GetDataUnsafe(), MinValue(len, prefix_len));
+	//! Encodes prefix_len bytes of the string, after skipping the first skip_len bytes
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len,
+	                                          idx_t skip_len = 0) {
+		D_ASSERT(value.GetSize() >= skip_len);
+		skip_len = MinValue<idx_t>(skip_len, value.GetSize());
+		auto len = value.GetSize() - skip_len;
+		memcpy(dataptr, value.GetDataUnsafe() + skip_len, MinValue(len, prefix_len));
 		if (len < prefix_len) {
 			memset(dataptr + len, '\0', prefix_len - len);
 		}
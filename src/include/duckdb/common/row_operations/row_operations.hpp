@@ -93,9 +93,10 @@ struct RowOperations {
 	// Sorting Operators
 	//===--------------------------------------------------------------------===//
 	//! Scatter vector data to the rows in radix-sortable format.
+	//! The first common_prefix_len bytes of (top-level) strings are shared by all strings and left out of the rows.
 	static void RadixScatter(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t ser_count,
 	                         data_ptr_t key_locations[], bool desc, bool has_null, bool nulls_first, idx_t prefix_len,
-	                         idx_t width, idx_t offset = 0);
+	                         idx_t width, idx_t offset = 0, idx_t common_prefix_len = 0);
 
 	//===--------------------------------------------------------------------===//
 	// Out-of-Core Operators
@@ -28,6 +28,11 @@ public:
 	                        const data_ptr_t &r_ptr, const SortLayout &sort_layout, const bool &external_sort);
 	//! Compare two blob values
 	static int CompareVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type);
+	//! Compare two blob values that were tied by their prefix, skipping the string bytes that the prefix compared
+	static int CompareTiedVal(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type,
+	                          const idx_t &tied_len);
+	//! The number of leading bytes of a blob string that are compared by its prefix (and its common prefix)
+	static idx_t TiedLength(const idx_t &tie_col, const SortLayout &sort_layout);
 
 private:
 	//! Compares two blob values that were initially tied by their prefix
@@ -44,6 +49,8 @@ private:
 	static int TemplatedCompareAndAdvance(data_ptr_t &left_ptr, data_ptr_t &right_ptr);
 	//! Compares two string values at the given pointers
 	static int CompareStringAndAdvance(data_ptr_t &left_ptr, data_ptr_t &right_ptr, bool valid);
+	//! Compares two strings that are known to be equal in their first tied_len bytes
+	static int CompareTiedString(const string_t &left, const string_t &right, idx_t tied_len);
 	//! Compares two struct values at the given pointers (recursive)
 	static int CompareStructAndAdvance(data_ptr_t &left_ptr, data_ptr_t &right_ptr,
 	                                   const child_list_t<LogicalType> &types, bool valid);
@@ -22,6 +22,11 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! The size of the key of a VARCHAR column (including its NULL byte) if its strings do not fit in the key
+	static constexpr idx_t STRING_KEY_SIZE = 12;
+	//! VARCHAR columns with statistics are fully normalized into a key of up to this size, so ties never have to be
+	//! broken by comparing the strings themselves
+	static constexpr idx_t MAX_NORMALIZED_STRING_KEY_SIZE = 32;
 };
 
 struct SortLayout {
@@ -41,6 +46,9 @@ public:
 	vector<bool> constant_size;
 	vector<idx_t> column_sizes;
 	vector<idx_t> prefix_lengths;
+	//! The leading bytes that all strings of a VARCHAR column share according to its statistics, these are not part
+	//! of the key. Only layouts built with the same statistics produce keys that can be compared to each other
+	vector<idx_t> common_prefix_lengths;
 	vector<BaseStatistics *> stats;
 	vector<bool> has_null;
 
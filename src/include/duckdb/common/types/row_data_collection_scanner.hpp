@@ -50,6 +50,10 @@ public:
 	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
 	                         bool flush = true);
 
+	//! Scans only count rows of a single block, starting at entry_idx, so different threads can scan different rows
+	RowDataCollectionScanner(RowDataCollection &rows, RowDataCollection &heap, const RowLayout &layout, bool external,
+	                         idx_t block_idx, idx_t entry_idx, idx_t count, bool flush);
+
 	//! The type layout of the payload
 	inline const vector<LogicalType> &GetTypes() const {
 		return layout.GetTypes();
@@ -92,6 +96,11 @@ private:
 	const RowLayout layout;
 	//! Read state
 	ScanState read_state;
+	//! The blocks that are scanned
+	const idx_t begin_block;
+	const idx_t end_block;
+	//! The first row of the first block that is scanned
+	const idx_t begin_entry;
 	//! The total count of sorted_data
 	const idx_t total_count;
 	//! The number of rows scanned so far
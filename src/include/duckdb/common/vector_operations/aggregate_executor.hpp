@@ -351,12 +351,13 @@ public:
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 	static void UnaryWindow(Vector &input, const ValidityMask &ifilter, AggregateInputData &aggr_input_data,
-	                        data_ptr_t state, const FrameBounds &frame, const FrameBounds &prev, Vector &result,
-	                        idx_t rid, idx_t bias) {
+	                        idx_t count, const_data_ptr_t gstate, data_ptr_t state, const FrameBounds &frame,
+	                        const FrameBounds &prev, Vector &result, idx_t rid, idx_t bias) {
 		auto idata = FlatVector::GetData<const INPUT_TYPE>(input) - bias;
 		const auto &ivalid = FlatVector::Validity(input);
-		OP::template Window<STATE, INPUT_TYPE, RESULT_TYPE>(idata, ifilter, ivalid, aggr_input_data, (STATE *)state,
-		                                                    frame, prev, result, rid, bias);
+		OP::template Window<STATE, INPUT_TYPE, RESULT_TYPE>(idata, ifilter, ivalid, aggr_input_data, count,
+		                                                    (const STATE *)gstate, (STATE *)state, frame, prev,
+		                                                    result, rid, bias);
 	}
 
 	template <class STATE_TYPE, class OP>
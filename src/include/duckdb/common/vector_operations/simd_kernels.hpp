@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/vector_operations/simd_kernels.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+
+enum class SIMDInstructionSet : uint8_t { NONE = 0, AVX2 = 1, AVX512 = 2 };
+
+//! SIMDKernels are hand-written vectorized implementations of hot operations on flat, fixed-width data without NULLs.
+//! The instruction set is detected once at runtime. A kernel returns false if there is no implementation for the
+//! type or the current CPU, in which case the caller has to fall back to its scalar loop.
+struct SIMDKernels {
+	//! The instruction set the kernels dispatch to: the best one supported by this machine, unless overridden
+	DUCKDB_API static SIMDInstructionSet GetInstructionSet();
+	//! The best instruction set supported by this machine
+	DUCKDB_API static SIMDInstructionSet GetSupportedInstructionSet();
+	//! Makes the kernels dispatch to the given instruction set (e.g. to test every kernel on one machine). Throws if
+	//! this machine does not support it; NONE disables the kernels.
+	DUCKDB_API static void SetInstructionSet(SIMDInstructionSet instruction_set);
+
+	//! Selects the rows i in [0, count) for which "data[i] <comparison_type> constant" holds. Either true_sel or
+	//! false_sel can be nullptr. On success, true_count holds the number of matching rows.
+	template <class T>
+	static bool SelectConstant(const T *data, T constant, ExpressionType comparison_type, idx_t count,
+	                           SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count) {
+		return false;
+	}
+
+	//! Computes result[i] = Hash<T>(data[i]) for the rows i in [0, count)
+	template <class T>
+	static bool Hash(const T *data, hash_t *result, idx_t count) {
+		return false;
+	}
+
+	//! The amount of bytes MatchCharacters classifies at once
+	static constexpr const idx_t CHARACTER_BLOCK_SIZE = 64;
+	//! Classifies the bytes data[0, CHARACTER_BLOCK_SIZE) against group_count groups of four characters: bit i of
+	//! masks[g] is set if data[i] equals one of characters[4 * g, 4 * g + 4). Groups of less than four characters
+	//! should repeat one of their characters.
+	DUCKDB_API static bool MatchCharacters(const char *data, const char *characters, idx_t group_count,
+	                                       uint64_t *masks);
+};
+
+template <>
+DUCKDB_API bool SIMDKernels::SelectConstant(const int32_t *data, int32_t constant, ExpressionType comparison_type,
+                                            idx_t count, SelectionVector *true_sel, SelectionVector *false_sel,
+                                            idx_t &true_count);
+template <>
+DUCKDB_API bool SIMDKernels::SelectConstant(const int64_t *data, int64_t constant, ExpressionType comparison_type,
+                                            idx_t count, SelectionVector *true_sel, SelectionVector *false_sel,
+                                            idx_t &true_count);
+template <>
+DUCKDB_API bool SIMDKernels::Hash(const int32_t *data, hash_t *result, idx_t count);
+template <>
+DUCKDB_API bool SIMDKernels::Hash(const int64_t *data, hash_t *result, idx_t count);
+
+} // namespace duckdb
@@ -34,6 +34,10 @@ public:
 		return handle.file_system.Read(handle, buffer, nr_bytes);
 	}
 
+	void ReadBatch(FileHandle &handle, FileReadRequest requests[], idx_t count) override {
+		handle.file_system.ReadBatch(handle, requests, count);
+	}
+
 	int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return handle.file_system.Write(handle, buffer, nr_bytes);
 	}
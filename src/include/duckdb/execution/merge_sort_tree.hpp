@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/merge_sort_tree.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//! A MergeSortTree answers order statistics over ranges of positions, e.g. "which position holds the n-th smallest
+//! value among the positions [lower, upper)", in O(log^2 n) without touching the values themselves.
+//! It is built from the positions in value order: every level splits these into runs of FANOUT^level entries,
+//! and sorts the positions within each run. The last level consists of a single run.
+template <typename E = idx_t, idx_t FANOUT = 32>
+class MergeSortTree {
+public:
+	using Elements = vector<E>;
+
+	//! Builds the tree from the positions ordered by their values
+	explicit MergeSortTree(Elements &&lowest) {
+		const auto count = lowest.size();
+		levels.emplace_back(std::move(lowest));
+		for (idx_t run_size = 1; run_size < count; run_size *= FANOUT) {
+			// every run of the next level is merged from FANOUT runs of the current level
+			Elements level(levels.back());
+			for (idx_t width = run_size; width < run_size * FANOUT && width < count; width *= 2) {
+				for (idx_t begin = 0; begin + width < count; begin += 2 * width) {
+					const auto end = MinValue<idx_t>(begin + 2 * width, count);
+					std::inplace_merge(level.begin() + begin, level.begin() + begin + width, level.begin() + end);
+				}
+			}
+			levels.emplace_back(std::move(level));
+		}
+	}
+
+	//! The number of positions in the tree that lie in [lower, upper)
+	idx_t Count(E lower, E upper) const {
+		return CountRun(levels.back(), 0, levels.back().size(), lower, upper);
+	}
+
+	//! Returns the position with the n-th (0-based) smallest value among the positions in [lower, upper).
+	//! Requires n < Count(lower, upper).
+	E SelectNth(E lower, E upper, idx_t n) const {
+		D_ASSERT(n < Count(lower, upper));
+		// descend from the single run at the top to the run of one entry that contains the n-th position
+		idx_t run_begin = 0;
+		idx_t run_size = 1;
+		for (idx_t level_idx = 1; level_idx < levels.size(); level_idx++) {
+			run_size *= FANOUT;
+		}
+		for (idx_t level_idx = levels.size() - 1; level_idx > 0; level_idx--) {
+			const auto &child_level = levels[level_idx - 1];
+			const auto run_end = MinValue<idx_t>(run_begin + run_size, child_level.size());
+			run_size /= FANOUT;
+			for (; run_begin < run_end; run_begin += run_size) {
+				const auto child_end = MinValue<idx_t>(run_begin + run_size, run_end);
+				const auto child_count = CountRun(child_level, run_begin, child_end, lower, upper);
+				if (n < child_count) {
+					break;
+				}
+				n -= child_count;
+			}
+		}
+		return levels[0][run_begin];
+	}
+
+private:
+	//! Counts the (sorted) positions in run [begin, end) of the level that lie in [lower, upper)
+	static idx_t CountRun(const Elements &level, idx_t begin, idx_t end, E lower, E upper) {
+		auto first = level.begin() + begin;
+		auto last = level.begin() + end;
+		auto lo = std::lower_bound(first, last, lower);
+		return std::lower_bound(lo, last, upper) - lo;
+	}
+
+	//! The levels of the tree, the lowest level holds the positions in value order
+	vector<Elements> levels;
+};
+
+} // namespace duckdb
@@ -52,6 +52,12 @@ namespace duckdb {
             return true;
         }
 
+        //! Whether the probe of this join may be moved within its pipeline: an inner join with a finalized, in-memory
+        //! hash table
+        bool CanReorderProbe() const;
+        //! The number of rows in the hash table, only known once the build side has been finalized
+        idx_t BuildCardinality() const;
+
     protected:
         // CachingOperator Interface
         OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_character_classifier.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The CSVCharacterClassifier finds the next structural character of a CSV buffer for the parser: the end of an
+//! unquoted value (a delimiter or newline), or the end of a quoted value (a quote or escape). Where SIMD is available,
+//! the buffer is classified in blocks of 64 bytes into bitmasks. Consecutive lookups in the same block then only need
+//! a bit scan, which lets the parser jump over all values of a block without inspecting their bytes one by one.
+//! The classified block is identified by its data pointer, so a classifier must not outlive the buffers it scans: the
+//! readers create one per parse call, during which every buffer they read stays alive and unmodified.
+class CSVCharacterClassifier {
+public:
+	CSVCharacterClassifier(char delimiter, char quote, char escape);
+
+	//! Returns the position of the first delimiter or newline in data[position, end), or end if there is none
+	idx_t NextValueEnd(const char *data, idx_t position, idx_t end) {
+		return Next(data, position, end, true);
+	}
+	//! Returns the position of the first quote or escape in data[position, end), or end if there is none
+	idx_t NextQuoteOrEscape(const char *data, idx_t position, idx_t end) {
+		return Next(data, position, end, false);
+	}
+
+private:
+	idx_t Next(const char *data, idx_t position, idx_t end, bool value_end);
+	void ClassifyBlock(const char *data, idx_t position);
+
+	//! Whether or not the blocks are classified with SIMD
+	bool use_simd;
+	//! The structural characters: {delimiter, \n, \r} and {quote, escape}, padded to groups of four
+	char characters[8];
+	//! The characters that end an unquoted and a quoted value, for the scalar scan
+	bool value_end_characters[256];
+	bool quoted_end_characters[256];
+
+	//! The data and position of the currently classified block
+	const char *block_data = nullptr;
+	idx_t block_start = 0;
+	//! The delimiters and newlines (mask 0) and the quotes and escapes (mask 1) in the classified block
+	uint64_t masks[2];
+};
+
+} // namespace duckdb
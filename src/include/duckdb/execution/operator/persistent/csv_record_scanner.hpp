@@ -0,0 +1,61 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/persistent/csv_record_scanner.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! The CSVRecordScanner follows the quoting state of a CSV file without parsing any values. This makes it possible to
+//! find the exact start of the first record after an arbitrary position in the file, even if quoted values contain
+//! newlines: a newline only ends a record if it is not inside quotes.
+class CSVRecordScanner {
+public:
+	CSVRecordScanner(char delimiter, char quote, char escape);
+
+	//! Resets the scanner to the start of a record (i.e. the start of a file)
+	void Reset();
+	//! Scans data[start, end). If find_record is set, the scan stops after the first newline that ends a record, and
+	//! true is returned with the position after that newline in record_start.
+	bool Scan(const char *data, idx_t start, idx_t end, bool find_record, idx_t &record_start);
+
+private:
+	//! Scans a block of 64 bytes at once with SIMD, using the parity of the quotes to find the quoted regions. Returns
+	//! false if the quotes in the block are not all at the start or end of a value, in which case the scanner has to
+	//! follow the block character by character.
+	bool ScanBlock(const char *block, bool find_record, bool &found_record, idx_t &record_offset);
+
+	enum class ScannerState : uint8_t {
+		//! At the start of a value: a quote here starts a quoted value
+		VALUE_START,
+		//! Inside an unquoted value
+		UNQUOTED,
+		//! Inside a quoted value
+		QUOTED,
+		//! Directly after the closing quote of a quoted value (or the first quote of an escaped quote)
+		UNQUOTE,
+		//! Directly after an escape character inside a quoted value
+		ESCAPE
+	};
+
+	ScannerState state;
+	char delimiter;
+	char quote;
+	char escape;
+	//! The characters that end an unquoted value: the delimiter and newlines
+	bool value_end[256];
+	//! Whether or not blocks can be scanned at once: this requires SIMD, and quotes that are escaped by doubling them
+	bool scan_blocks;
+	//! The quote, the delimiter and the newlines, in groups of four for SIMDKernels::MatchCharacters
+	char block_characters[12];
+	//! The position up to which the current data is scanned character by character, after a block failed to scan
+	idx_t scalar_end = 0;
+};
+
+} // namespace duckdb
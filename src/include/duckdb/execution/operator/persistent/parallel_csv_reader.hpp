@@ -89,6 +89,10 @@ struct CSVBufferRead {
 	idx_t buffer_end;
 	idx_t batch_index;
 	idx_t estimated_linenr;
+	//! Whether or not the start of the first record of this piece is known. If it is not, the reader has to find it.
+	bool has_record_start = false;
+	//! The start of the first record of this piece. If it is larger than buffer_end, no record starts in this piece.
+	idx_t record_start = 0;
 };
 
 struct VerificationPositions {
@@ -27,8 +27,21 @@ public:
 
 public:
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
 	void GetData(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
 	             LocalSourceState &lstate) const override;
+	idx_t GetBatchIndex(ExecutionContext &context, DataChunk &chunk, GlobalSourceState &gstate,
+	                    LocalSourceState &lstate) const override;
+
+	//! Only the scans of a materialized CTE are parallel: delim, recursive CTE and VALUES scans run single-threaded
+	bool ParallelSource() const override {
+		return type == PhysicalOperatorType::CTE_SCAN;
+	}
+
+	bool SupportsBatchIndex() const override {
+		return type == PhysicalOperatorType::CTE_SCAN;
+	}
 
 public:
 	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
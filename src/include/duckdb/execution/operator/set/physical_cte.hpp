@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/set/physical_cte.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+
+//! PhysicalCTE materializes a common table expression once (the first child), after which the main query (the
+//! second child) can scan the result any number of times
+class PhysicalCTE : public PhysicalOperator {
+public:
+	PhysicalCTE(vector<LogicalType> types, bool parallel, unique_ptr<PhysicalOperator> cte,
+	            unique_ptr<PhysicalOperator> child, idx_t estimated_cardinality);
+	~PhysicalCTE() override;
+
+	//! Whether or not the CTE can be materialized by multiple threads (i.e. its order does not need to be preserved)
+	bool parallel;
+	//! The materialized result of the CTE
+	std::shared_ptr<ColumnDataCollection> working_table;
+	//! The scans of the materialized CTE
+	vector<PhysicalOperator *> cte_scans;
+
+public:
+	// Sink interface
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate,
+	                    DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalSinkState &state, LocalSinkState &lstate) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return parallel;
+	}
+
+public:
+	void BuildPipelines(Pipeline &current, MetaPipeline &meta_pipeline) override;
+
+	vector<const PhysicalOperator *> GetSources() const override;
+	bool AllOperatorsPreserveOrder() const override;
+};
+
+} // namespace duckdb
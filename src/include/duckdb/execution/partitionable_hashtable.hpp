@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
 
 namespace duckdb {
 
@@ -35,9 +36,14 @@ public:
 	idx_t AddChunk(DataChunk &groups, DataChunk &payload, bool do_partition, const vector<idx_t> &filter);
 	void Partition();
 	bool IsPartitioned();
+	//! Stop aggregating locally: subsequent chunks are only radix-partitioned and materialized as raw rows
+	void Bypass(const vector<idx_t> &filter);
+	bool IsBypassed();
 
 	HashTableList GetPartition(idx_t partition);
 	HashTableList GetUnpartitioned();
+	//! Aggregates the raw rows of a partition that were collected while bypassing into the given HT
+	void CombineBypassed(idx_t partition, GroupedAggregateHashTable &target);
 
 	void Finalize();
 
@@ -58,8 +64,17 @@ private:
 	HashTableList unpartitioned_hts;
 	unordered_map<hash_t, HashTableList> radix_partitioned_hts;
 
+	bool is_bypassed;
+	//! The aggregate filter the bypassed rows have to be aggregated with
+	vector<idx_t> bypass_filter;
+	//! Chunk used to append [groups, payload, hash] to the bypassed partitions
+	DataChunk bypass_chunk;
+	vector<unique_ptr<ColumnDataCollection>> bypassed_partitions;
+	vector<unique_ptr<ColumnDataAppendState>> bypass_append_states;
+
 private:
 	idx_t ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload,
 	                   const vector<idx_t> &filter);
+	void BypassAppend(idx_t partition, DataChunk &groups, Vector &group_hashes, DataChunk &payload);
 };
 } // namespace duckdb
@@ -32,6 +32,10 @@ public:
 	vector<LogicalType> group_types;
 	//! how many groups can we have in the operator before we switch to radix partitioning
 	idx_t radix_limit;
+	//! how many rows a thread has to sink before we consider bypassing its local pre-aggregation
+	idx_t bypass_min_rows;
+	//! if a thread's rows-per-group reduction factor drops below this, it stops pre-aggregating
+	double bypass_reduction_threshold;
 
 	//! The GROUPING values that belong to this hash table
 	vector<Value> grouping_values;
@@ -58,6 +62,8 @@ public:
 
 	static void SetMultiScan(GlobalSinkState &state);
 	bool ForceSingleHT(GlobalSinkState &state) const;
+	//! Describes the adaptive decisions taken during the sink (for the profiler), empty if there were none
+	string GetProfilingInfo(GlobalSinkState &state) const;
 
 private:
 	void SetGroupingValues();
@@ -8,13 +8,43 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
+class WindowSegmentTree;
+
+//! The thread-local state of a WindowSegmentTree: every thread that builds or reads the (shared) tree needs one
+class WindowSegmentTreeState {
+public:
+	using FrameBounds = std::pair<idx_t, idx_t>;
+
+	explicit WindowSegmentTreeState(const WindowSegmentTree &tree);
+	~WindowSegmentTreeState();
+
+	//! The tree this state computes aggregates over
+	const WindowSegmentTree &tree;
+	//! Data pointer that contains a single state, used for intermediate window segment aggregation
+	vector<data_t> state;
+	//! Input data chunk, used for intermediate window segment aggregation
+	DataChunk inputs;
+	//! The filtered rows in inputs.
+	SelectionVector filter_sel;
+	//! A vector of pointers to "state", used for intermediate window segment aggregation
+	Vector statep;
+	//! The frame boundaries, used for the window functions
+	FrameBounds frame;
+	//! Reused result state container for the window functions
+	Vector statev;
+};
+
 class WindowSegmentTree {
 public:
 	using FrameBounds = std::pair<idx_t, idx_t>;
@@ -23,15 +53,24 @@ public:
 	                  DataChunk *input, const ValidityMask &filter_mask, WindowAggregationMode mode);
 	~WindowSegmentTree();
 
+	//! Builds the nodes of the tree that no other thread is building, and returns once the whole tree is built.
+	//! With the window API, it initializes the shared state of the aggregate instead.
+	//! Any number of threads can build the tree together, every thread has to call this before Compute.
+	void ConstructTree(WindowSegmentTreeState &lstate);
+
 	//! First row contains the result.
-	void Compute(Vector &result, idx_t rid, idx_t start, idx_t end);
+	void Compute(WindowSegmentTreeState &lstate, Vector &result, idx_t rid, idx_t start, idx_t end) const;
 
 private:
-	void ConstructTree();
-	void ExtractFrame(idx_t begin, idx_t end);
-	void WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end);
-	void AggregateInit();
-	void AggegateFinal(Vector &result, idx_t rid);
+	friend class WindowSegmentTreeState;
+
+	void ConstructNode(WindowSegmentTreeState &lstate, idx_t node_idx);
+	//! Blocks until the first node_count nodes have been computed
+	void WaitForNodes(idx_t node_count);
+	void ExtractFrame(WindowSegmentTreeState &lstate, idx_t begin, idx_t end) const;
+	void WindowSegmentValue(WindowSegmentTreeState &lstate, idx_t l_idx, idx_t begin, idx_t end) const;
+	void AggregateInit(WindowSegmentTreeState &lstate) const;
+	void AggegateFinal(WindowSegmentTreeState &lstate, Vector &result, idx_t rid) const;
 
 	//! Use the window API, if available
 	inline bool UseWindowAPI() const {
@@ -41,6 +80,14 @@ private:
 	inline bool UseCombineAPI() const {
 		return mode < WindowAggregationMode::SEPARATE;
 	}
+	//! Whether the window API computes the frames, so there is no tree
+	inline bool HasWindowAPI() const {
+		return aggregate.window && UseWindowAPI();
+	}
+	//! Whether the frames are computed from the nodes of a tree
+	inline bool HasTree() const {
+		return input_ref && input_ref->ColumnCount() > 0 && !HasWindowAPI() && aggregate.combine && UseCombineAPI();
+	}
 
 	//! The aggregate that the window function is computed over
 	AggregateFunction aggregate;
@@ -48,19 +95,10 @@ private:
 	FunctionData *bind_info;
 	//! The result type of the window function
 	LogicalType result_type;
-
-	//! Data pointer that contains a single state, used for intermediate window segment aggregation
-	vector<data_t> state;
-	//! Input data chunk, used for intermediate window segment aggregation
-	DataChunk inputs;
-	//! The filtered rows in inputs.
-	SelectionVector filter_sel;
-	//! A vector of pointers to "state", used for intermediate window segment aggregation
-	Vector statep;
-	//! The frame boundaries, used for the window functions
-	FrameBounds frame;
-	//! Reused result state container for the window functions
-	Vector statev;
+	//! The size of a single aggregate state
+	idx_t state_size;
+	//! The state that the window API shares between all the threads that compute the frames
+	vector<data_t> gstate;
 
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	unique_ptr<data_t[]> levels_flat_native;
@@ -69,6 +107,18 @@ private:
 
 	//! The total number of internal nodes of the tree, stored in levels_flat_native
 	idx_t internal_nodes;
+	//! The number of nodes that have to be computed (all nodes, unless the tree consists of a single row)
+	idx_t build_nodes;
+	//! The next node to compute
+	atomic<idx_t> build_next;
+	//! Protects build_completed and build_failed
+	mutex build_lock;
+	//! Signalled when a node has been computed, or when computing a node failed
+	std::condition_variable build_progress;
+	//! The number of nodes that have been computed
+	idx_t build_completed;
+	//! Whether computing a node failed, in which case the tree is never completed
+	bool build_failed;
 
 	//! The (sorted) input chunk collection on which the tree is built
 	DataChunk *input_ref;
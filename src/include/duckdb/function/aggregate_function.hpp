@@ -56,12 +56,15 @@ typedef void (*aggregate_destructor_t)(Vector &state, idx_t count);
 typedef void (*aggregate_simple_update_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
                                           data_ptr_t state, idx_t count);
 
-//! The type used for updating complex windowed aggregate functions (optional)
+//! The type used for updating complex windowed aggregate functions (optional). The inputs contain 'count' rows,
+//! every frame lies within them. The global state is shared by all threads that evaluate the partition, the (local)
+//! state belongs to the calling thread. Anything the aggregate builds lazily in the global state has to be
+//! synchronized by the aggregate itself.
 typedef std::pair<idx_t, idx_t> FrameBounds;
 typedef void (*aggregate_window_t)(Vector inputs[], const ValidityMask &filter_mask,
-                                   AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state,
-                                   const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t rid,
-                                   idx_t bias);
+                                   AggregateInputData &aggr_input_data, idx_t input_count, idx_t count,
+                                   const_data_ptr_t gstate, data_ptr_t state, const FrameBounds &frame,
+                                   const FrameBounds &prev, Vector &result, idx_t rid, idx_t bias);
 
 typedef void (*aggregate_serialize_t)(FieldWriter &writer, const FunctionData *bind_data,
                                       const AggregateFunction &function);
@@ -247,11 +250,11 @@ public:
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 	static void UnaryWindow(Vector inputs[], const ValidityMask &filter_mask, AggregateInputData &aggr_input_data,
-	                        idx_t input_count, data_ptr_t state, const FrameBounds &frame, const FrameBounds &prev,
-	                        Vector &result, idx_t rid, idx_t bias) {
+	                        idx_t input_count, idx_t count, const_data_ptr_t gstate, data_ptr_t state,
+	                        const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t rid, idx_t bias) {
 		D_ASSERT(input_count == 1);
-		AggregateExecutor::UnaryWindow<STATE, INPUT_TYPE, RESULT_TYPE, OP>(inputs[0], filter_mask, aggr_input_data,
-		                                                                   state, frame, prev, result, rid, bias);
+		AggregateExecutor::UnaryWindow<STATE, INPUT_TYPE, RESULT_TYPE, OP>(
+		    inputs[0], filter_mask, aggr_input_data, count, gstate, state, frame, prev, result, rid, bias);
 	}
 
 	template <class STATE, class A_TYPE, class B_TYPE, class OP>
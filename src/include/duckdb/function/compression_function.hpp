@@ -22,6 +22,8 @@ class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
 
+class TableFilter;
+
 struct ColumnFetchState;
 struct ColumnScanState;
 struct SegmentScanState;
@@ -91,6 +93,11 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for scanning an entire vector and evaluating a table filter on it at the same time. The
+//! selection vector is narrowed down to the rows that pass the filter, rows that are filtered out do not have to be
+//! scanned into the result. The validity of the result has already been scanned.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -118,7 +125,7 @@ public:
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial), fetch_row(fetch_row), skip(skip),
 	      init_segment(init_segment), init_append(init_append), append(append), finalize_append(finalize_append),
-	      revert_append(revert_append) {
+	      revert_append(revert_append), filter(nullptr) {
 	}
 
 	//! Compression type
@@ -174,6 +181,10 @@ public:
 	compression_finalize_append_t finalize_append;
 	//! Revert append (optional)
 	compression_revert_append_t revert_append;
+
+	// Filter functions
+	//! Scan a vector and evaluate a table filter on the compressed data (optional)
+	compression_filter_t filter;
 };
 
 //! The set of compression functions
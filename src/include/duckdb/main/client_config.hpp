@@ -14,6 +14,7 @@
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -36,6 +37,9 @@ struct ClientConfig {
 	//! (empty = print to console)
 	string profiler_save_location;
 
+	//! If hardware performance counters are collected per operator while profiling
+	bool enable_hardware_counters = false;
+
 	//! Allows suppressing profiler output, even if enabled. We turn on the profiler on all test runs but don't want
 	//! to output anything
 	bool emit_profiler_output = true;
@@ -80,6 +84,13 @@ struct ClientConfig {
 	//! elements)
 	idx_t perfect_ht_threshold = 12;
 
+	//! The factor by which the observed build size of a hash join must differ from its estimate before the probes of
+	//! consecutive inner joins in a pipeline are reordered (0 disables the reordering)
+	double adaptive_join_order_threshold = 10;
+
+	//! Whether VARCHAR columns are exported to Arrow as dictionary arrays, which shares repeated strings between rows
+	bool arrow_string_dictionary = false;
+
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
 
@@ -89,6 +100,9 @@ struct ClientConfig {
 	//! The explain output type used when none is specified (default: PHYSICAL_ONLY)
 	ExplainOutputType explain_output_type = ExplainOutputType::PHYSICAL_ONLY;
 
+	//! The fair-share weight of the tasks of queries of this connection (default: NORMAL)
+	idx_t query_priority_weight = TaskScheduler::NORMAL_PRIORITY_WEIGHT;
+
 	//! Generic options
 	case_insensitive_map_t<Value> set_variables;
 
@@ -13,6 +13,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
+#include "duckdb/common/enums/eviction_policy.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/set_scope.hpp"
@@ -97,10 +98,16 @@ struct DBConfigOptions {
 	idx_t maximum_threads = (idx_t)-1;
 	//! The number of external threads that work on DuckDB tasks. Default: none.
 	idx_t external_threads = 0;
+	//! Whether or not to pin the worker threads to the CPUs of a NUMA node
+	bool pin_threads = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not blocks that are written to the temporary directory are compressed
+	bool temporary_file_compression = false;
+	//! The policy that decides which blocks are evicted from the buffer pool when memory runs out
+	EvictionPolicy eviction_policy = EvictionPolicy::LRU;
 	//! The collation type of the database
 	string collation = string();
 	//! The order type used when none is specified (default: ASC)
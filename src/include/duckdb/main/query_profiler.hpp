@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -89,6 +90,10 @@ struct OperatorInformation {
 	double time = 0;
 	idx_t elements = 0;
 	string name;
+	//! Whether or not hardware counters were collected for the operator
+	bool has_counters = false;
+	//! The hardware counters of the operator (if has_counters is set)
+	HardwareCounterValues counters;
 	//! A vector of Expression Executor Info
 	vector<unique_ptr<ExpressionExecutorInfo>> executors_info;
 };
@@ -98,7 +103,7 @@ class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(bool enabled, bool hardware_counters = false);
 
 	DUCKDB_API void StartOperator(const PhysicalOperator *phys_op);
 	DUCKDB_API void EndOperator(DataChunk *chunk);
@@ -113,8 +118,12 @@ private:
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
+	//! Whether or not hardware counters are collected for the individual Physical Operators
+	bool hardware_counters;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! The hardware counters at the start of the active operator
+	HardwareCounterValues start_counters;
 	//! The stack of Physical Operators that are currently active
 	const PhysicalOperator *active_operator;
 	//! A mapping of physical operators to recorded timings
@@ -148,6 +157,8 @@ private:
 public:
 	DUCKDB_API bool IsEnabled() const;
 	DUCKDB_API bool IsDetailedEnabled() const;
+	//! Whether or not hardware counters are collected per operator
+	DUCKDB_API bool HardwareCountersEnabled() const;
 	DUCKDB_API ProfilerPrintFormat GetPrintFormat() const;
 	DUCKDB_API bool PrintOptimizerOutput() const;
 	DUCKDB_API string GetSaveLocation() const;
@@ -161,6 +172,11 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Appends information that is only known at execution time (e.g. adaptive decisions) to an operator's extra info
+	DUCKDB_API void AddExtraInfo(const PhysicalOperator *phys_op, const string &info);
+	//! Registers an operator that was inserted into a pipeline during execution (e.g. when reordering join probes).
+	//! It is not part of the profiled plan, so its time is added to the given planned operator instead.
+	DUCKDB_API void AddInsertedOperator(const PhysicalOperator *phys_op, const PhysicalOperator *planned_op);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -203,6 +219,8 @@ private:
 	Profiler main_query;
 	//! A map of a Physical Operator pointer to a tree node
 	TreeMap tree_map;
+	//! The operators that were inserted into pipelines during execution, and the planned operators they belong to
+	unordered_map<const PhysicalOperator *, const PhysicalOperator *> inserted_operators;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
 
@@ -21,6 +21,8 @@ enum class QueryResultType : uint8_t { MATERIALIZED_RESULT, STREAM_RESULT, PENDI
 //! A set of properties from the client context that can be used to interpret the query result
 struct ClientProperties {
 	string timezone;
+	//! Whether VARCHAR columns are exported to Arrow as dictionary arrays
+	bool arrow_string_dictionary = false;
 };
 
 class BaseQueryResult {
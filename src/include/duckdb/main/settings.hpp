@@ -25,6 +25,27 @@ struct AccessModeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct AdaptiveJoinOrderThresholdSetting {
+	static constexpr const char *Name = "adaptive_join_order_threshold";
+	static constexpr const char *Description =
+	    "The factor by which the build size of a hash join must be misestimated before the probes of a pipeline are "
+	    "reordered by their observed selectivity (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
+struct ArrowStringDictionarySetting {
+	static constexpr const char *Name = "arrow_string_dictionary";
+	static constexpr const char *Description =
+	    "Whether or not VARCHAR columns of query results are exported to Arrow as dictionary arrays";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -160,6 +181,17 @@ struct EnableObjectCacheSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EnableHardwareCountersSetting {
+	static constexpr const char *Name = "enable_hardware_counters";
+	static constexpr const char *Description =
+	    "Whether or not profiling collects hardware performance counters (cycles, instructions, cache, branch and "
+	    "TLB misses) per operator";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct EnableHTTPMetadataCacheSetting {
 	static constexpr const char *Name = "enable_http_metadata_cache";
 	static constexpr const char *Description = "Whether or not the global http metadata is used to cache HTTP metadata";
@@ -198,6 +230,16 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct EvictionPolicySetting {
+	static constexpr const char *Name = "eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to evict blocks from the buffer pool: lru, or the scan-resistant 2q";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct ExperimentalParallelCSVSetting {
 	static constexpr const char *Name = "experimental_parallel_csv";
 	static constexpr const char *Description = "Whether or not to use the experimental parallel CSV reader";
@@ -328,6 +370,16 @@ struct PerfectHashThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct PinThreadsSetting {
+	static constexpr const char *Name = "pin_threads";
+	static constexpr const char *Description =
+	    "Whether or not to pin the worker threads to the CPUs of the NUMA nodes, spreading them round-robin";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct PreserveIdentifierCase {
 	static constexpr const char *Name = "preserve_identifier_case";
 	static constexpr const char *Description =
@@ -387,6 +439,16 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct QueryPrioritySetting {
+	static constexpr const char *Name = "query_priority";
+	static constexpr const char *Description = "The priority of the queries of this connection when competing for "
+	                                           "threads with other queries: LOW, NORMAL, HIGH or a weight (1-1024)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -416,6 +478,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress the blocks that are written to the temp directory when memory runs out";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -43,6 +43,8 @@ public:
 	void GetPipelines(vector<shared_ptr<Pipeline>> &result, bool recursive);
 	//! Get the MetaPipeline children of this MetaPipeline
 	void GetMetaPipelines(vector<shared_ptr<MetaPipeline>> &result, bool recursive, bool skip);
+	//! Get the pipelines outside of this MetaPipeline (and its children) that its pipelines depend on
+	void GetExternalDependencies(vector<shared_ptr<Pipeline>> &result);
 	//! Get the dependencies (within this MetaPipeline) of the given Pipeline
 	const vector<Pipeline *> *GetDependencies(Pipeline *dependant) const;
 	//! Whether this MetaPipeline has a recursive CTE
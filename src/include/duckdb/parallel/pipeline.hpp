@@ -28,6 +28,8 @@ public:
 public:
 	//! Duplicate eliminated join scan dependencies
 	unordered_map<PhysicalOperator *, Pipeline *> delim_join_dependencies;
+	//! Materialized CTE scan dependencies
+	unordered_map<PhysicalOperator *, Pipeline *> cte_dependencies;
 
 public:
 	void SetPipelineSource(Pipeline &pipeline, PhysicalOperator *op);
@@ -81,6 +83,8 @@ public:
 
 	//! Returns a list of all operators (including source and sink) involved in this pipeline
 	vector<PhysicalOperator *> GetOperators() const;
+	//! Returns the types of the chunks produced by the intermediate operator at the given index
+	const vector<LogicalType> &GetOperatorTypes(idx_t operator_idx) const;
 
 	PhysicalOperator *GetSink() {
 		return sink;
@@ -96,6 +100,11 @@ public:
     idx_t GetPipelineId();
     void SetPipelineId(idx_t pipeline_id);
 
+	//! The NUMA node the tasks of this pipeline would preferably run on
+	idx_t GetPreferredNode() const {
+		return preferred_node;
+	}
+
 private:
 	//! Whether or not the pipeline has been readied
 	bool ready;
@@ -122,7 +131,22 @@ private:
     //! The Pipeline ID, default is 0, starting from 1 when assigning to pipelines
     idx_t pipeline_id = 0;
 
+	//! The NUMA node of the thread that scheduled this pipeline, i.e. the node where the sinks of its dependencies
+	//! (e.g. the hash tables it probes) were finalized
+	idx_t preferred_node = DConstants::INVALID_INDEX;
+
+	//! Whether the join probes of this pipeline have been considered for reordering
+	bool probes_reordered = false;
+	//! The output types of the intermediate operators, only set if they differ from the planned types
+	vector<vector<LogicalType>> operator_types;
+	//! Operators added to this pipeline during execution, i.e. the projections restoring the column order after
+	//! reordered join probes
+	vector<unique_ptr<PhysicalOperator>> owned_operators;
+
 private:
+	//! Reorders runs of inner hash join probes by the build sizes observed when their hash tables were finalized
+	void ReorderJoinProbes();
+
 	void ScheduleSequentialTask(shared_ptr<Event> &event);
 	bool LaunchScanTasks(shared_ptr<Event> &event, idx_t max_threads);
 
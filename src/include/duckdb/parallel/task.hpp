@@ -29,6 +29,11 @@ public:
 	//! If mode is PROCESS_PARTIAL, Execute can return TASK_NOT_FINISHED, in which case Execute will be called again
 	//! In case of an error, TASK_ERROR is returned
 	virtual TaskExecutionResult Execute(TaskExecutionMode mode) = 0;
+
+	//! The NUMA node this task would preferably run on, or DConstants::INVALID_INDEX if it has no preference
+	virtual idx_t GetPreferredNode() {
+		return DConstants::INVALID_INDEX;
+	}
 };
 
 //! Execute a task within an executor, including exception handling
@@ -8,10 +8,15 @@
 
 #pragma once
 
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
+//! The TaskCounter schedules tasks on a producer of its own, and waits for them in Finish. Every task has to call
+//! FinishTask as the last thing it does.
 class TaskCounter {
 public:
 	explicit TaskCounter(TaskScheduler &scheduler_p)
@@ -19,29 +24,39 @@ public:
 	}
 
 	virtual void AddTask(unique_ptr<Task> task) {
-		++task_count;
+		{
+			lock_guard<mutex> guard(lock);
+			++task_count;
+		}
 		scheduler.ScheduleTask(*token, std::move(task));
 	}
 
 	virtual void FinishTask() const {
-		++tasks_completed;
+		lock_guard<mutex> guard(lock);
+		if (++tasks_completed == task_count) {
+			tasks_finished.notify_all();
+		}
 	}
 
+	//! Works on the tasks that are still queued, and then blocks until the tasks that were picked up by other threads
+	//! have finished
 	virtual void Finish() {
-		while (tasks_completed < task_count) {
-			unique_ptr<Task> task;
-			if (scheduler.GetTaskFromProducer(*token, task)) {
-				task->Execute();
-				task.reset();
-			}
+		unique_ptr<Task> task;
+		while (scheduler.GetTaskFromProducer(*token, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
 		}
+		unique_lock<mutex> guard(lock);
+		tasks_finished.wait(guard, [&]() { return tasks_completed == task_count; });
 	}
 
 private:
 	TaskScheduler &scheduler;
 	unique_ptr<ProducerToken> token;
 	size_t task_count;
-	mutable atomic<size_t> tasks_completed;
+	mutable mutex lock;
+	mutable std::condition_variable tasks_finished;
+	mutable size_t tasks_completed;
 };
 
 } // namespace duckdb
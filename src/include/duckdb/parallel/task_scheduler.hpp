@@ -17,12 +17,32 @@
 namespace duckdb {
 
 struct ConcurrentQueue;
+struct ProducerToken;
 struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct WorkerQueue;
+struct NumaTopology;
+struct ScheduledTask;
+
+//! The fair-share scheduling state of a producer, shared with the tasks it has scheduled
+struct ProducerState {
+	explicit ProducerState(idx_t weight);
+
+	//! The weight of the producer: competing producers receive CPU time proportional to their weight
+	atomic<idx_t> weight;
+	//! The CPU time consumed by the tasks of the producer in microseconds, scaled down by its weight
+	atomic<uint64_t> virtual_time;
+	//! The amount of tasks of the producer that are in the global queue
+	atomic<idx_t> queued_tasks;
+	//! The amount of tasks of the producer that are scheduled or running on the scheduler
+	atomic<idx_t> active_tasks;
+	//! The producer that owns this state, cleared (under the producers lock of the scheduler) when it is destroyed
+	ProducerToken *producer;
+};
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -31,14 +51,27 @@ struct ProducerToken {
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	shared_ptr<ProducerState> state;
+
+public:
+	//! Sets the fair-share weight of the tasks of this producer (see QueryPriority)
+	void SetWeight(idx_t weight);
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
+	friend struct ProducerToken;
+
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
 public:
+	//! The weights of the query priority classes
+	constexpr static idx_t LOW_PRIORITY_WEIGHT = 1;
+	constexpr static idx_t NORMAL_PRIORITY_WEIGHT = 4;
+	constexpr static idx_t HIGH_PRIORITY_WEIGHT = 16;
+	constexpr static idx_t MAXIMUM_PRIORITY_WEIGHT = 1024;
+
 	TaskScheduler(DatabaseInstance &db);
 	~TaskScheduler();
 
@@ -68,8 +101,32 @@ public:
 	//! Send signals to n threads, signalling for them to wake up and attempt to execute a task
 	void Signal(idx_t n);
 
+	//! Whether or not background threads are pinned to the CPUs of a NUMA node. Relaunches the background threads.
+	void SetThreadPinning(bool pin_threads);
+	//! Returns the NUMA node of the calling thread if it is a (pinned) background thread of this scheduler, or
+	//! DConstants::INVALID_INDEX otherwise
+	idx_t GetCurrentNode();
+
 private:
 	void SetThreadsInternal(int32_t n);
+	void RegisterProducer(ProducerToken &token);
+	void UnregisterProducer(ProducerToken &token);
+	//! Dequeues the task of the competing producer with the smallest virtual time from the global queue
+	bool FairDequeue(ScheduledTask &task);
+	//! Executes a task fetched by GetTask, and re-schedules it if it was preempted
+	void RunTask(ScheduledTask &task, bool allow_preemption);
+	//! Marks a task of the given producer as finished
+	void FinishTask(ProducerState &state);
+	//! Stops and joins all background threads, moving any tasks left in their local queues to the global queue
+	void StopThreads();
+	//! Fetches a task for the given worker (or for an external thread if worker is nullptr): first from the local
+	//! queue of the worker, then by stealing from workers on the same NUMA node, then from the global queue, and
+	//! finally by stealing from workers on other NUMA nodes
+	bool GetTask(WorkerQueue *worker, ScheduledTask &task);
+	//! Steals a task from the queue of another worker. If node is valid only workers on that node are considered
+	bool StealTask(WorkerQueue *worker, idx_t node, ScheduledTask &task);
+	//! Returns the current set of worker queues, or nullptr if there are no background threads
+	shared_ptr<vector<shared_ptr<WorkerQueue>>> GetWorkerQueues();
 
 private:
 	DatabaseInstance &db;
@@ -81,6 +138,25 @@ private:
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! The local task queues of the background threads. The vector is never modified after it is published: it is
+	//! replaced as a whole when the thread count changes, and read through atomic loads
+	shared_ptr<vector<shared_ptr<WorkerQueue>>> worker_queues;
+	//! The NUMA topology of the machine
+	unique_ptr<NumaTopology> topology;
+	//! Whether or not background threads are pinned to the CPUs of a NUMA node
+	atomic<bool> pin_threads;
+	//! Round-robin counter used to distribute tasks with a locality hint over the workers of a node
+	atomic<idx_t> next_worker;
+
+	//! Lock for the set of registered producers
+	mutex producers_lock;
+	//! The registered producers, from which FairDequeue chooses
+	vector<ProducerToken *> producers;
+	//! The amount of producers that have scheduled or running tasks
+	atomic<idx_t> busy_producers;
+	//! The virtual time of the most recently chosen producer. Producers that become busy start from here, so that
+	//! idle producers cannot accumulate credit
+	atomic<uint64_t> virtual_clock;
 };
 
 } // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/common/enums/cte_materialize.hpp"
 
 namespace duckdb {
 
@@ -17,6 +18,8 @@ class SelectStatement;
 struct CommonTableExpressionInfo {
 	vector<string> aliases;
 	unique_ptr<SelectStatement> query;
+	//! Whether the CTE is materialized once or inlined for every reference
+	CTEMaterialize materialized = CTEMaterialize::CTE_MATERIALIZE_DEFAULT;
 };
 
 } // namespace duckdb
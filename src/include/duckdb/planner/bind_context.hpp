@@ -103,6 +103,8 @@ public:
 	//! Adds a base table with the given alias to the CTE BindContext.
 	//! We need this to correctly bind recursive CTEs with multiple references.
 	void AddCTEBinding(idx_t index, const string &alias, const vector<string> &names, const vector<LogicalType> &types);
+	//! Removes the CTE binding with the given name, if any (e.g. because it is shadowed by another CTE)
+	void RemoveCTEBinding(const string &ctename);
 
 	//! Add an implicit join condition (e.g. USING (x))
 	void AddUsingBinding(const string &column_name, UsingColumnSet *set);
@@ -43,6 +43,7 @@ struct CreateInfo;
 struct BoundCreateTableInfo;
 struct BoundCreateFunctionInfo;
 struct CommonTableExpressionInfo;
+struct BoundMaterializedCTE;
 struct BoundParameterMap;
 
 enum class BindingMode : uint8_t { STANDARD_BINDING, EXTRACT_NAMES };
@@ -262,8 +263,13 @@ private:
 	unique_ptr<BoundQueryNode> BindNode(SetOperationNode &node);
 	unique_ptr<BoundQueryNode> BindNode(RecursiveCTENode &node);
 	unique_ptr<BoundQueryNode> BindNode(QueryNode &node);
+	//! Binds the CTEs of a query node that are materialized once instead of being inlined for every reference
+	vector<BoundMaterializedCTE> BindMaterializedCTEs(QueryNode &node);
+	void BindMaterializedCTE(QueryNode &node, const string &name, case_insensitive_set_t &visited,
+	                         vector<BoundMaterializedCTE> &result);
 
 	unique_ptr<LogicalOperator> VisitQueryNode(BoundQueryNode &node, unique_ptr<LogicalOperator> root);
+	unique_ptr<LogicalOperator> PlanMaterializedCTEs(BoundQueryNode &node, unique_ptr<LogicalOperator> root);
 	unique_ptr<LogicalOperator> CreatePlan(BoundRecursiveCTENode &node);
 	unique_ptr<LogicalOperator> CreatePlan(BoundSelectNode &statement);
 	unique_ptr<LogicalOperator> CreatePlan(BoundSetOperationNode &node);
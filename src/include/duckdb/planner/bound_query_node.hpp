@@ -13,6 +13,18 @@
 #include "duckdb/parser/query_node.hpp"
 
 namespace duckdb {
+class Binder;
+class BoundQueryNode;
+
+//! A CTE that is computed once, before the query node that defines it
+struct BoundMaterializedCTE {
+	//! The index of the CTE, as referenced by the BoundCTERefs
+	idx_t table_index;
+	//! The binder used to bind the CTE
+	shared_ptr<Binder> binder;
+	//! The bound CTE query
+	unique_ptr<BoundQueryNode> query;
+};
 
 //! Bound equivalent of QueryNode
 class BoundQueryNode {
@@ -31,6 +43,8 @@ public:
 	vector<string> names;
 	//! The types returned by this QueryNode.
 	vector<LogicalType> types;
+	//! The CTEs of this QueryNode that are materialized
+	vector<BoundMaterializedCTE> materialized_ctes;
 
 public:
 	virtual idx_t GetRootIndex() = 0;
@@ -38,6 +38,7 @@ class LogicalGet;
 class LogicalInsert;
 class LogicalJoin;
 class LogicalLimit;
+class LogicalMaterializedCTE;
 class LogicalOrder;
 class LogicalPositionalJoin;
 class LogicalPragma;
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/operator/logical_materialized_cte.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+//! LogicalMaterializedCTE computes a common table expression (the first child) once, after which it can be referenced
+//! any number of times by LogicalCTERefs in the main query (the second child)
+class LogicalMaterializedCTE : public LogicalOperator {
+	explicit LogicalMaterializedCTE(idx_t table_index)
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_MATERIALIZED_CTE), table_index(table_index) {
+	}
+
+public:
+	LogicalMaterializedCTE(idx_t table_index, unique_ptr<LogicalOperator> cte, unique_ptr<LogicalOperator> child)
+	    : LogicalOperator(LogicalOperatorType::LOGICAL_MATERIALIZED_CTE), table_index(table_index) {
+		children.push_back(std::move(cte));
+		children.push_back(std::move(child));
+	}
+
+	//! The index of the CTE, as referenced by the LogicalCTERefs
+	idx_t table_index;
+
+public:
+	vector<ColumnBinding> GetColumnBindings() override {
+		return children[1]->GetColumnBindings();
+	}
+	void Serialize(FieldWriter &writer) const override;
+	static unique_ptr<LogicalOperator> Deserialize(LogicalDeserializationState &state, FieldReader &reader);
+
+protected:
+	void ResolveTypes() override {
+		types = children[1]->types;
+	}
+};
+} // namespace duckdb
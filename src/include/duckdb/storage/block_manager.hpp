@@ -50,6 +50,9 @@ public:
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Read the content of a set of blocks from disk. By default the blocks are read one by one, block managers that
+	//! can issue the reads at once override this.
+	virtual void ReadBlocks(const vector<Block *> &blocks);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/eviction_policy.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -89,6 +90,11 @@ public:
 		return memory_usage;
 	}
 
+	//! Whether the block is a temporary block that was destroyed instead of written to disk when it was evicted
+	inline bool IsDestroyed() const {
+		return state == BlockState::BLOCK_UNLOADED && can_destroy && block_id >= MAXIMUM_BLOCK;
+	}
+
     void ShowBufferInBlock();
 
 private:
@@ -111,6 +117,11 @@ private:
 private:
     //! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! The eviction queue that the block is added to when it is unpinned
+	EvictionQueueType eviction_queue;
+	//! The number of evictions from the probationary queue at the moment this block was evicted from it
+	//! (or DConstants::INVALID_INDEX): this is the history that the 2Q policy uses to recognize re-referenced blocks
+	idx_t probationary_eviction;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
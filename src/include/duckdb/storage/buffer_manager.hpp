@@ -23,9 +23,20 @@ class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
 
+struct EvictionQueueInformation {
+	string queue;
+	//! The amount of pins of blocks that were loaded, pins of blocks that had to be loaded, and evicted blocks
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+};
+
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The amount of bytes written to and read from the file since it was created
+	idx_t bytes_written = 0;
+	idx_t bytes_read = 0;
 };
 
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
@@ -55,8 +66,12 @@ public:
 	//! Reallocate an in-memory buffer that is pinned.
 	void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size);
 
+	//! Pins the block, loading it if it is not in memory. Returns an invalid handle if the block was destroyed.
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle);
 	void Unpin(shared_ptr<BlockHandle> &handle);
+	//! Loads the persistent blocks of a set of handles ahead of pinning them, reading them from disk in a single batch.
+	//! Prefetching never evicts other blocks: it stops at the first block that does not fit in the memory limit.
+	void Prefetch(const vector<shared_ptr<BlockHandle>> &handles);
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
@@ -105,6 +120,8 @@ public:
 
 	//! Returns a list of all temporary files
 	vector<TemporaryFileInformation> GetTemporaryFiles();
+	//! Returns the statistics of the eviction queues
+	vector<EvictionQueueInformation> GetEvictionQueues();
 
 private:
 	//! Register an in-memory buffer of arbitrary size, as long as it is >= BLOCK_SIZE. can_destroy signifies whether or
@@ -132,6 +149,11 @@ private:
 
 	//! Garbage collect eviction queue
 	void PurgeQueue();
+	void PurgeQueue(EvictionQueue &queue);
+	EvictionQueue &GetEvictionQueue(EvictionQueueType type);
+	//! Registers a pin of the block in the statistics of its eviction queue, and determines the eviction queue that
+	//! the block goes to when it is unpinned. This is called with the lock of the block held.
+	void ReferenceBlock(BlockHandle &handle, bool loaded);
 
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
@@ -172,8 +194,11 @@ private:
 	mutex temp_handle_lock;
 	//! Handle for the temporary directory
 	unique_ptr<TemporaryDirectoryHandle> temp_directory_handle;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! The amount of bytes written to the files of buffers that are larger than a block, by path (protected by
+	//! temp_handle_lock)
+	unordered_map<string, idx_t> temp_file_bytes_written;
+	//! Eviction queues, indexed by EvictionQueueType
+	vector<unique_ptr<EvictionQueue>> queues;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
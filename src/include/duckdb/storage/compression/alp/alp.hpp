@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/compression/patas/patas.hpp"
+
+namespace duckdb {
+
+//! ALP (Adaptive Lossless floating-Point compression) encodes floating point values that are decimals in disguise
+//! (e.g. prices or sensor readings) as integers: a value v is stored as round(v * 10^exponent * 10^-factor), which is
+//! then compressed with frame-of-reference bitpacking. Values that do not survive the round trip are stored as
+//! exceptions. Every vector of ALP_VECTOR_SIZE values has its own exponent and factor.
+struct AlpConstants {
+	//! The number of values that share the exponent, factor and frame of reference
+	static constexpr const idx_t ALP_VECTOR_SIZE = 1024;
+	//! The number of values per vector that are sampled to choose the exponent and factor
+	static constexpr const idx_t SAMPLES_PER_VECTOR = 32;
+	//! The maximum number of (exponent, factor) combinations the compression chooses from for every vector
+	static constexpr const idx_t MAX_COMBINATIONS = 5;
+	//! The segment header: the offset to the end of the metadata
+	static constexpr const idx_t HEADER_SIZE = sizeof(uint32_t);
+	//! The vector header: exponent, factor, bit width, exception count, frame of reference and maximum delta
+	static constexpr const idx_t VECTOR_HEADER_SIZE = 24;
+
+	//! The powers of ten as integers, the factor is multiplied back in before converting to floating point
+	static const int64_t FACTORS[19];
+};
+
+template <class T>
+struct AlpTypeConstants {};
+
+template <>
+struct AlpTypeConstants<double> {
+	static constexpr const uint8_t MAX_EXPONENT = 18;
+};
+
+template <>
+struct AlpTypeConstants<float> {
+	static constexpr const uint8_t MAX_EXPONENT = 10;
+};
+
+//! Values of both types are encoded and decoded with double arithmetic: for floats this rounds the decoded value
+//! correctly far more often than float arithmetic would, which avoids exceptions
+struct AlpDoubleConstants {
+	//! Encoded values are limited to 2^51, which keeps the rounding below exact
+	static constexpr const double ENCODING_LIMIT = 2251799813685248.0;
+	//! Adding and subtracting 2^52 + 2^51 rounds a double to the nearest integer
+	static constexpr const double MAGIC_NUMBER = 6755399441055744.0;
+
+	static const double EXPONENTS[19];
+	static const double FRACTIONS[19];
+};
+
+struct AlpCombination {
+	AlpCombination() : exponent(0), factor(0) {
+	}
+	AlpCombination(uint8_t exponent, uint8_t factor) : exponent(exponent), factor(factor) {
+	}
+
+	uint8_t exponent;
+	uint8_t factor;
+
+	bool operator==(const AlpCombination &other) const {
+		return exponent == other.exponent && factor == other.factor;
+	}
+	bool operator<(const AlpCombination &other) const {
+		return exponent < other.exponent || (exponent == other.exponent && factor < other.factor);
+	}
+};
+
+//! The header that precedes the data of every vector
+struct AlpVectorHeader {
+	uint8_t exponent;
+	uint8_t factor;
+	bitpacking_width_t bit_width;
+	uint16_t exception_count;
+	//! The smallest encoded value in the vector, the bitpacked deltas are relative to it
+	int64_t frame_of_reference;
+	//! The largest delta in the vector
+	uint64_t max_delta;
+
+public:
+	void Write(data_ptr_t dst) const {
+		Store<uint8_t>(exponent, dst);
+		Store<uint8_t>(factor, dst + 1);
+		Store<uint8_t>(bit_width, dst + 2);
+		Store<uint16_t>(exception_count, dst + 4);
+		Store<int64_t>(frame_of_reference, dst + 8);
+		Store<uint64_t>(max_delta, dst + 16);
+	}
+	void Read(const_data_ptr_t src) {
+		exponent = Load<uint8_t>(src);
+		factor = Load<uint8_t>(src + 1);
+		bit_width = Load<uint8_t>(src + 2);
+		exception_count = Load<uint16_t>(src + 4);
+		frame_of_reference = Load<int64_t>(src + 8);
+		max_delta = Load<uint64_t>(src + 16);
+	}
+	//! The largest encoded value in the vector
+	int64_t MaxEncoded() const {
+		return int64_t(uint64_t(frame_of_reference) + max_delta);
+	}
+	//! The size of the bitpacked deltas of a vector with 'count' values
+	idx_t PackedSize(idx_t count) const {
+		return BitpackingPrimitives::GetRequiredSize(count, bit_width);
+	}
+};
+
+template <class T>
+struct AlpPrimitives {
+	using EXACT_TYPE = typename FloatingToExact<T>::type;
+	using CONSTANTS = AlpDoubleConstants;
+
+	static inline T Decode(int64_t encoded, uint8_t exponent, uint8_t factor) {
+		return T(double(encoded * AlpConstants::FACTORS[factor]) * CONSTANTS::FRACTIONS[exponent]);
+	}
+
+	//! Encodes a value with the exponent and factor, returns false if the encoded value does not decode to the exact
+	//! same value (e.g. because it has too many decimals, is too large, infinite or NaN)
+	static inline bool TryEncode(T value, uint8_t exponent, uint8_t factor, int64_t &result) {
+		double scaled = double(value) * CONSTANTS::EXPONENTS[exponent] * CONSTANTS::FRACTIONS[factor];
+		if (!(scaled >= -CONSTANTS::ENCODING_LIMIT && scaled <= CONSTANTS::ENCODING_LIMIT)) {
+			return false;
+		}
+		result = int64_t(scaled + CONSTANTS::MAGIC_NUMBER - CONSTANTS::MAGIC_NUMBER);
+		// the factor is multiplied back in when decoding, which must not overflow
+		auto limit = NumericLimits<int64_t>::Maximum() / AlpConstants::FACTORS[factor];
+		if (result > limit || result < -limit) {
+			return false;
+		}
+		T decoded = Decode(result, exponent, factor);
+		return Load<EXACT_TYPE>((const_data_ptr_t)&decoded) == Load<EXACT_TYPE>((const_data_ptr_t)&value);
+	}
+
+	//! Estimates the number of bits required to store the values with the exponent and factor
+	static idx_t EstimateBits(const T *values, idx_t count, AlpCombination combination) {
+		idx_t exception_count = 0;
+		bool has_encoded = false;
+		int64_t min_encoded = 0;
+		int64_t max_encoded = 0;
+		for (idx_t i = 0; i < count; i++) {
+			int64_t encoded;
+			if (!TryEncode(values[i], combination.exponent, combination.factor, encoded)) {
+				exception_count++;
+				continue;
+			}
+			if (!has_encoded) {
+				min_encoded = encoded;
+				max_encoded = encoded;
+				has_encoded = true;
+			}
+			min_encoded = MinValue(min_encoded, encoded);
+			max_encoded = MaxValue(max_encoded, encoded);
+		}
+		auto width = BitpackingPrimitives::MinimumBitWidth<uint64_t>(uint64_t(max_encoded) - uint64_t(min_encoded));
+		return count * width + exception_count * (sizeof(T) + sizeof(uint16_t)) * 8;
+	}
+
+	//! Finds the combination that stores the values in the fewest bits
+	static AlpCombination FindBestCombination(const T *values, idx_t count,
+	                                          const vector<AlpCombination> &combinations) {
+		D_ASSERT(!combinations.empty());
+		auto best = combinations[0];
+		if (combinations.size() == 1 || count == 0) {
+			return best;
+		}
+		auto best_bits = EstimateBits(values, count, best);
+		for (idx_t i = 1; i < combinations.size(); i++) {
+			auto bits = EstimateBits(values, count, combinations[i]);
+			if (bits < best_bits) {
+				best = combinations[i];
+				best_bits = bits;
+			}
+		}
+		return best;
+	}
+
+	//! The size of a vector with 'count' values in the segment
+	static idx_t VectorSize(idx_t count, bitpacking_width_t width, idx_t exception_count) {
+		return AlpConstants::VECTOR_HEADER_SIZE + BitpackingPrimitives::GetRequiredSize(count, width) +
+		       exception_count * (sizeof(T) + sizeof(uint16_t));
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_analyze.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/pair.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+template <class T>
+struct AlpAnalyzeState : public AnalyzeState {
+public:
+	AlpAnalyzeState() {
+	}
+
+	//! The sampled valid values of every vector
+	vector<vector<T>> samples;
+	//! The number of values (valid or not) of every vector
+	vector<idx_t> vector_counts;
+	//! The combinations that were best for the most sampled vectors, the compression chooses from these
+	vector<AlpCombination> combinations;
+
+public:
+	void Update(T value, bool is_valid) {
+		if (vector_counts.empty() || vector_counts.back() == AlpConstants::ALP_VECTOR_SIZE) {
+			samples.emplace_back();
+			vector_counts.push_back(0);
+		}
+		auto &count = vector_counts.back();
+		if (is_valid && count % (AlpConstants::ALP_VECTOR_SIZE / AlpConstants::SAMPLES_PER_VECTOR) == 0) {
+			samples.back().push_back(value);
+		}
+		count++;
+	}
+
+	//! Finds the best combination for every sampled vector, and keeps the ones that are chosen most often
+	void FindCombinations() {
+		map<AlpCombination, idx_t> frequencies;
+		for (auto &sample : samples) {
+			if (sample.empty()) {
+				continue;
+			}
+			AlpCombination best;
+			idx_t best_bits = NumericLimits<idx_t>::Maximum();
+			// on ties the smallest exponent and factor are preferred, as they have the least rounding
+			for (uint8_t exponent = 0; exponent <= AlpTypeConstants<T>::MAX_EXPONENT; exponent++) {
+				for (uint8_t factor = 0; factor <= exponent; factor++) {
+					AlpCombination combination(exponent, factor);
+					auto bits = AlpPrimitives<T>::EstimateBits(sample.data(), sample.size(), combination);
+					if (bits < best_bits) {
+						best = combination;
+						best_bits = bits;
+					}
+				}
+			}
+			frequencies[best]++;
+		}
+		vector<pair<idx_t, AlpCombination>> ordered;
+		for (auto &entry : frequencies) {
+			ordered.emplace_back(entry.second, entry.first);
+		}
+		std::stable_sort(ordered.begin(), ordered.end(),
+		                 [](const pair<idx_t, AlpCombination> &a, const pair<idx_t, AlpCombination> &b) {
+			                 return a.first > b.first;
+		                 });
+		combinations.clear();
+		for (idx_t i = 0; i < ordered.size() && i < AlpConstants::MAX_COMBINATIONS; i++) {
+			combinations.push_back(ordered[i].second);
+		}
+		if (combinations.empty()) {
+			// only NULL values: any combination will do
+			combinations.emplace_back(0, 0);
+		}
+	}
+
+	//! Estimates the size of the compressed data from the samples
+	idx_t EstimateSize() const {
+		double total_size = 0;
+		for (idx_t i = 0; i < samples.size(); i++) {
+			auto &sample = samples[i];
+			idx_t bits = 0;
+			if (!sample.empty()) {
+				auto best = AlpPrimitives<T>::FindBestCombination(sample.data(), sample.size(), combinations);
+				bits = AlpPrimitives<T>::EstimateBits(sample.data(), sample.size(), best);
+			}
+			// scale the sample up to the whole vector
+			auto sample_count = MaxValue<idx_t>(sample.size(), 1);
+			total_size += double(bits) / 8 * double(vector_counts[i]) / double(sample_count);
+			total_size += AlpConstants::VECTOR_HEADER_SIZE + sizeof(uint32_t);
+		}
+		auto segment_count = idx_t(total_size) / Storage::BLOCK_SIZE + 1;
+		return idx_t(total_size) + segment_count * AlpConstants::HEADER_SIZE;
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> AlpInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	return make_unique<AlpAnalyzeState<T>>();
+}
+
+template <class T>
+bool AlpAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = (AlpAnalyzeState<T> &)state;
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = (T *)vdata.data;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.Update(data[idx], vdata.validity.RowIsValid(idx));
+	}
+	return true;
+}
+
+template <class T>
+idx_t AlpFinalAnalyze(AnalyzeState &state) {
+	auto &alp_state = (AlpAnalyzeState<T> &)state;
+	alp_state.FindCombinations();
+	return alp_state.EstimateSize();
+}
+
+} // namespace duckdb
@@ -0,0 +1,232 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_compress.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_analyze.hpp"
+#include "duckdb/function/compression_function.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+// State
+
+template <class T>
+struct AlpCompressionState : public CompressionState {
+public:
+	explicit AlpCompressionState(ColumnDataCheckpointer &checkpointer, AlpAnalyzeState<T> *analyze_state)
+	    : checkpointer(checkpointer), combinations(std::move(analyze_state->combinations)) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto &config = DBConfig::GetConfig(db);
+		function = config.GetCompressionFunction(CompressionType::COMPRESSION_ALP, type.InternalType());
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction *function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+	//! The combinations found in the analysis
+	vector<AlpCombination> combinations;
+
+	// Ptr to the next free spot in the segment
+	data_ptr_t data_ptr;
+	// Ptr to the start of the metadata, which grows backwards from the end of the segment
+	data_ptr_t metadata_ptr;
+
+	//! The values of the vector that is being filled
+	idx_t vector_idx = 0;
+	T input[AlpConstants::ALP_VECTOR_SIZE];
+	bool input_valid[AlpConstants::ALP_VECTOR_SIZE];
+
+	//! The encoding of the vector
+	T sample[AlpConstants::SAMPLES_PER_VECTOR];
+	int64_t encoded[AlpConstants::ALP_VECTOR_SIZE];
+	uint64_t deltas[AlpConstants::ALP_VECTOR_SIZE];
+	T exceptions[AlpConstants::ALP_VECTOR_SIZE];
+	uint16_t exception_positions[AlpConstants::ALP_VECTOR_SIZE];
+	uint16_t fill_positions[AlpConstants::ALP_VECTOR_SIZE];
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+		auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + AlignValue(AlpConstants::HEADER_SIZE);
+		metadata_ptr = handle.Ptr() + Storage::BLOCK_SIZE;
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = (T *)vdata.data;
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			input_valid[vector_idx] = vdata.validity.RowIsValid(idx);
+			input[vector_idx] = input_valid[vector_idx] ? data[idx] : T(0);
+			vector_idx++;
+			if (vector_idx == AlpConstants::ALP_VECTOR_SIZE) {
+				FlushVector();
+			}
+		}
+	}
+
+	AlpCombination ChooseCombination() {
+		idx_t sample_count = 0;
+		for (idx_t i = 0; i < vector_idx; i += AlpConstants::ALP_VECTOR_SIZE / AlpConstants::SAMPLES_PER_VECTOR) {
+			if (input_valid[i]) {
+				sample[sample_count++] = input[i];
+			}
+		}
+		return AlpPrimitives<T>::FindBestCombination(sample, sample_count, combinations);
+	}
+
+	void FlushVector() {
+		D_ASSERT(vector_idx > 0);
+		auto combination = ChooseCombination();
+
+		AlpVectorHeader header;
+		header.exponent = combination.exponent;
+		header.factor = combination.factor;
+
+		// encode the values, NULL values and exceptions are filled in with an encoded value afterwards
+		idx_t exception_count = 0;
+		idx_t fill_count = 0;
+		bool has_encoded = false;
+		int64_t min_encoded = 0;
+		int64_t max_encoded = 0;
+		for (idx_t i = 0; i < vector_idx; i++) {
+			if (!input_valid[i]) {
+				fill_positions[fill_count++] = i;
+				continue;
+			}
+			if (!AlpPrimitives<T>::TryEncode(input[i], header.exponent, header.factor, encoded[i])) {
+				exceptions[exception_count] = input[i];
+				exception_positions[exception_count++] = i;
+				fill_positions[fill_count++] = i;
+				continue;
+			}
+			if (!has_encoded) {
+				min_encoded = encoded[i];
+				max_encoded = encoded[i];
+				has_encoded = true;
+			}
+			min_encoded = MinValue(min_encoded, encoded[i]);
+			max_encoded = MaxValue(max_encoded, encoded[i]);
+		}
+		for (idx_t i = 0; i < fill_count; i++) {
+			encoded[fill_positions[i]] = min_encoded;
+		}
+		header.exception_count = exception_count;
+		header.frame_of_reference = min_encoded;
+		header.max_delta = uint64_t(max_encoded) - uint64_t(min_encoded);
+		header.bit_width = BitpackingPrimitives::MinimumBitWidth<uint64_t>(header.max_delta);
+		for (idx_t i = 0; i < vector_idx; i++) {
+			deltas[i] = uint64_t(encoded[i]) - uint64_t(min_encoded);
+		}
+		// the deltas are packed in groups, pad the last group with zeroes
+		auto packed_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(vector_idx);
+		for (idx_t i = vector_idx; i < packed_count; i++) {
+			deltas[i] = 0;
+		}
+
+		auto vector_size = AlpPrimitives<T>::VectorSize(vector_idx, header.bit_width, exception_count);
+		if (!HasEnoughSpace(vector_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		for (idx_t i = 0; i < vector_idx; i++) {
+			if (input_valid[i]) {
+				NumericStatistics::Update<T>(current_segment->stats, input[i]);
+			}
+		}
+
+		// store where the vector starts, relative to the start of the segment
+		metadata_ptr -= sizeof(uint32_t);
+		Store<uint32_t>(data_ptr - handle.Ptr(), metadata_ptr);
+
+		header.Write(data_ptr);
+		auto packed_data = data_ptr + AlpConstants::VECTOR_HEADER_SIZE;
+		if (header.bit_width > 0) {
+			BitpackingPrimitives::PackBuffer<uint64_t, true>(packed_data, deltas, packed_count, header.bit_width);
+		}
+		auto exception_data = packed_data + header.PackedSize(vector_idx);
+		memcpy(exception_data, exceptions, exception_count * sizeof(T));
+		memcpy(exception_data + exception_count * sizeof(T), exception_positions, exception_count * sizeof(uint16_t));
+		data_ptr += AlignValue(vector_size);
+
+		current_segment->count += vector_idx;
+		vector_idx = 0;
+	}
+
+	// The current segment has enough space to fit a vector of this size
+	bool HasEnoughSpace(idx_t vector_size) {
+		return data_ptr + AlignValue(vector_size) <= metadata_ptr - sizeof(uint32_t);
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto dataptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		idx_t metadata_offset = data_ptr - dataptr;
+		idx_t metadata_size = dataptr + Storage::BLOCK_SIZE - metadata_ptr;
+		idx_t total_segment_size = metadata_offset + metadata_size;
+		memmove(dataptr + metadata_offset, metadata_ptr, metadata_size);
+		// Store the offset to the end of the metadata
+		Store<uint32_t>(total_segment_size, dataptr);
+		handle.Destroy();
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		if (vector_idx > 0) {
+			FlushVector();
+		}
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+// Compression Functions
+
+template <class T>
+unique_ptr<CompressionState> AlpInitCompression(ColumnDataCheckpointer &checkpointer, unique_ptr<AnalyzeState> state) {
+	return make_unique<AlpCompressionState<T>>(checkpointer, (AlpAnalyzeState<T> *)state.get());
+}
+
+template <class T>
+void AlpCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = (AlpCompressionState<T> &)state_p;
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void AlpFinalizeCompress(CompressionState &state_p) {
+	auto &state = (AlpCompressionState<T> &)state_p;
+	state.Finalize();
+}
+
+} // namespace duckdb
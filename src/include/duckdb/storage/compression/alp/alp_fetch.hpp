@@ -0,0 +1,27 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_fetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_scan.hpp"
+
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+template <class T>
+void AlpFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	AlpScanState<T> scan_state(segment);
+	scan_state.Skip(row_id);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.ScanValues(result_data + result_idx, 1);
+}
+
+} // namespace duckdb
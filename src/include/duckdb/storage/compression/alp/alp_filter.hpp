@@ -0,0 +1,223 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_scan.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! Filters on ALP vectors are evaluated on the encoded integers: decoding is monotonic, so a comparison with a constant
+//! holds for a contiguous range of encoded values. Vectors whose frame of reference and maximum delta lie outside of
+//! that range (and whose exceptions do not pass the filter) are not decoded at all.
+template <class T>
+struct AlpFilter {
+	//! Whether or not the filter consists of comparisons with constants that can be evaluated on encoded values
+	static bool IsSupported(const TableFilter &filter) {
+		switch (filter.filter_type) {
+		case TableFilterType::CONSTANT_COMPARISON: {
+			auto &constant_filter = (const ConstantFilter &)filter;
+			if (constant_filter.constant.IsNull() ||
+			    constant_filter.constant.type().InternalType() != GetTypeId<T>()) {
+				return false;
+			}
+			switch (constant_filter.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				return true;
+			default:
+				return false;
+			}
+		}
+		case TableFilterType::CONJUNCTION_AND: {
+			auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!IsSupported(*child_filter)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	//! Evaluates the filter on a single value
+	static bool Evaluate(const TableFilter &filter, T value) {
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!Evaluate(*child_filter, value)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		D_ASSERT(filter.filter_type == TableFilterType::CONSTANT_COMPARISON);
+		auto &constant_filter = (const ConstantFilter &)filter;
+		auto constant = constant_filter.constant.GetValueUnsafe<T>();
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			return Equals::Operation(value, constant);
+		case ExpressionType::COMPARE_LESSTHAN:
+			return LessThan::Operation(value, constant);
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return LessThanEquals::Operation(value, constant);
+		case ExpressionType::COMPARE_GREATERTHAN:
+			return GreaterThan::Operation(value, constant);
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return GreaterThanEquals::Operation(value, constant);
+		default:
+			throw InternalException("Unsupported comparison for ALP filter");
+		}
+	}
+
+	//! Finds the smallest encoded value in [lower, upper] for which OP(decoded, constant) holds, where OP is a
+	//! comparison that is monotonic in the decoded value. Returns upper + 1 if there is none.
+	template <class OP>
+	static int64_t FindFirst(int64_t lower, int64_t upper, const AlpVectorHeader &header, T constant) {
+		while (lower <= upper) {
+			auto middle = lower + (upper - lower) / 2;
+			if (OP::Operation(AlpPrimitives<T>::Decode(middle, header.exponent, header.factor), constant)) {
+				upper = middle - 1;
+			} else {
+				lower = middle + 1;
+			}
+		}
+		return lower;
+	}
+
+	//! Narrows [lower, upper] down to the encoded values that pass the filter, returns false if there are none
+	static bool NarrowRange(const TableFilter &filter, const AlpVectorHeader &header, int64_t &lower, int64_t &upper) {
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!NarrowRange(*child_filter, header, lower, upper)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		D_ASSERT(filter.filter_type == TableFilterType::CONSTANT_COMPARISON);
+		auto &constant_filter = (const ConstantFilter &)filter;
+		auto constant = constant_filter.constant.GetValueUnsafe<T>();
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL: {
+			auto first_greater = FindFirst<GreaterThan>(lower, upper, header, constant);
+			lower = FindFirst<GreaterThanEquals>(lower, upper, header, constant);
+			upper = first_greater - 1;
+			break;
+		}
+		case ExpressionType::COMPARE_LESSTHAN:
+			upper = FindFirst<GreaterThanEquals>(lower, upper, header, constant) - 1;
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			upper = FindFirst<GreaterThan>(lower, upper, header, constant) - 1;
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			lower = FindFirst<GreaterThan>(lower, upper, header, constant);
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			lower = FindFirst<GreaterThanEquals>(lower, upper, header, constant);
+			break;
+		default:
+			throw InternalException("Unsupported comparison for ALP filter");
+		}
+		return lower <= upper;
+	}
+
+	//! Scans [offset, offset + scan_count) of a vector and sets 'passes' for the rows that pass the filter
+	static void FilterVector(AlpScanState<T> &scan_state, idx_t vector_index, idx_t offset, idx_t scan_count,
+	                         const TableFilter &filter, T *result, bool *passes) {
+		auto vector_data = scan_state.GetVectorData(vector_index);
+		AlpVectorHeader header;
+		header.Read(vector_data);
+
+		int64_t lower = header.frame_of_reference;
+		int64_t upper = header.MaxEncoded();
+		bool range_passes = NarrowRange(filter, header, lower, upper);
+
+		// the exceptions are compared on their actual values
+		auto exception_data = vector_data + AlpConstants::VECTOR_HEADER_SIZE +
+		                      header.PackedSize(scan_state.GetVectorCount(vector_index));
+		auto position_data = exception_data + header.exception_count * sizeof(T);
+		bool exception_passes = false;
+		for (idx_t i = 0; i < header.exception_count && !exception_passes; i++) {
+			auto exception_position = Load<uint16_t>(position_data + i * sizeof(uint16_t));
+			if (exception_position >= offset && exception_position < offset + scan_count) {
+				exception_passes = Evaluate(filter, Load<T>(exception_data + i * sizeof(T)));
+			}
+		}
+		if (!range_passes && !exception_passes) {
+			// no row in this vector passes the filter: we do not need to decode it at all
+			memset(passes, 0, scan_count * sizeof(bool));
+			return;
+		}
+
+		scan_state.UnpackDeltas(vector_index, vector_data, header);
+		scan_state.DecodeValues(vector_data, header, offset, scan_count, result);
+		auto deltas = scan_state.deltas + offset;
+		if (range_passes) {
+			auto lower_delta = uint64_t(lower) - uint64_t(header.frame_of_reference);
+			auto range_size = uint64_t(upper) - uint64_t(lower);
+			for (idx_t i = 0; i < scan_count; i++) {
+				passes[i] = deltas[i] - lower_delta <= range_size;
+			}
+		} else {
+			memset(passes, 0, scan_count * sizeof(bool));
+		}
+		for (idx_t i = 0; i < header.exception_count; i++) {
+			auto exception_position = Load<uint16_t>(position_data + i * sizeof(uint16_t));
+			if (exception_position >= offset && exception_position < offset + scan_count) {
+				passes[exception_position - offset] = Evaluate(filter, Load<T>(exception_data + i * sizeof(T)));
+			}
+		}
+	}
+};
+
+template <class T>
+void AlpFilterScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                   SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	auto &mask = FlatVector::Validity(result);
+	if (!AlpFilter<T>::IsSupported(filter)) {
+		scan_state.ScanValues(result_data, scan_count);
+		ColumnSegment::FilterSelection(sel, result, filter, approved_tuple_count, mask);
+		return;
+	}
+
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+	bool passes[STANDARD_VECTOR_SIZE];
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto vector_index = scan_state.position / AlpConstants::ALP_VECTOR_SIZE;
+		auto offset = scan_state.position % AlpConstants::ALP_VECTOR_SIZE;
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, scan_state.GetVectorCount(vector_index) - offset);
+		AlpFilter<T>::FilterVector(scan_state, vector_index, offset, to_scan, filter, result_data + scanned,
+		                           passes + scanned);
+		scan_state.position += to_scan;
+		scanned += to_scan;
+	}
+
+	ColumnSegment::SelectPassingRows(sel, approved_tuple_count, passes, mask);
+}
+
+} // namespace duckdb
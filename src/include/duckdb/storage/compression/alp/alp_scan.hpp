@@ -0,0 +1,162 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/alp/alp_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/alp/alp.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+template <class T>
+struct AlpScanState : public SegmentScanState {
+public:
+	explicit AlpScanState(ColumnSegment &segment) : count(segment.count) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		// ScanStates never exceed the boundaries of a Segment,
+		// but are not guaranteed to start at the beginning of the Block
+		segment_data = handle.Ptr() + segment.GetBlockOffset();
+		metadata_end = segment_data + Load<uint32_t>(segment_data);
+	}
+
+	BufferHandle handle;
+	data_ptr_t segment_data;
+	data_ptr_t metadata_end;
+	idx_t count;
+	//! The position of the scan within the segment
+	idx_t position = 0;
+
+	//! The vector of which the deltas are unpacked
+	idx_t unpacked_vector = DConstants::INVALID_INDEX;
+	uint64_t deltas[AlpConstants::ALP_VECTOR_SIZE];
+	//! The vector that is decoded into the buffer, for scans that do not cover an entire vector
+	idx_t decoded_vector = DConstants::INVALID_INDEX;
+	T decoded[AlpConstants::ALP_VECTOR_SIZE];
+
+public:
+	data_ptr_t GetVectorData(idx_t vector_index) const {
+		auto offset = Load<uint32_t>(metadata_end - (vector_index + 1) * sizeof(uint32_t));
+		return segment_data + offset;
+	}
+
+	idx_t GetVectorCount(idx_t vector_index) const {
+		return MinValue<idx_t>(AlpConstants::ALP_VECTOR_SIZE, count - vector_index * AlpConstants::ALP_VECTOR_SIZE);
+	}
+
+	void UnpackDeltas(idx_t vector_index, data_ptr_t vector_data, const AlpVectorHeader &header) {
+		if (unpacked_vector == vector_index) {
+			return;
+		}
+		auto vector_count = GetVectorCount(vector_index);
+		if (header.bit_width == 0) {
+			memset(deltas, 0, vector_count * sizeof(uint64_t));
+		} else {
+			BitpackingPrimitives::UnPackBuffer<uint64_t>((data_ptr_t)deltas,
+			                                             vector_data + AlpConstants::VECTOR_HEADER_SIZE, vector_count,
+			                                             header.bit_width, true);
+		}
+		unpacked_vector = vector_index;
+	}
+
+	//! Decodes the values [offset, offset + decode_count) of the unpacked vector into the target
+	void DecodeValues(data_ptr_t vector_data, const AlpVectorHeader &header, idx_t offset, idx_t decode_count,
+	                  T *target) {
+		auto frame_of_reference = uint64_t(header.frame_of_reference);
+		auto factor = AlpConstants::FACTORS[header.factor];
+		auto fraction = AlpDoubleConstants::FRACTIONS[header.exponent];
+		auto source = deltas + offset;
+		for (idx_t i = 0; i < decode_count; i++) {
+			target[i] = T(double(int64_t(source[i] + frame_of_reference) * factor) * fraction);
+		}
+		// patch the exceptions
+		auto exception_data =
+		    vector_data + AlpConstants::VECTOR_HEADER_SIZE + header.PackedSize(GetVectorCount(unpacked_vector));
+		auto position_data = exception_data + header.exception_count * sizeof(T);
+		for (idx_t i = 0; i < header.exception_count; i++) {
+			auto exception_position = Load<uint16_t>(position_data + i * sizeof(uint16_t));
+			if (exception_position >= offset && exception_position < offset + decode_count) {
+				target[exception_position - offset] = Load<T>(exception_data + i * sizeof(T));
+			}
+		}
+	}
+
+	void ScanValues(T *result, idx_t scan_count) {
+		while (scan_count > 0) {
+			auto vector_index = position / AlpConstants::ALP_VECTOR_SIZE;
+			auto offset = position % AlpConstants::ALP_VECTOR_SIZE;
+			auto vector_count = GetVectorCount(vector_index);
+			auto to_scan = MinValue<idx_t>(scan_count, vector_count - offset);
+
+			if (offset == 0 && to_scan == vector_count) {
+				// decode the entire vector directly into the result
+				auto vector_data = GetVectorData(vector_index);
+				AlpVectorHeader header;
+				header.Read(vector_data);
+				UnpackDeltas(vector_index, vector_data, header);
+				DecodeValues(vector_data, header, 0, vector_count, result);
+			} else {
+				if (decoded_vector != vector_index) {
+					auto vector_data = GetVectorData(vector_index);
+					AlpVectorHeader header;
+					header.Read(vector_data);
+					UnpackDeltas(vector_index, vector_data, header);
+					DecodeValues(vector_data, header, 0, vector_count, decoded);
+					decoded_vector = vector_index;
+				}
+				memcpy(result, decoded + offset, to_scan * sizeof(T));
+			}
+			result += to_scan;
+			position += to_scan;
+			scan_count -= to_scan;
+		}
+	}
+
+	void Skip(idx_t skip_count) {
+		// every vector can be accessed directly through the metadata, so skipping only moves the position
+		position += skip_count;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> AlpInitScan(ColumnSegment &segment) {
+	auto result = make_unique_base<SegmentScanState, AlpScanState<T>>(segment);
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void AlpScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                    idx_t result_offset) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.ScanValues(result_data + result_offset, scan_count);
+}
+
+template <class T>
+void AlpSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	auto &scan_state = (AlpScanState<T> &)*state.scan_state;
+	scan_state.Skip(skip_count);
+}
+
+template <class T>
+void AlpScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	AlpScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+} // namespace duckdb
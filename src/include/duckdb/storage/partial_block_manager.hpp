@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/meta_block_writer.hpp"
 #include "duckdb/storage/data_pointer.hpp"
@@ -62,7 +63,8 @@ struct PartialBlockAllocation {
 
 //! Enables sharing blocks across some scope. Scope is whatever we want to share
 //! blocks across. It may be an entire checkpoint or just a single row group.
-//! In any case, they must share a block manager.
+//! In any case, they must share a block manager. Blocks can be allocated and registered
+//! concurrently, e.g. by the tasks of a parallel checkpoint.
 class PartialBlockManager {
 public:
 	// 20% free / 80% utilization
@@ -94,6 +96,8 @@ public:
 
 protected:
 	BlockManager &block_manager;
+	//! Lock for the partially filled blocks
+	mutex partial_block_lock;
 	//! A map of (available space -> PartialBlock) for partially filled blocks
 	//! This is a multimap because there might be outstanding partial blocks with
 	//! the same amount of left-over space
@@ -48,6 +48,8 @@ public:
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Read the content of a set of blocks from disk in a single batch
+	void ReadBlocks(const vector<Block *> &blocks) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -65,6 +67,7 @@ private:
 	void Initialize(DatabaseHeader &header);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	void VerifyChecksum(FileBuffer &handle) const;
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	//! Return the blocks to which we will write the free list and modified blocks
@@ -141,6 +141,14 @@ protected:
 
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining);
+	//! Prefetches the blocks of the segments ahead of the scan, if the current segment has not been prefetched yet
+	void PrefetchSegments(ColumnScanState &state);
+	//! Prepares the scan of the next vector for FilterSegment: returns true if the vector lies within a single segment
+	//! whose compression function can evaluate filters, and the column has no updates
+	bool CanFilterSegment(ColumnScanState &state);
+	//! Scans the next vector from the current segment and evaluates the filter on the compressed data
+	void FilterSegment(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &count,
+	                   const TableFilter &filter);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -154,7 +162,7 @@ protected:
 	//! The updates for this column segment
 	unique_ptr<UpdateSegment> updates;
 	//! The internal version of the column data
-	idx_t version;
+	atomic<idx_t> version;
 };
 
 } // namespace duckdb
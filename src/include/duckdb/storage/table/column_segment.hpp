@@ -71,6 +71,19 @@ public:
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
 	                             idx_t &approved_tuple_count, ValidityMask &mask);
+	//! Whether or not the filter only compares values with constants, i.e. it does not look at the validity of rows.
+	//! Such filters can be evaluated once per distinct value of a segment (e.g. per dictionary entry or per run).
+	static bool FilterComparesValues(const TableFilter &filter);
+	//! Evaluates a filter that compares values on the first 'count' values of 'values', which are all considered
+	//! valid, and sets 'passes' for the values that pass it
+	static void FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *passes);
+	//! Narrows the selection vector down to the valid rows for which 'passes' is set
+	static void SelectPassingRows(SelectionVector &sel, idx_t &approved_tuple_count, const bool *passes,
+	                              ValidityMask &mask);
+	//! Scan one vector from this segment and evaluate the filter on the compressed data, which requires the
+	//! compression function to support filters
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
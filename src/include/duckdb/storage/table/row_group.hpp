@@ -132,7 +132,13 @@ public:
 	idx_t Delete(TransactionData transaction, DataTable *table, row_t *row_ids, idx_t count);
 
 	RowGroupWriteData WriteToDisk(PartialBlockManager &manager, const vector<CompressionType> &compression_types);
-	RowGroupPointer Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats);
+	//! Compresses and writes a single column of the row group. This can run in parallel for different columns and row
+	//! groups, as long as the partial block manager is shared by all of them.
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(idx_t column_idx, PartialBlockManager &manager,
+	                                                    CompressionType compression_type);
+	//! Writes the column data pointers of the row group that was written to disk to the metadata of the writer
+	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
+	                           vector<unique_ptr<BaseStatistics>> &global_stats);
 	static void Serialize(RowGroupPointer &pointer, Serializer &serializer);
 	static RowGroupPointer Deserialize(Deserializer &source, const ColumnList &columns);
 
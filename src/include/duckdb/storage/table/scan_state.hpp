@@ -55,6 +55,8 @@ struct ColumnScanState {
 	vector<ColumnScanState> child_states;
 	//! Whether or not InitializeState has been called for this segment
 	bool initialized = false;
+	//! The row index up to which the blocks of the segments have been prefetched
+	idx_t prefetch_end = 0;
 	//! If this segment has already been checked for skipping purposes
 	bool segment_checked = false;
 	//! The version of the column data that we are scanning.
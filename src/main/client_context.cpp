@@ -1156,6 +1156,7 @@ ParserOptions ClientContext::GetParserOptions() const {
 ClientProperties ClientContext::GetClientProperties() const {
 	ClientProperties properties;
 	properties.timezone = ClientConfig::GetConfig(*this).ExtractTimezone();
+	properties.arrow_string_dictionary = ClientConfig::GetConfig(*this).arrow_string_dictionary;
 	return properties;
 }
 
@@ -248,6 +248,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	}
 
 	// only increase thread count after storage init because we get races on catalog otherwise
+	scheduler->SetThreadPinning(config.options.pin_threads);
     scheduler->SetThreads(config.options.maximum_threads);
 }
 
@@ -31,6 +31,10 @@ bool QueryProfiler::IsDetailedEnabled() const {
 	return is_explain_analyze ? false : ClientConfig::GetConfig(context).enable_detailed_profiling;
 }
 
+bool QueryProfiler::HardwareCountersEnabled() const {
+	return IsEnabled() && ClientConfig::GetConfig(context).enable_hardware_counters;
+}
+
 ProfilerPrintFormat QueryProfiler::GetPrintFormat() const {
 	return ClientConfig::GetConfig(context).profiler_print_format;
 }
@@ -66,6 +70,7 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	this->running = true;
 	this->query = std::move(query);
 	tree_map.clear();
+	inserted_operators.clear();
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
@@ -102,6 +107,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
 	case PhysicalOperatorType::RECURSIVE_CTE:
+	case PhysicalOperatorType::CTE:
 	case PhysicalOperatorType::EMPTY_RESULT:
 		return true;
 	default:
@@ -216,13 +222,15 @@ void QueryProfiler::Initialize(PhysicalOperator *root_op) {
 		// query does not require profiling: disable profiling for this query
 		this->running = false;
 		tree_map.clear();
+		inserted_operators.clear();
 		root = nullptr;
 		phase_timings.clear();
 		phase_stack.clear();
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(bool enabled_p, bool hardware_counters_p)
+    : enabled(enabled_p), hardware_counters(enabled_p && hardware_counters_p), active_operator(nullptr) {
 }
 
 void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
@@ -238,6 +246,9 @@ void OperatorProfiler::StartOperator(const PhysicalOperator *phys_op) {
 
 	// start timing for current element
 	op.Start();
+	if (hardware_counters) {
+		HardwareCounters::Get().Read(start_counters);
+	}
 }
 
 void OperatorProfiler::EndOperator(DataChunk *chunk) {
@@ -253,6 +264,16 @@ void OperatorProfiler::EndOperator(DataChunk *chunk) {
 	op.End();
 
 	AddTiming(active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	if (hardware_counters) {
+		auto &counters = HardwareCounters::Get();
+		if (counters.IsAvailable()) {
+			HardwareCounterValues end_counters;
+			counters.Read(end_counters);
+			auto &info = timings[active_operator];
+			info.has_counters = true;
+			info.counters += end_counters.Difference(start_counters);
+		}
+	}
 	active_operator = nullptr;
 }
 
@@ -294,10 +315,25 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	}
 	for (auto &node : profiler.timings) {
 		auto entry = tree_map.find(node.first);
-		D_ASSERT(entry != tree_map.end());
+		if (entry == tree_map.end()) {
+			// an operator that was inserted during execution: its time counts towards the planned operator
+			auto inserted = inserted_operators.find(node.first);
+			D_ASSERT(inserted != inserted_operators.end());
+			if (inserted != inserted_operators.end()) {
+				auto planned = tree_map.find(inserted->second);
+				if (planned != tree_map.end()) {
+					planned->second->info.time += node.second.time;
+				}
+			}
+			continue;
+		}
 
 		entry->second->info.time += node.second.time;
 		entry->second->info.elements += node.second.elements;
+		if (node.second.has_counters) {
+			entry->second->info.has_counters = true;
+			entry->second->info.counters += node.second.counters;
+		}
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -315,6 +351,27 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	profiler.timings.clear();
 }
 
+void QueryProfiler::AddExtraInfo(const PhysicalOperator *phys_op, const string &info) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running || info.empty()) {
+		return;
+	}
+	auto entry = tree_map.find(phys_op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	auto &extra_info = entry->second->extra_info;
+	extra_info += extra_info.empty() ? info : "\n" + info;
+}
+
+void QueryProfiler::AddInsertedOperator(const PhysicalOperator *phys_op, const PhysicalOperator *planned_op) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	inserted_operators[phys_op] = planned_op;
+}
+
 static string DrawPadded(const string &str, idx_t width) {
 	if (str.size() > width) {
 		return str.substr(0, width);
@@ -398,6 +455,13 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 		ss << "││" + DrawPadded(get, TOTAL_BOX_WIDTH - 4) + "││\n";
 		ss << "││" + DrawPadded(put, TOTAL_BOX_WIDTH - 4) + "││\n";
 		ss << "││" + DrawPadded(post, TOTAL_BOX_WIDTH - 4) + "││\n";
+		auto &http_stats = *context.client_data->http_stats;
+		if (http_stats.cache_hit_count > 0 || http_stats.cache_miss_count > 0) {
+			string cache_hit = "#CACHE HIT: " + to_string(http_stats.cache_hit_count);
+			string cache_miss = "#CACHE MISS: " + to_string(http_stats.cache_miss_count);
+			ss << "││" + DrawPadded(cache_hit, TOTAL_BOX_WIDTH - 4) + "││\n";
+			ss << "││" + DrawPadded(cache_miss, TOTAL_BOX_WIDTH - 4) + "││\n";
+		}
 		ss << "│└───────────────────────────────────┘│\n";
 		ss << "└─────────────────────────────────────┘\n";
 	}
@@ -520,6 +584,14 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, int
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
+	if (node.info.has_counters) {
+		ss << string(depth * 3, ' ') << "   \"hardware_counters\": {";
+		for (idx_t i = 0; i < HardwareCounterValues::COUNTER_COUNT; i++) {
+			ss << (i > 0 ? ", " : "") << "\"" << HardwareCounterValues::GetName(i)
+			   << "\": " << to_string(node.info.counters.values[i]);
+		}
+		ss << "},\n";
+	}
 	ss << string(depth * 3, ' ') << "   \"timings\": [";
 	int32_t function_counter = 1;
 	int32_t expression_counter = 1;
@@ -1,6 +1,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
@@ -52,6 +53,40 @@ Value AccessModeSetting::GetSetting(ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Adaptive Join Order Threshold
+//===--------------------------------------------------------------------===//
+void AdaptiveJoinOrderThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1) {
+		throw InvalidInputException("Adaptive join order threshold must be 0 (disabled) or at least 1");
+	}
+	ClientConfig::GetConfig(context).adaptive_join_order_threshold = threshold;
+}
+
+void AdaptiveJoinOrderThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_join_order_threshold = ClientConfig().adaptive_join_order_threshold;
+}
+
+Value AdaptiveJoinOrderThresholdSetting::GetSetting(ClientContext &context) {
+	return Value::DOUBLE(ClientConfig::GetConfig(context).adaptive_join_order_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Arrow String Dictionary
+//===--------------------------------------------------------------------===//
+void ArrowStringDictionarySetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).arrow_string_dictionary = input.GetValue<bool>();
+}
+
+void ArrowStringDictionarySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).arrow_string_dictionary = ClientConfig().arrow_string_dictionary;
+}
+
+Value ArrowStringDictionarySetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).arrow_string_dictionary);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -371,6 +406,21 @@ Value EnableObjectCacheSetting::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(config.options.object_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Hardware Counters
+//===--------------------------------------------------------------------===//
+void EnableHardwareCountersSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = ClientConfig().enable_hardware_counters;
+}
+
+void EnableHardwareCountersSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = input.GetValue<bool>();
+}
+
+Value EnableHardwareCountersSetting::GetSetting(ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_hardware_counters);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable HTTP Metadata Cache
 //===--------------------------------------------------------------------===//
@@ -480,6 +530,22 @@ Value EnableProgressBarPrintSetting::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).print_progress_bar);
 }
 
+//===--------------------------------------------------------------------===//
+// Eviction Policy
+//===--------------------------------------------------------------------===//
+void EvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.eviction_policy = EvictionPolicyFromString(input.ToString());
+}
+
+void EvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.eviction_policy = DBConfig().options.eviction_policy;
+}
+
+Value EvictionPolicySetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(EvictionPolicyToString(config.options.eviction_policy));
+}
+
 //===--------------------------------------------------------------------===//
 // Experimental Parallel CSV
 //===--------------------------------------------------------------------===//
@@ -782,6 +848,28 @@ Value PreserveIdentifierCase::GetSetting(ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).preserve_identifier_case);
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.pin_threads = input.GetValue<bool>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinning(config.options.pin_threads);
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetThreadPinning(config.options.pin_threads);
+	}
+}
+
+Value PinThreadsSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.pin_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // PreserveInsertionOrder
 //===--------------------------------------------------------------------===//
@@ -891,6 +979,49 @@ Value ProgressBarTimeSetting::GetSetting(ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority_weight = ClientConfig().query_priority_weight;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	idx_t weight;
+	if (parameter == "low") {
+		weight = TaskScheduler::LOW_PRIORITY_WEIGHT;
+	} else if (parameter == "normal") {
+		weight = TaskScheduler::NORMAL_PRIORITY_WEIGHT;
+	} else if (parameter == "high") {
+		weight = TaskScheduler::HIGH_PRIORITY_WEIGHT;
+	} else {
+		int64_t numeric_weight;
+		if (!TryCast::Operation<string_t, int64_t>(string_t(parameter), numeric_weight) || numeric_weight < 1 ||
+		    numeric_weight > int64_t(TaskScheduler::MAXIMUM_PRIORITY_WEIGHT)) {
+			throw ParserException(
+			    "Unrecognized query priority \"%s\", expected either LOW, NORMAL, HIGH or a weight between 1 and %llu",
+			    parameter, TaskScheduler::MAXIMUM_PRIORITY_WEIGHT);
+		}
+		weight = numeric_weight;
+	}
+	ClientConfig::GetConfig(context).query_priority_weight = weight;
+}
+
+Value QueryPrioritySetting::GetSetting(ClientContext &context) {
+	auto weight = ClientConfig::GetConfig(context).query_priority_weight;
+	switch (weight) {
+	case TaskScheduler::LOW_PRIORITY_WEIGHT:
+		return "low";
+	case TaskScheduler::NORMAL_PRIORITY_WEIGHT:
+		return "normal";
+	case TaskScheduler::HIGH_PRIORITY_WEIGHT:
+		return "high";
+	default:
+		return Value(to_string(weight));
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -958,6 +1089,22 @@ Value TempDirectorySetting::GetSetting(ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temporary_file_compression = BooleanValue::Get(input);
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temporary_file_compression = DBConfig().options.temporary_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temporary_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
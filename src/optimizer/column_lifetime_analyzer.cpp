@@ -100,6 +100,13 @@ void ColumnLifetimeAnalyzer::VisitOperator(LogicalOperator &op) {
 			analyzer.VisitOperator(*child);
 		}
 		return;
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// all columns of the CTE are referenced by its scans
+		ColumnLifetimeAnalyzer analyzer(true);
+		analyzer.VisitOperator(*op.children[0]);
+		VisitOperator(*op.children[1]);
+		return;
+	}
 	case LogicalOperatorType::LOGICAL_PROJECTION: {
 		// then recurse into the children of this projection
 		ColumnLifetimeAnalyzer analyzer;
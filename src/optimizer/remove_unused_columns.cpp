@@ -305,6 +305,13 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 		everything_referenced = true;
 		break;
 	}
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
+		// all columns of the CTE are referenced by its scans, the main query only produces the referenced columns
+		RemoveUnusedColumns remove(binder, context, true);
+		remove.VisitOperator(*op.children[0]);
+		VisitOperator(*op.children[1]);
+		return;
+	}
 	default:
 		break;
 	}
@@ -155,7 +155,13 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 			auto dep = dependency.lock();
 			D_ASSERT(dep);
 			auto event_map_entry = event_map.find(dep.get());
-			D_ASSERT(event_map_entry != event_map.end());
+			if (event_map_entry == event_map.end()) {
+				// when the pipelines of a recursive CTE are rescheduled, they can depend on a pipeline outside of the
+				// recursion (a materialized CTE that is scanned in the recursion). The recursive CTE depends on those
+				// pipelines too, so they have already finished and are not rescheduled
+				D_ASSERT(!event_data.initial_schedule);
+				continue;
+			}
 			auto &dep_entry = event_map_entry->second;
 			D_ASSERT(dep_entry.pipeline_complete_event);
 			entry.second.pipeline_event->AddDependency(*dep_entry.pipeline_complete_event);
@@ -324,6 +330,7 @@ void Executor::InitializeInternal(PhysicalOperator *plan) {
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(physical_plan);
 		this->producer = scheduler.CreateProducer();
+		producer->SetWeight(ClientConfig::GetConfig(context).query_priority_weight);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
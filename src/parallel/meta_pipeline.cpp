@@ -46,6 +46,24 @@ void MetaPipeline::GetMetaPipelines(vector<shared_ptr<MetaPipeline>> &result, bo
 	}
 }
 
+void MetaPipeline::GetExternalDependencies(vector<shared_ptr<Pipeline>> &result) {
+	vector<shared_ptr<Pipeline>> all_pipelines;
+	GetPipelines(all_pipelines, true);
+	unordered_set<Pipeline *> internal;
+	for (auto &pipeline : all_pipelines) {
+		internal.insert(pipeline.get());
+	}
+	for (auto &pipeline : all_pipelines) {
+		for (auto &dependency : pipeline->dependencies) {
+			auto dep = dependency.lock();
+			D_ASSERT(dep);
+			if (internal.find(dep.get()) == internal.end()) {
+				result.push_back(std::move(dep));
+			}
+		}
+	}
+}
+
 const vector<Pipeline *> *MetaPipeline::GetDependencies(Pipeline *dependant) const {
 	auto it = dependencies.find(dependant);
 	if (it == dependencies.end()) {
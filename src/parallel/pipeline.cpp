@@ -5,14 +5,19 @@
 #include "duckdb/common/tree_renderer.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 
 #include <iostream>
 #include <algorithm>
@@ -36,6 +41,10 @@ public:
 	unique_ptr<PipelineExecutor> pipeline_executor;
 
 public:
+	idx_t GetPreferredNode() override {
+		return pipeline.GetPreferredNode();
+	}
+
 	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
         if (!pipeline_executor) {
 			pipeline_executor = make_unique<PipelineExecutor>(pipeline.GetClientContext(), pipeline);
@@ -190,10 +199,156 @@ void Pipeline::SetPipelineId(idx_t pl_id) {
     pipeline_id = pl_id;
 }
 
+//! Collects the number of input columns referenced by an expression, returns false if it cannot be moved
+static bool GetReferencedColumnCount(const Expression &expr, idx_t &column_count) {
+	if (expr.HasSideEffects()) {
+		return false;
+	}
+	if (expr.type == ExpressionType::BOUND_REF) {
+		auto &ref = (BoundReferenceExpression &)expr;
+		column_count = MaxValue<idx_t>(column_count, ref.index + 1);
+		return true;
+	}
+	bool result = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		result = result && GetReferencedColumnCount(child, column_count);
+	});
+	return result;
+}
+
+//! Returns the hash join if op is a probe that can be moved anywhere within a run of probes with the given input
+static PhysicalHashJoin *GetReorderableProbe(PhysicalOperator &op, const vector<LogicalType> &run_input_types,
+                                             idx_t op_input_width) {
+	if (op.type != PhysicalOperatorType::HASH_JOIN) {
+		return nullptr;
+	}
+	auto &join = (PhysicalHashJoin &)op;
+	if (!join.CanReorderProbe() || join.GetTypes().size() != op_input_width + join.build_types.size()) {
+		return nullptr;
+	}
+	// the join keys may only reference the columns that are there before any of the probes in the run
+	idx_t column_count = 0;
+	for (auto &condition : join.conditions) {
+		if (!GetReferencedColumnCount(*condition.left, column_count)) {
+			return nullptr;
+		}
+	}
+	return column_count <= run_input_types.size() ? &join : nullptr;
+}
+
+//! The factor by which the build side of the join was misestimated
+static double GetBuildMisestimate(PhysicalHashJoin &join) {
+	auto estimated = MaxValue<double>(join.children[1]->estimated_cardinality, 1);
+	auto actual = MaxValue<double>(join.BuildCardinality(), 1);
+	return MaxValue<double>(estimated / actual, actual / estimated);
+}
+
+//! The estimated number of output rows per probed row, scaled by the observed size of the build side
+static double GetProbeFanOut(PhysicalHashJoin &join) {
+	auto estimated_input = MaxValue<double>(join.children[0]->estimated_cardinality, 1);
+	auto estimated_build = MaxValue<double>(join.children[1]->estimated_cardinality, 1);
+	return double(join.estimated_cardinality) / estimated_input * double(join.BuildCardinality()) / estimated_build;
+}
+
+void Pipeline::ReorderJoinProbes() {
+	if (probes_reordered) {
+		return;
+	}
+	probes_reordered = true;
+	auto threshold = ClientConfig::GetConfig(GetClientContext()).adaptive_join_order_threshold;
+	if (threshold <= 0 || global_suspend || global_resume) {
+		// suspended queries are resumed from the states of the operators as they were planned
+		return;
+	}
+	vector<PhysicalOperator *> new_operators;
+	vector<vector<LogicalType>> new_types;
+	bool reordered = false;
+	idx_t op_idx = 0;
+	while (op_idx < operators.size()) {
+		// find the run of probes starting at this operator whose join keys are all computed from the same input
+		auto &input_types = op_idx == 0 ? source->GetTypes() : operators[op_idx - 1]->GetTypes();
+		vector<PhysicalHashJoin *> joins;
+		bool misestimated = false;
+		for (idx_t run_idx = op_idx; run_idx < operators.size(); run_idx++) {
+			auto op_input_width = run_idx == op_idx ? input_types.size() : operators[run_idx - 1]->GetTypes().size();
+			auto join = GetReorderableProbe(*operators[run_idx], input_types, op_input_width);
+			if (!join) {
+				break;
+			}
+			misestimated = misestimated || GetBuildMisestimate(*join) >= threshold;
+			joins.push_back(join);
+		}
+		// the planned order was based on the estimates: if one was off, the most selective probes go first
+		vector<idx_t> order;
+		for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+			order.push_back(join_idx);
+		}
+		if (joins.size() > 1 && misestimated) {
+			vector<double> fan_outs;
+			for (auto &join : joins) {
+				fan_outs.push_back(GetProbeFanOut(*join));
+			}
+			std::stable_sort(order.begin(), order.end(),
+			                 [&](idx_t left, idx_t right) { return fan_outs[left] < fan_outs[right]; });
+		}
+		if (std::is_sorted(order.begin(), order.end())) {
+			// keep the operators in the planned order
+			auto run_end = op_idx + MaxValue<idx_t>(joins.size(), 1);
+			for (; op_idx < run_end; op_idx++) {
+				new_operators.push_back(operators[op_idx]);
+				new_types.push_back(operators[op_idx]->GetTypes());
+			}
+			continue;
+		}
+		// every probe appends its build columns: the columns of the run now end up in a different order
+		vector<LogicalType> types = input_types;
+		vector<idx_t> build_offsets(joins.size());
+		for (auto &join_idx : order) {
+			auto &join = *joins[join_idx];
+			build_offsets[join_idx] = types.size();
+			types.insert(types.end(), join.build_types.begin(), join.build_types.end());
+			new_operators.push_back(&join);
+			new_types.push_back(types);
+		}
+		// project them back into the planned order for the operators after the run
+		vector<unique_ptr<Expression>> select_list;
+		for (idx_t col_idx = 0; col_idx < input_types.size(); col_idx++) {
+			select_list.push_back(make_unique<BoundReferenceExpression>(input_types[col_idx], col_idx));
+		}
+		for (idx_t join_idx = 0; join_idx < joins.size(); join_idx++) {
+			auto &build_types = joins[join_idx]->build_types;
+			for (idx_t col_idx = 0; col_idx < build_types.size(); col_idx++) {
+				select_list.push_back(
+				    make_unique<BoundReferenceExpression>(build_types[col_idx], build_offsets[join_idx] + col_idx));
+			}
+		}
+		auto &output_types = joins.back()->GetTypes();
+		auto projection = make_unique<PhysicalProjection>(output_types, std::move(select_list),
+		                                                  joins.back()->estimated_cardinality);
+		new_operators.push_back(projection.get());
+		new_types.push_back(output_types);
+		auto &profiler = QueryProfiler::Get(GetClientContext());
+		profiler.AddInsertedOperator(projection.get(), joins.back());
+		for (idx_t probe_idx = 0; probe_idx < order.size(); probe_idx++) {
+			profiler.AddExtraInfo(joins[order[probe_idx]],
+			                      StringUtil::Format("Probe Order: %llu of %llu", probe_idx + 1, joins.size()));
+		}
+		owned_operators.push_back(std::move(projection));
+		op_idx += joins.size();
+		reordered = true;
+	}
+	if (reordered) {
+		operators = std::move(new_operators);
+		operator_types = std::move(new_types);
+	}
+}
+
 void Pipeline::Schedule(shared_ptr<Event> &event) {
 	D_ASSERT(ready);
 	D_ASSERT(sink);
+	ReorderJoinProbes();
 	Reset();
+	preferred_node = TaskScheduler::GetScheduler(executor.context).GetCurrentNode();
 	if (!ScheduleParallel(event)) {
 		// could not parallelize this pipeline: push a sequential task instead
 		ScheduleSequentialTask(event);
@@ -309,6 +464,11 @@ vector<PhysicalOperator *> Pipeline::GetOperators() const {
 	return result;
 }
 
+const vector<LogicalType> &Pipeline::GetOperatorTypes(idx_t operator_idx) const {
+	D_ASSERT(operator_idx < operators.size());
+	return operator_types.empty() ? operators[operator_idx]->GetTypes() : operator_types[operator_idx];
+}
+
 //===--------------------------------------------------------------------===//
 // Pipeline Build State
 //===--------------------------------------------------------------------===//
@@ -17,11 +17,11 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
 	for (idx_t i = 0; i < pipeline.operators.size(); i++) {
-		auto prev_operator = i == 0 ? pipeline.source : pipeline.operators[i - 1];
+		auto &input_types = i == 0 ? pipeline.source->GetTypes() : pipeline.GetOperatorTypes(i - 1);
 		auto current_operator = pipeline.operators[i];
 
 		auto chunk = make_unique<DataChunk>();
-		chunk->Initialize(Allocator::Get(context.client), prev_operator->GetTypes());
+		chunk->Initialize(Allocator::Get(context.client), input_types);
 		intermediate_chunks.push_back(std::move(chunk));
 
 		auto op_state = current_operator->GetOperatorState(context);
@@ -344,8 +344,9 @@ void PipelineExecutor::FetchFromSource(DataChunk &result) {
 }
 
 void PipelineExecutor::InitializeChunk(DataChunk &chunk) {
-	PhysicalOperator *last_op = pipeline.operators.empty() ? pipeline.source : pipeline.operators.back();
-	chunk.Initialize(Allocator::DefaultAllocator(), last_op->GetTypes());
+	auto &types = pipeline.operators.empty() ? pipeline.source->GetTypes()
+	                                         : pipeline.GetOperatorTypes(pipeline.operators.size() - 1);
+	chunk.Initialize(Allocator::DefaultAllocator(), types);
 }
 
 void PipelineExecutor::StartOperator(PhysicalOperator *op) {
@@ -12,7 +12,13 @@
 #include <queue>
 #endif
 
+#include <chrono>
+#include <deque>
+#include <fstream>
 #include <iostream>
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 namespace duckdb {
 
@@ -25,16 +31,154 @@ struct SchedulerThread {
 #endif
 };
 
+//! A task together with the producer that scheduled it
+struct ScheduledTask {
+	ScheduledTask() {
+	}
+	ScheduledTask(ProducerToken &token, unique_ptr<Task> task) : state(token.state), task(std::move(task)) {
+	}
+
+	//! The state of the producer, which outlives the producer itself: tasks never refer to the producer directly
+	shared_ptr<ProducerState> state;
+	unique_ptr<Task> task;
+};
+
+//! The local task queue of a background thread. The owning thread pushes and pops at the back, other threads steal
+//! from the front
+struct WorkerQueue {
+	WorkerQueue(TaskScheduler &scheduler, idx_t node) : scheduler(scheduler), node(node), size(0), retired(false) {
+	}
+
+	TaskScheduler &scheduler;
+	//! The NUMA node the worker is pinned to (0 if threads are not pinned)
+	idx_t node;
+	mutex lock;
+	std::deque<ScheduledTask> tasks;
+	//! The amount of tasks in the queue, used to skip empty queues without taking the lock
+	atomic<idx_t> size;
+	//! Set when the worker is stopped, after which no more tasks are accepted
+	bool retired;
+
+	bool Push(ScheduledTask &task) {
+		lock_guard<mutex> guard(lock);
+		if (retired) {
+			return false;
+		}
+		tasks.push_back(std::move(task));
+		size++;
+		return true;
+	}
+
+	bool PopBack(ScheduledTask &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back());
+		tasks.pop_back();
+		size--;
+		return true;
+	}
+
+	bool PopFront(ScheduledTask &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front());
+		tasks.pop_front();
+		size--;
+		return true;
+	}
+
+	bool PopFromProducer(ProducerToken &token, ScheduledTask &task) {
+		if (size == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		for (auto it = tasks.begin(); it != tasks.end(); it++) {
+			if (it->state == token.state) {
+				task = std::move(*it);
+				tasks.erase(it);
+				size--;
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+//! The CPUs of every NUMA node of the machine
+struct NumaTopology {
+	vector<vector<idx_t>> node_cpus;
+
+	idx_t NodeCount() const {
+		return node_cpus.empty() ? 1 : node_cpus.size();
+	}
+
+	//! Parses a Linux cpu/node list of the form "0-3,8,10-11"
+	static vector<idx_t> ParseList(const string &list) {
+		vector<idx_t> result;
+		for (auto &range : StringUtil::Split(list, ',')) {
+			auto bounds = StringUtil::Split(range, '-');
+			if (bounds.empty() || bounds.size() > 2) {
+				continue;
+			}
+			idx_t start = std::stoull(bounds[0]);
+			idx_t end = bounds.size() == 2 ? std::stoull(bounds[1]) : start;
+			for (idx_t i = start; i <= end; i++) {
+				result.push_back(i);
+			}
+		}
+		return result;
+	}
+
+	static string ReadLine(const string &path) {
+		std::ifstream file(path);
+		string line;
+		if (file.good()) {
+			std::getline(file, line);
+		}
+		StringUtil::Trim(line);
+		return line;
+	}
+
+	static unique_ptr<NumaTopology> Detect() {
+		auto result = make_unique<NumaTopology>();
+#ifdef __linux__
+		try {
+			for (auto node : ParseList(ReadLine("/sys/devices/system/node/online"))) {
+				auto cpus = ParseList(ReadLine("/sys/devices/system/node/node" + to_string(node) + "/cpulist"));
+				if (!cpus.empty()) {
+					result->node_cpus.push_back(std::move(cpus));
+				}
+			}
+		} catch (std::exception &ex) {
+			// malformed topology information: treat the machine as a single node
+			result->node_cpus.clear();
+		}
+#endif
+		return result;
+	}
+};
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<Task>> concurrent_queue_t;
+typedef duckdb_moodycamel::ConcurrentQueue<ScheduledTask> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, ScheduledTask task);
+	bool DequeueFromProducer(ProducerToken &token, ScheduledTask &task);
+	bool Dequeue(ScheduledTask &task);
 };
 
 struct QueueProducerToken {
@@ -44,35 +188,49 @@ struct QueueProducerToken {
 	duckdb_moodycamel::ProducerToken queue_token;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, ScheduledTask task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
+	token.state->queued_tasks++;
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
 		semaphore.signal();
 	} else {
+		token.state->queued_tasks--;
 		throw InternalException("Could not schedule task!");
 	}
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, ScheduledTask &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	if (!q.try_dequeue_from_producer(token.token->queue_token, task)) {
+		return false;
+	}
+	task.state->queued_tasks--;
+	return true;
+}
+
+bool ConcurrentQueue::Dequeue(ScheduledTask &task) {
+	if (!q.try_dequeue(task)) {
+		return false;
+	}
+	task.state->queued_tasks--;
+	return true;
 }
 
 #else
 struct ConcurrentQueue {
-	std::queue<std::unique_ptr<Task>> q;
+	std::queue<ScheduledTask> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+	void Enqueue(ProducerToken &token, ScheduledTask task);
+	bool DequeueFromProducer(ProducerToken &token, ScheduledTask &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, ScheduledTask task) {
 	lock_guard<mutex> lock(qlock);
 	q.push(std::move(task));
 }
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
+bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, ScheduledTask &task) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
 		return false;
@@ -88,14 +246,38 @@ struct QueueProducerToken {
 };
 #endif
 
+constexpr idx_t TaskScheduler::LOW_PRIORITY_WEIGHT;
+constexpr idx_t TaskScheduler::NORMAL_PRIORITY_WEIGHT;
+constexpr idx_t TaskScheduler::HIGH_PRIORITY_WEIGHT;
+constexpr idx_t TaskScheduler::MAXIMUM_PRIORITY_WEIGHT;
+
+ProducerState::ProducerState(idx_t weight)
+    : weight(weight), virtual_time(0), queued_tasks(0), active_tasks(0), producer(nullptr) {
+}
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+    : scheduler(scheduler), token(std::move(token)),
+      state(make_shared<ProducerState>(TaskScheduler::NORMAL_PRIORITY_WEIGHT)) {
+	scheduler.RegisterProducer(*this);
 }
 
 ProducerToken::~ProducerToken() {
+	scheduler.UnregisterProducer(*this);
 }
 
-TaskScheduler::TaskScheduler(DatabaseInstance &db) : db(db), queue(make_unique<ConcurrentQueue>()) {
+void ProducerToken::SetWeight(idx_t weight) {
+	D_ASSERT(weight > 0);
+	state->weight = weight;
+}
+
+#ifndef DUCKDB_NO_THREADS
+//! The local queue of the calling thread if it is a background thread of a task scheduler
+static thread_local WorkerQueue *current_worker = nullptr;
+#endif
+
+TaskScheduler::TaskScheduler(DatabaseInstance &db)
+    : db(db), queue(make_unique<ConcurrentQueue>()), topology(NumaTopology::Detect()), pin_threads(false),
+      next_worker(0), busy_producers(0), virtual_clock(0) {
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -117,25 +299,241 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 	return make_unique<ProducerToken>(*this, std::move(token));
 }
 
+void TaskScheduler::RegisterProducer(ProducerToken &token) {
+	lock_guard<mutex> guard(producers_lock);
+	token.state->producer = &token;
+	producers.push_back(&token);
+}
+
+void TaskScheduler::UnregisterProducer(ProducerToken &token) {
+	lock_guard<mutex> guard(producers_lock);
+	token.state->producer = nullptr;
+	for (idx_t i = 0; i < producers.size(); i++) {
+		if (producers[i] == &token) {
+			producers.erase(producers.begin() + i);
+			break;
+		}
+	}
+}
+
+shared_ptr<vector<shared_ptr<WorkerQueue>>> TaskScheduler::GetWorkerQueues() {
+	return std::atomic_load(&worker_queues);
+}
+
+idx_t TaskScheduler::GetCurrentNode() {
+#ifndef DUCKDB_NO_THREADS
+	if (pin_threads && current_worker && &current_worker->scheduler == this) {
+		return current_worker->node;
+	}
+#endif
+	return DConstants::INVALID_INDEX;
+}
+
 void TaskScheduler::ScheduleTask(ProducerToken &token, unique_ptr<Task> task) {
+	auto &state = *token.state;
+	if (state.active_tasks++ == 0) {
+		busy_producers++;
+		// a producer that was idle starts from the current virtual clock, so that it cannot build up credit
+		uint64_t clock = virtual_clock;
+		if (state.virtual_time < clock) {
+			state.virtual_time = clock;
+		}
+	}
+	auto node = task->GetPreferredNode();
+	ScheduledTask scheduled(token, std::move(task));
+#ifndef DUCKDB_NO_THREADS
+	// local queues bypass the fair-share scheduling: only use them if there are no competing producers
+	if (busy_producers <= 1) {
+		if (current_worker && &current_worker->scheduler == this) {
+			// scheduled from a background thread: keep the task on this thread unless it prefers another NUMA node
+			if ((node == DConstants::INVALID_INDEX || !pin_threads || node == current_worker->node) &&
+			    current_worker->Push(scheduled)) {
+				queue->semaphore.signal();
+				return;
+			}
+		}
+		if (node != DConstants::INVALID_INDEX && pin_threads) {
+			// hand the task to one of the workers on the preferred node
+			auto queues = GetWorkerQueues();
+			if (queues && !queues->empty()) {
+				idx_t offset = next_worker++;
+				for (idx_t i = 0; i < queues->size(); i++) {
+					auto &worker = *(*queues)[(offset + i) % queues->size()];
+					if (worker.node == node && worker.Push(scheduled)) {
+						queue->semaphore.signal();
+						return;
+					}
+				}
+			}
+		}
+	}
+#endif
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(token, std::move(scheduled));
+}
+
+void TaskScheduler::FinishTask(ProducerState &state) {
+	if (--state.active_tasks == 0) {
+		busy_producers--;
+	}
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	ScheduledTask scheduled;
+	bool found = queue->DequeueFromProducer(token, scheduled);
+#ifndef DUCKDB_NO_THREADS
+	if (!found) {
+		// the tasks of this producer might have been scheduled on the local queue of a background thread
+		auto queues = GetWorkerQueues();
+		if (queues) {
+			for (auto &worker : *queues) {
+				if (worker->PopFromProducer(token, scheduled)) {
+					found = true;
+					break;
+				}
+			}
+		}
+	}
+#endif
+	if (!found) {
+		return false;
+	}
+	// the task is executed by the producer itself: it no longer counts towards the tasks of the scheduler
+	task = std::move(scheduled.task);
+	FinishTask(*scheduled.state);
+	return true;
+}
+
+bool TaskScheduler::StealTask(WorkerQueue *worker, idx_t node, ScheduledTask &task) {
+#ifndef DUCKDB_NO_THREADS
+	auto queues = GetWorkerQueues();
+	if (!queues || queues->empty()) {
+		return false;
+	}
+	// start at a different victim every time so that thieves do not all contend on the same queue
+	idx_t offset = next_worker++;
+	for (idx_t i = 0; i < queues->size(); i++) {
+		auto &victim = *(*queues)[(offset + i) % queues->size()];
+		if (&victim == worker) {
+			continue;
+		}
+		if (node != DConstants::INVALID_INDEX && victim.node != node) {
+			continue;
+		}
+		if (victim.PopFront(task)) {
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+bool TaskScheduler::FairDequeue(ScheduledTask &task) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(producers_lock);
+	vector<bool> exhausted(producers.size(), false);
+	while (true) {
+		// find the producer with queued tasks that has received the least CPU time relative to its weight
+		idx_t best = DConstants::INVALID_INDEX;
+		uint64_t best_time = 0;
+		for (idx_t i = 0; i < producers.size(); i++) {
+			if (exhausted[i] || producers[i]->state->queued_tasks == 0) {
+				continue;
+			}
+			uint64_t time = producers[i]->state->virtual_time;
+			if (best == DConstants::INVALID_INDEX || time < best_time) {
+				best = i;
+				best_time = time;
+			}
+		}
+		if (best == DConstants::INVALID_INDEX) {
+			return false;
+		}
+		if (queue->DequeueFromProducer(*producers[best], task)) {
+			if (virtual_clock < best_time) {
+				virtual_clock = best_time;
+			}
+			return true;
+		}
+		// another thread got to the tasks of this producer first
+		exhausted[best] = true;
+	}
+#else
+	return false;
+#endif
+}
+
+bool TaskScheduler::GetTask(WorkerQueue *worker, ScheduledTask &task) {
+#ifndef DUCKDB_NO_THREADS
+	if (worker) {
+		if (worker->PopBack(task)) {
+			return true;
+		}
+		if (StealTask(worker, worker->node, task)) {
+			return true;
+		}
+	}
+	if (busy_producers > 1 && FairDequeue(task)) {
+		return true;
+	}
+	if (queue->Dequeue(task)) {
+		return true;
+	}
+	return StealTask(worker, DConstants::INVALID_INDEX, task);
+#else
+	return false;
+#endif
+}
+
+void TaskScheduler::RunTask(ScheduledTask &task, bool allow_preemption) {
+	// with competing producers, tasks run for a limited amount of chunks so that they can be preempted in favor of
+	// producers with a smaller virtual time. Suspension serializes pipelines at task granularity, so it is not
+	// combined with preemption
+	bool preempt = allow_preemption && busy_producers > 1 && !global_suspend && !global_resume;
+	auto start_time = std::chrono::steady_clock::now();
+	auto result = task.task->Execute(preempt ? TaskExecutionMode::PROCESS_PARTIAL : TaskExecutionMode::PROCESS_ALL);
+	auto end_time = std::chrono::steady_clock::now();
+
+	auto &state = *task.state;
+	uint64_t elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(end_time - start_time).count();
+	state.virtual_time += MaxValue<uint64_t>(elapsed_us * NORMAL_PRIORITY_WEIGHT / state.weight, 1);
+	if (result == TaskExecutionResult::TASK_NOT_FINISHED) {
+		// the task is not finished, hence its executor - which owns the producer token - is waiting for it
+		D_ASSERT(state.producer);
+		queue->Enqueue(*state.producer, std::move(task));
+		return;
+	}
+	task.task.reset();
+	FinishTask(state);
+	task.state.reset();
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
-	unique_ptr<Task> task;
+	auto worker = current_worker && &current_worker->scheduler == this ? current_worker : nullptr;
+	ScheduledTask task;
+	// Every scheduled task signals the semaphore exactly once, so the count of the semaphore is (at most) the amount
+	// of tasks that no thread has claimed yet. A thread claims the signal of the task it runs: either by waiting for
+	// it before picking up the task, or - if it found the task without waiting - by consuming it with tryWait. Each
+	// signal is consumed at most once per task, so that sleeping threads are woken up for the remaining tasks. The
+	// count can exceed the amount of queued tasks (e.g. when StopThreads drops tasks or signals the threads to exit),
+	// which only leads to a thread waking up, finding no task, and waiting again.
+	bool claimed_signal = false;
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
+		if (GetTask(worker, task)) {
+			if (!claimed_signal) {
+				queue->semaphore.tryWait();
+			}
+			claimed_signal = false;
+			RunTask(task, true);
+		} else if (!claimed_signal) {
+			// no work anywhere: wait for a signal
+			queue->semaphore.wait();
+			claimed_signal = true;
+		} else {
+			// the task we were woken up for was picked up by another thread before we got to it
+			claimed_signal = false;
 		}
 	}
 #else
@@ -148,12 +546,11 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	idx_t completed_tasks = 0;
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
-		unique_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		ScheduledTask task;
+		if (!GetTask(nullptr, task)) {
 			return completed_tasks;
 		}
-		task->Execute(TaskExecutionMode::PROCESS_ALL);
-		task.reset();
+		RunTask(task, false);
 		completed_tasks++;
 	}
 	return completed_tasks;
@@ -164,15 +561,14 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	unique_ptr<Task> task;
+	ScheduledTask task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!GetTask(nullptr, task)) {
 			return;
 		}
 		try {
-			task->Execute(TaskExecutionMode::PROCESS_ALL);
-			task.reset();
+			RunTask(task, false);
 		} catch (...) {
 			return;
 		}
@@ -183,8 +579,28 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void PinThread(const vector<idx_t> &cpus) {
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// pinning is best-effort: ignore failures (e.g. if the CPUs are not part of our cgroup)
+	(void)sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#endif
+}
+
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, shared_ptr<WorkerQueue> worker,
+                               vector<idx_t> cpus) {
+	if (!cpus.empty()) {
+		PinThread(cpus);
+	}
+	current_worker = worker.get();
 	scheduler->ExecuteForever(marker);
+	current_worker = nullptr;
 }
 #endif
 
@@ -208,12 +624,70 @@ void TaskScheduler::SetThreads(int32_t n) {
 #endif
 }
 
+void TaskScheduler::SetThreadPinning(bool pin_threads_p) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> t(thread_lock);
+	if (pin_threads == pin_threads_p) {
+		return;
+	}
+	// relaunch the background threads so that they are (un)pinned
+	auto thread_count = threads.size();
+	StopThreads();
+	pin_threads = pin_threads_p;
+	SetThreadsInternal(thread_count + 1);
+#endif
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	queue->semaphore.signal(n);
 #endif
 }
 
+void TaskScheduler::StopThreads() {
+#ifndef DUCKDB_NO_THREADS
+	for (idx_t i = 0; i < threads.size(); i++) {
+		*markers[i] = false;
+	}
+	Signal(threads.size());
+	// now join the threads to ensure they are fully stopped before erasing them
+	for (idx_t i = 0; i < threads.size(); i++) {
+		threads[i]->internal_thread->join();
+	}
+	// erase the threads/markers
+	threads.clear();
+	markers.clear();
+
+	// retire the local queues of the threads and move their remaining tasks to the global queue
+	auto queues = GetWorkerQueues();
+	std::atomic_store(&worker_queues, shared_ptr<vector<shared_ptr<WorkerQueue>>>());
+	if (!queues) {
+		return;
+	}
+	for (auto &worker : *queues) {
+		std::deque<ScheduledTask> remaining_tasks;
+		{
+			lock_guard<mutex> guard(worker->lock);
+			worker->retired = true;
+			remaining_tasks = std::move(worker->tasks);
+			worker->tasks.clear();
+			worker->size = 0;
+		}
+		lock_guard<mutex> guard(producers_lock);
+		for (auto &entry : remaining_tasks) {
+			auto producer = entry.state->producer;
+			if (!producer) {
+				// the producer has been destroyed: nothing is waiting for its tasks anymore
+				entry.task.reset();
+				FinishTask(*entry.state);
+				continue;
+			}
+			queue->Enqueue(*producer, std::move(entry));
+		}
+	}
+#endif
+}
+
 void TaskScheduler::SetThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	if (threads.size() == idx_t(n - 1)) {
@@ -222,25 +696,32 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 	idx_t new_thread_count = n - 1;
 	if (threads.size() > new_thread_count) {
 		// we are reducing the number of threads: clear all threads first
-		for (idx_t i = 0; i < threads.size(); i++) {
-			*markers[i] = false;
-		}
-		Signal(threads.size());
-		// now join the threads to ensure they are fully stopped before erasing them
-		for (idx_t i = 0; i < threads.size(); i++) {
-			threads[i]->internal_thread->join();
-		}
-		// erase the threads/markers
-		threads.clear();
-		markers.clear();
+		StopThreads();
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
-		idx_t create_new_threads = new_thread_count - threads.size();
-		for (idx_t i = 0; i < create_new_threads; i++) {
+		// the set of worker queues is immutable once published: extend a copy of it
+		auto old_queues = GetWorkerQueues();
+		auto new_queues = old_queues ? make_shared<vector<shared_ptr<WorkerQueue>>>(*old_queues)
+		                             : make_shared<vector<shared_ptr<WorkerQueue>>>();
+		vector<shared_ptr<WorkerQueue>> created_queues;
+		for (idx_t i = threads.size(); i < new_thread_count; i++) {
+			// spread the threads round-robin over the NUMA nodes
+			idx_t node = pin_threads ? i % topology->NodeCount() : 0;
+			auto worker = make_shared<WorkerQueue>(*this, node);
+			new_queues->push_back(worker);
+			created_queues.push_back(std::move(worker));
+		}
+		std::atomic_store(&worker_queues, new_queues);
+
+		for (auto &worker : created_queues) {
+			vector<idx_t> cpus;
+			if (pin_threads && worker->node < topology->node_cpus.size()) {
+				cpus = topology->node_cpus[worker->node];
+			}
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get());
+			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get(), worker, cpus);
 			auto thread_wrapper = make_unique<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
@@ -19,6 +19,7 @@ CommonTableExpressionMap CommonTableExpressionMap::Copy() const {
 			kv_info->aliases.push_back(al);
 		}
 		kv_info->query = unique_ptr_cast<SQLStatement, SelectStatement>(kv.second->query->Copy());
+		kv_info->materialized = kv.second->materialized;
 		res.map[kv.first] = std::move(kv_info);
 	}
 	return res;
@@ -57,7 +58,13 @@ string CommonTableExpressionMap::ToString() const {
 			}
 			result += ")";
 		}
-		result += " AS (";
+		result += " AS ";
+		if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_ALWAYS) {
+			result += "MATERIALIZED ";
+		} else if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_NEVER) {
+			result += "NOT MATERIALIZED ";
+		}
+		result += "(";
 		result += cte.query->ToString();
 		result += ")";
 		first_cte = false;
@@ -129,6 +136,9 @@ bool QueryNode::Equals(const QueryNode *other) const {
 		if (entry.second->aliases != other_entry->second->aliases) {
 			return false;
 		}
+		if (entry.second->materialized != other_entry->second->materialized) {
+			return false;
+		}
 		if (!entry.second->query->Equals(other_entry->second->query.get())) {
 			return false;
 		}
@@ -146,6 +156,7 @@ void QueryNode::CopyProperties(QueryNode &other) const {
 			kv_info->aliases.push_back(al);
 		}
 		kv_info->query = unique_ptr_cast<SQLStatement, SelectStatement>(kv.second->query->Copy());
+		kv_info->materialized = kv.second->materialized;
 		other.cte_map.map[kv.first] = std::move(kv_info);
 	}
 }
@@ -163,6 +174,17 @@ void QueryNode::Serialize(Serializer &main_serializer) const {
 		cte.second->query->Serialize(serializer);
 	}
 	Serialize(writer);
+	// the CTEs that are explicitly (not) materialized
+	vector<string> cte_names;
+	vector<uint8_t> cte_materialized;
+	for (auto &cte : cte_map.map) {
+		if (cte.second->materialized != CTEMaterialize::CTE_MATERIALIZE_DEFAULT) {
+			cte_names.push_back(cte.first);
+			cte_materialized.push_back((uint8_t)cte.second->materialized);
+		}
+	}
+	writer.WriteList<string>(cte_names);
+	writer.WriteList<uint8_t>(cte_materialized);
 	writer.Finalize();
 }
 
@@ -196,6 +218,16 @@ unique_ptr<QueryNode> QueryNode::Deserialize(Deserializer &main_source) {
 	default:
 		throw SerializationException("Could not deserialize Query Node: unknown type!");
 	}
+	vector<string> cte_names;
+	vector<uint8_t> cte_materialized;
+	reader.ReadList<string>(cte_names);
+	reader.ReadList<uint8_t>(cte_materialized);
+	for (idx_t i = 0; i < cte_names.size() && i < cte_materialized.size(); i++) {
+		auto entry = new_map.find(cte_names[i]);
+		if (entry != new_map.end()) {
+			entry->second->materialized = (CTEMaterialize)cte_materialized[i];
+		}
+	}
 	result->modifiers = std::move(modifiers);
 	result->cte_map.map = std::move(new_map);
 	reader.Finalize();
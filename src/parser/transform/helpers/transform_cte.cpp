@@ -34,6 +34,17 @@ void Transformer::TransformCTE(duckdb_libpgquery::PGWithClause *de_with_clause,
 		if (cte->ctecolcollations) {
 			throw NotImplementedException("CTE collations not supported");
 		}
+		switch (cte->ctematerialized) {
+		case duckdb_libpgquery::PGCTEMaterializeDefault:
+			info->materialized = CTEMaterialize::CTE_MATERIALIZE_DEFAULT;
+			break;
+		case duckdb_libpgquery::PGCTEMaterializeAlways:
+			info->materialized = CTEMaterialize::CTE_MATERIALIZE_ALWAYS;
+			break;
+		case duckdb_libpgquery::PGCTEMaterializeNever:
+			info->materialized = CTEMaterialize::CTE_MATERIALIZE_NEVER;
+			break;
+		}
 		// we need a query
 		if (!cte->ctequery || cte->ctequery->type != duckdb_libpgquery::T_PGSelectStmt) {
 			throw NotImplementedException("A CTE needs a SELECT");
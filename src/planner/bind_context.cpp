@@ -531,6 +531,10 @@ void BindContext::AddCTEBinding(idx_t index, const string &alias, const vector<s
 	cte_references[alias] = std::make_shared<idx_t>(0);
 }
 
+void BindContext::RemoveCTEBinding(const string &ctename) {
+	cte_bindings.erase(ctename);
+}
+
 void BindContext::AddContext(BindContext other) {
 	for (auto &binding : other.bindings) {
 		if (bindings.find(binding.first) != bindings.end()) {
@@ -107,6 +107,8 @@ void Binder::AddCTEMap(CommonTableExpressionMap &cte_map) {
 unique_ptr<BoundQueryNode> Binder::BindNode(QueryNode &node) {
 	// first we visit the set of CTEs and add them to the bind context
 	AddCTEMap(node.cte_map);
+	// CTEs that are materialized are bound once, their references scan the materialized result
+	auto materialized_ctes = BindMaterializedCTEs(node);
 	// now we bind the node
 	unique_ptr<BoundQueryNode> result;
 	switch (node.type) {
@@ -121,6 +123,7 @@ unique_ptr<BoundQueryNode> Binder::BindNode(QueryNode &node) {
 		result = BindNode((SetOperationNode &)node);
 		break;
 	}
+	result->materialized_ctes = std::move(materialized_ctes);
 	return result;
 }
 
@@ -137,16 +140,21 @@ BoundStatement Binder::Bind(QueryNode &node) {
 }
 
 unique_ptr<LogicalOperator> Binder::CreatePlan(BoundQueryNode &node) {
+	unique_ptr<LogicalOperator> root;
 	switch (node.type) {
 	case QueryNodeType::SELECT_NODE:
-		return CreatePlan((BoundSelectNode &)node);
+		root = CreatePlan((BoundSelectNode &)node);
+		break;
 	case QueryNodeType::SET_OPERATION_NODE:
-		return CreatePlan((BoundSetOperationNode &)node);
+		root = CreatePlan((BoundSetOperationNode &)node);
+		break;
 	case QueryNodeType::RECURSIVE_CTE_NODE:
-		return CreatePlan((BoundRecursiveCTENode &)node);
+		root = CreatePlan((BoundRecursiveCTENode &)node);
+		break;
 	default:
 		throw InternalException("Unsupported bound query node type");
 	}
+	return PlanMaterializedCTEs(node, std::move(root));
 }
 
 unique_ptr<BoundTableRef> Binder::Bind(TableRef &ref) {
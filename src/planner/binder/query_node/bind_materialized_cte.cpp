@@ -0,0 +1,272 @@
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/query_node/recursive_cte_node.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
+#include "duckdb/parser/tableref/joinref.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+
+namespace duckdb {
+
+static idx_t CountCTEReferences(QueryNode &node, const string &name);
+
+static idx_t CountCTEReferences(ParsedExpression &expr, const string &name) {
+	idx_t count = 0;
+	if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+		auto &subquery = (SubqueryExpression &)expr;
+		count += CountCTEReferences(*subquery.subquery->node, name);
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { count += CountCTEReferences(child, name); });
+	return count;
+}
+
+static idx_t CountCTEReferences(TableRef &ref, const string &name) {
+	switch (ref.type) {
+	case TableReferenceType::BASE_TABLE: {
+		auto &table_ref = (BaseTableRef &)ref;
+		if (table_ref.catalog_name.empty() && table_ref.schema_name.empty() &&
+		    StringUtil::CIEquals(table_ref.table_name, name)) {
+			return 1;
+		}
+		return 0;
+	}
+	case TableReferenceType::JOIN: {
+		auto &join_ref = (JoinRef &)ref;
+		auto count = CountCTEReferences(*join_ref.left, name) + CountCTEReferences(*join_ref.right, name);
+		if (join_ref.condition) {
+			count += CountCTEReferences(*join_ref.condition, name);
+		}
+		return count;
+	}
+	case TableReferenceType::SUBQUERY: {
+		auto &subquery_ref = (SubqueryRef &)ref;
+		return CountCTEReferences(*subquery_ref.subquery->node, name);
+	}
+	case TableReferenceType::TABLE_FUNCTION: {
+		auto &function_ref = (TableFunctionRef &)ref;
+		return CountCTEReferences(*function_ref.function, name);
+	}
+	case TableReferenceType::EXPRESSION_LIST: {
+		auto &list_ref = (ExpressionListRef &)ref;
+		idx_t count = 0;
+		for (auto &row : list_ref.values) {
+			for (auto &value : row) {
+				count += CountCTEReferences(*value, name);
+			}
+		}
+		return count;
+	}
+	default:
+		return 0;
+	}
+}
+
+//! Counts the references to the CTE with the given name in the body of a query node (excluding its own CTEs)
+static idx_t CountCTEReferencesInBody(QueryNode &node, const string &name) {
+	idx_t count = 0;
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select_node = (SelectNode &)node;
+		for (auto &expr : select_node.select_list) {
+			count += CountCTEReferences(*expr, name);
+		}
+		for (auto &expr : select_node.groups.group_expressions) {
+			count += CountCTEReferences(*expr, name);
+		}
+		if (select_node.where_clause) {
+			count += CountCTEReferences(*select_node.where_clause, name);
+		}
+		if (select_node.having) {
+			count += CountCTEReferences(*select_node.having, name);
+		}
+		if (select_node.qualify) {
+			count += CountCTEReferences(*select_node.qualify, name);
+		}
+		if (select_node.from_table) {
+			count += CountCTEReferences(*select_node.from_table, name);
+		}
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop_node = (SetOperationNode &)node;
+		count += CountCTEReferences(*setop_node.left, name);
+		count += CountCTEReferences(*setop_node.right, name);
+		break;
+	}
+	case QueryNodeType::RECURSIVE_CTE_NODE: {
+		auto &cte_node = (RecursiveCTENode &)node;
+		count += CountCTEReferences(*cte_node.left, name);
+		count += CountCTEReferences(*cte_node.right, name);
+		break;
+	}
+	default:
+		break;
+	}
+	return count;
+}
+
+static idx_t CountCTEReferences(QueryNode &node, const string &name) {
+	for (auto &cte : node.cte_map.map) {
+		if (StringUtil::CIEquals(cte.first, name)) {
+			// the CTE is shadowed by a CTE of this node
+			return 0;
+		}
+	}
+	idx_t count = CountCTEReferencesInBody(node, name);
+	for (auto &cte : node.cte_map.map) {
+		count += CountCTEReferences(*cte.second->query->node, name);
+	}
+	return count;
+}
+
+//! Counts the references to a CTE from the body of the query node that defines it and from its other CTEs
+static idx_t CountCTEReferences(QueryNode &node, const string &name, CommonTableExpressionInfo &info) {
+	idx_t count = CountCTEReferencesInBody(node, name);
+	for (auto &cte : node.cte_map.map) {
+		if (cte.second.get() != &info) {
+			count += CountCTEReferences(*cte.second->query->node, name);
+		}
+	}
+	return count;
+}
+
+static bool IsExpensiveCTE(ClientContext &context, QueryNode &node);
+
+static bool ContainsAggregateOrWindow(ClientContext &context, ParsedExpression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::WINDOW:
+		return true;
+	case ExpressionClass::FUNCTION: {
+		auto &function = (FunctionExpression &)expr;
+		auto entry = Catalog::GetEntry(context, CatalogType::SCALAR_FUNCTION_ENTRY, function.catalog, function.schema,
+		                               function.function_name, true);
+		if (entry && entry->type == CatalogType::AGGREGATE_FUNCTION_ENTRY) {
+			return true;
+		}
+		break;
+	}
+	case ExpressionClass::SUBQUERY:
+		// aggregates in a subquery do not aggregate the CTE itself
+		return false;
+	default:
+		break;
+	}
+	bool result = false;
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { result = result || ContainsAggregateOrWindow(context, child); });
+	return result;
+}
+
+static bool IsExpensiveCTE(ClientContext &context, TableRef &ref) {
+	switch (ref.type) {
+	case TableReferenceType::JOIN:
+		return true;
+	case TableReferenceType::SUBQUERY:
+		return IsExpensiveCTE(context, *((SubqueryRef &)ref).subquery->node);
+	default:
+		return false;
+	}
+}
+
+//! Whether or not recomputing the CTE for every reference is expensive, i.e. it joins, aggregates or combines data
+static bool IsExpensiveCTE(ClientContext &context, QueryNode &node) {
+	if (node.type != QueryNodeType::SELECT_NODE) {
+		// set operations and recursive CTEs
+		return true;
+	}
+	auto &select_node = (SelectNode &)node;
+	if (!select_node.groups.group_expressions.empty() || select_node.having || select_node.qualify) {
+		return true;
+	}
+	for (auto &modifier : select_node.modifiers) {
+		if (modifier->type == ResultModifierType::DISTINCT_MODIFIER) {
+			return true;
+		}
+	}
+	for (auto &expr : select_node.select_list) {
+		if (ContainsAggregateOrWindow(context, *expr)) {
+			return true;
+		}
+	}
+	return select_node.from_table && IsExpensiveCTE(context, *select_node.from_table);
+}
+
+void Binder::BindMaterializedCTE(QueryNode &node, const string &name, case_insensitive_set_t &visited,
+                                 vector<BoundMaterializedCTE> &result) {
+	if (visited.find(name) != visited.end()) {
+		return;
+	}
+	visited.insert(name);
+	auto &cte = *node.cte_map.map[name];
+	if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_NEVER) {
+		return;
+	}
+	auto reference_count = CountCTEReferences(node, name, cte);
+	if (reference_count == 0 ||
+	    (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_DEFAULT && reference_count < 2)) {
+		// CTEs that are referenced only once are inlined
+		return;
+	}
+	if (cte.materialized == CTEMaterialize::CTE_MATERIALIZE_DEFAULT && !IsExpensiveCTE(context, *cte.query->node)) {
+		return;
+	}
+	// the CTEs that this CTE references are materialized first, so that this CTE can scan them
+	for (auto &entry : node.cte_map.map) {
+		if (entry.first != name && CountCTEReferences(*cte.query->node, entry.first) > 0) {
+			BindMaterializedCTE(node, entry.first, visited, result);
+		}
+	}
+
+	auto cte_binder = Binder::CreateBinder(context, this);
+	cte_binder->can_contain_nulls = true;
+	cte_binder->bound_ctes.insert(&cte);
+	cte_binder->alias = name;
+	auto query = unique_ptr_cast<SQLStatement, SelectStatement>(cte.query->Copy());
+	auto bound_query = cte_binder->BindNode(*query->node);
+	if (!cte_binder->correlated_columns.empty()) {
+		// a CTE that references an outer query is computed for every row of that query: inline it instead
+		// (whether or not the CTE is correlated is only known once it has been bound)
+		return;
+	}
+	// references to the CTE now scan its materialized result
+	auto names = BindContext::AliasColumnNames(name, bound_query->names, cte.aliases);
+	auto table_index = GenerateTableIndex();
+	bind_context.AddCTEBinding(table_index, name, names, bound_query->types);
+
+	BoundMaterializedCTE materialized_cte;
+	materialized_cte.table_index = table_index;
+	materialized_cte.binder = std::move(cte_binder);
+	materialized_cte.query = std::move(bound_query);
+	result.push_back(std::move(materialized_cte));
+}
+
+vector<BoundMaterializedCTE> Binder::BindMaterializedCTEs(QueryNode &node) {
+	vector<BoundMaterializedCTE> result;
+	if (node.cte_map.map.empty()) {
+		return result;
+	}
+	// the CTEs of this node shadow any materialized CTE of an enclosing query with the same name
+	vector<string> names;
+	for (auto &cte : node.cte_map.map) {
+		bind_context.RemoveCTEBinding(cte.first);
+		names.push_back(cte.first);
+	}
+	std::sort(names.begin(), names.end());
+
+	case_insensitive_set_t visited;
+	for (auto &name : names) {
+		BindMaterializedCTE(node, name, visited, result);
+	}
+	return result;
+}
+
+} // namespace duckdb
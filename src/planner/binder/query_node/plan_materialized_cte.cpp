@@ -0,0 +1,21 @@
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+
+namespace duckdb {
+
+unique_ptr<LogicalOperator> Binder::PlanMaterializedCTEs(BoundQueryNode &node, unique_ptr<LogicalOperator> root) {
+	// CTEs are materialized in the order in which they were bound: a CTE can scan the CTEs that were bound before it
+	for (idx_t i = node.materialized_ctes.size(); i > 0; i--) {
+		auto &cte = node.materialized_ctes[i - 1];
+		cte.binder->plan_subquery = plan_subquery;
+		auto cte_plan = cte.binder->CreatePlan(*cte.query);
+		if (cte.binder->has_unplanned_subqueries) {
+			has_unplanned_subqueries = true;
+		}
+		root = make_unique<LogicalMaterializedCTE>(cte.table_index, std::move(cte_plan), std::move(root));
+	}
+	return root;
+}
+
+} // namespace duckdb
@@ -525,6 +525,10 @@ unique_ptr<LogicalOperator> FlattenDependentJoins::PushDownDependentJoinInternal
 	case LogicalOperatorType::LOGICAL_RECURSIVE_CTE: {
 		throw BinderException("Recursive CTEs not supported in correlated subquery");
 	}
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE:
+		// materialized CTEs never reference the outer query: only push into the main query
+		plan->children[1] = PushDownDependentJoin(std::move(plan->children[1]));
+		return plan;
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN: {
 		throw BinderException("Nested lateral joins or lateral joins in correlated subqueries are not (yet) supported");
 	}
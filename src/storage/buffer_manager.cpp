@@ -7,6 +7,9 @@
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/config.hpp"
+
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -46,7 +49,8 @@ struct BufferAllocatorData : PrivateAllocatorData {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p)
     : block_manager(block_manager), readers(0), block_id(block_id_p), buffer(nullptr), eviction_timestamp(0),
-      can_destroy(false), unswizzled(nullptr) {
+      eviction_queue(EvictionQueueType::LRU), probationary_eviction(DConstants::INVALID_INDEX), can_destroy(false),
+      unswizzled(nullptr) {
 	eviction_timestamp = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
@@ -54,8 +58,9 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p)
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, unique_ptr<FileBuffer> buffer_p,
                          bool can_destroy_p, idx_t block_size, BufferPoolReservation &&reservation)
-    : block_manager(block_manager), readers(0), block_id(block_id_p), eviction_timestamp(0), can_destroy(can_destroy_p),
-      unswizzled(nullptr) {
+    : block_manager(block_manager), readers(0), block_id(block_id_p), eviction_timestamp(0),
+      eviction_queue(EvictionQueueType::LRU), probationary_eviction(DConstants::INVALID_INDEX),
+      can_destroy(can_destroy_p), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -219,7 +224,14 @@ struct BufferEvictionNode {
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
+	EvictionQueue() : hits(0), misses(0), evictions(0) {
+	}
+
 	eviction_queue_t q;
+	//! The statistics of the queue
+	atomic<idx_t> hits;
+	atomic<idx_t> misses;
+	atomic<idx_t> evictions;
 };
 
 class TemporaryFileManager;
@@ -247,9 +259,12 @@ void BufferManager::SetTemporaryDirectory(string new_dir) {
 
 BufferManager::BufferManager(DatabaseInstance &db, string tmp, idx_t maximum_memory)
     : db(db), current_memory(0), maximum_memory(maximum_memory), temp_directory(std::move(tmp)),
-      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK), queue_insertions(0),
+      temporary_id(MAXIMUM_BLOCK), queue_insertions(0),
       buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc,
                        make_unique<BufferAllocatorData>(*this)) {
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		queues.push_back(make_unique<EvictionQueue>());
+	}
 	temp_block_manager = make_unique<InMemoryBlockManager>(*this);
 }
 
@@ -279,6 +294,12 @@ shared_ptr<BlockHandle> BlockManager::RegisterBlock(block_id_t block_id, bool is
 	return result;
 }
 
+void BlockManager::ReadBlocks(const vector<Block *> &blocks) {
+	for (auto block : blocks) {
+		Read(*block);
+	}
+}
+
 void BlockManager::ClearMetaBlockHandles() {
 	meta_blocks.clear();
 }
@@ -405,8 +426,12 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
+			ReferenceBlock(*handle, true);
 			return handle->Load(handle);
 		}
+		if (handle->IsDestroyed()) {
+			return BufferHandle();
+		}
 		required_memory = handle->memory_usage;
 	}
 	// evict blocks until we have space for the current block
@@ -420,11 +445,18 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
 		handle->readers++;
 		reservation.Resize(current_memory, 0);
+		ReferenceBlock(*handle, true);
 		return handle->Load(handle);
 	}
+	if (handle->IsDestroyed()) {
+		// the block was evicted in the meantime
+		reservation.Resize(current_memory, 0);
+		return BufferHandle();
+	}
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
 	handle->readers = 1;
+	ReferenceBlock(*handle, false);
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
 	// In the case of a variable sized block, the buffer may be smaller than a full block.
@@ -438,6 +470,89 @@ BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return buf;
 }
 
+void BufferManager::Prefetch(const vector<shared_ptr<BlockHandle>> &handles) {
+	if (handles.empty()) {
+		return;
+	}
+	auto &block_manager = handles[0]->block_manager;
+	vector<shared_ptr<BlockHandle>> load_handles;
+	vector<unique_ptr<Block>> blocks;
+	vector<TempBufferPoolReservation> reservations;
+	for (auto &handle : handles) {
+		if (handle->block_id >= MAXIMUM_BLOCK || &handle->block_manager != &block_manager) {
+			continue;
+		}
+		idx_t required_memory;
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				continue;
+			}
+			required_memory = handle->memory_usage;
+		}
+		if (current_memory + required_memory > maximum_memory) {
+			// the block does not fit without evicting other blocks: leave it to be loaded when it is pinned
+			break;
+		}
+		reservations.emplace_back(current_memory, required_memory);
+		blocks.push_back(AllocateBlock(block_manager, nullptr, handle->block_id));
+		load_handles.push_back(handle);
+	}
+	if (blocks.empty()) {
+		return;
+	}
+	vector<Block *> read_blocks;
+	for (auto &block : blocks) {
+		read_blocks.push_back(block.get());
+	}
+	block_manager.ReadBlocks(read_blocks);
+	for (idx_t i = 0; i < load_handles.size(); i++) {
+		auto &handle = load_handles[i];
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state == BlockState::BLOCK_LOADED) {
+			// the block was loaded in the mean time: discard the prefetched copy (and its reservation)
+			continue;
+		}
+		D_ASSERT(handle->readers == 0);
+		handle->buffer = std::move(blocks[i]);
+		handle->state = BlockState::BLOCK_LOADED;
+		handle->memory_charge = std::move(reservations[i]);
+		D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
+		ReferenceBlock(*handle, false);
+		AddToEvictionQueue(handle);
+	}
+}
+
+EvictionQueue &BufferManager::GetEvictionQueue(EvictionQueueType type) {
+	return *queues[(idx_t)type];
+}
+
+void BufferManager::ReferenceBlock(BlockHandle &handle, bool loaded) {
+	EvictionQueueType type;
+	if (DBConfig::GetConfig(db).options.eviction_policy == EvictionPolicy::LRU) {
+		type = EvictionQueueType::LRU;
+	} else if (handle.block_id >= MAXIMUM_BLOCK) {
+		type = EvictionQueueType::TEMPORARY;
+	} else if (handle.eviction_queue == EvictionQueueType::PROTECTED) {
+		type = EvictionQueueType::PROTECTED;
+	} else if (!loaded && handle.probationary_eviction != DConstants::INVALID_INDEX &&
+	           GetEvictionQueue(EvictionQueueType::PROBATIONARY).evictions - handle.probationary_eviction <=
+	               maximum_memory / Storage::BLOCK_ALLOC_SIZE / 2) {
+		// the block is referenced again soon after it was evicted from the probationary queue: it is hot
+		// a block that is scanned once (or twice, but far apart) is never promoted, which makes the policy scan-resistant
+		type = EvictionQueueType::PROTECTED;
+	} else {
+		type = EvictionQueueType::PROBATIONARY;
+	}
+	handle.eviction_queue = type;
+	auto &queue = GetEvictionQueue(type);
+	if (loaded) {
+		queue.hits++;
+	} else {
+		queue.misses++;
+	}
+}
+
 void BufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	constexpr int INSERT_INTERVAL = 1024;
 
@@ -447,7 +562,8 @@ void BufferManager::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	if ((++queue_insertions % INSERT_INTERVAL) == 0) {
 		PurgeQueue();
 	}
-	queue->q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+	GetEvictionQueue(handle->eviction_queue)
+	    .q.enqueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
 }
 
 void BufferManager::VerifyZeroReaders(shared_ptr<BlockHandle> &handle) {
@@ -477,9 +593,15 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
                                                          unique_ptr<FileBuffer> *buffer) {
 	BufferEvictionNode node;
 	TempBufferPoolReservation r(current_memory, extra_memory);
+	idx_t queue_index = 0;
 	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		// get a block to unpin from the queues, in the order of EvictionQueueType
+		auto &queue = *queues[queue_index];
+		if (!queue.q.try_dequeue(node)) {
+			if (++queue_index < EVICTION_QUEUE_COUNT) {
+				// this queue is empty: continue with the next one
+				continue;
+			}
 			// Failed to reserve. Adjust size of temp reservation to 0.
 			r.Resize(current_memory, 0);
 			return {false, std::move(r)};
@@ -496,6 +618,10 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 			continue;
 		}
 		// hooray, we can unload the block
+		auto evictions = ++queue.evictions;
+		if (queue_index == (idx_t)EvictionQueueType::PROBATIONARY) {
+			handle->probationary_eviction = evictions;
+		}
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can actually re-use the memory directly!
 			*buffer = handle->UnloadAndTakeBlock();
@@ -509,16 +635,22 @@ BufferManager::EvictionResult BufferManager::EvictBlocks(idx_t extra_memory, idx
 }
 
 void BufferManager::PurgeQueue() {
+	for (auto &queue : queues) {
+		PurgeQueue(*queue);
+	}
+}
+
+void BufferManager::PurgeQueue(EvictionQueue &queue) {
 	BufferEvictionNode node;
 	while (true) {
-		if (!queue->q.try_dequeue(node)) {
+		if (!queue.q.try_dequeue(node)) {
 			break;
 		}
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
 			continue;
 		} else {
-			queue->q.enqueue(std::move(node));
+			queue.q.enqueue(std::move(node));
 			break;
 		}
 	}
@@ -660,13 +792,37 @@ private:
 	set<idx_t> indexes_in_use;
 };
 
+//! Compressed blocks are stored in slots that are a multiple of this size: every temporary file holds slots of a single
+//! size, blocks that do not compress to less than Storage::BLOCK_ALLOC_SIZE - TEMPORARY_SLOT_ALIGNMENT are stored
+//! uncompressed
+static constexpr const idx_t TEMPORARY_SLOT_ALIGNMENT = Storage::BLOCK_ALLOC_SIZE / 8;
+//! The zstd compression level used for temporary blocks
+static constexpr const int TEMPORARY_COMPRESSION_LEVEL = 1;
+
+//! Owns a zstd compression context, which holds the (large) compression tables so they are not set up per block
+class TemporaryCompressionContext {
+public:
+	TemporaryCompressionContext() : context(duckdb_zstd::ZSTD_createCCtx()) {
+		if (!context) {
+			throw OutOfMemoryException("Failed to allocate a compression context for temporary blocks");
+		}
+	}
+	~TemporaryCompressionContext() {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	duckdb_zstd::ZSTD_CCtx *context;
+};
+
 class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX = 4000;
 
 public:
-	TemporaryFileHandle(DatabaseInstance &db, const string &temp_directory, idx_t index)
-	    : db(db), file_index(index), path(FileSystem::GetFileSystem(db).JoinPath(
-	                                     temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")) {
+	TemporaryFileHandle(DatabaseInstance &db, const string &temp_directory, idx_t index, idx_t slot_size)
+	    : db(db), file_index(index), slot_size(slot_size),
+	      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory,
+	                                                  "duckdb_temp_storage-" + to_string(index) + ".tmp")),
+	      bytes_written(0), bytes_read(0) {
 	}
 
 public:
@@ -691,15 +847,51 @@ public:
 		return TemporaryFileIndex(file_index, block_index);
 	}
 
+	//! The size of the slots of this file: Storage::BLOCK_ALLOC_SIZE if it holds uncompressed blocks
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
+
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+		D_ASSERT(slot_size == Storage::BLOCK_ALLOC_SIZE);
 		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		bytes_written += buffer.AllocSize();
+	}
+
+	//! Writes a compressed block, which consists of its compressed size followed by the compressed data
+	void WriteCompressedTemporaryFile(data_ptr_t compressed_block, idx_t compressed_size, TemporaryFileIndex index) {
+		D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+		handle->Write(compressed_block, sizeof(idx_t) + compressed_size, GetPositionInFile(index.block_index));
+		bytes_written += sizeof(idx_t) + compressed_size;
 	}
 
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, idx_t block_index,
 	                                           unique_ptr<FileBuffer> reusable_buffer) {
-		return ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-		                                   Storage::BLOCK_SIZE, id, std::move(reusable_buffer));
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		auto position = GetPositionInFile(block_index);
+		if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+			bytes_read += Storage::BLOCK_ALLOC_SIZE;
+			return ReadTemporaryBufferInternal(buffer_manager, *handle, position, Storage::BLOCK_SIZE, id,
+			                                   std::move(reusable_buffer));
+		}
+		// read and decompress the compressed block
+		idx_t compressed_size;
+		handle->Read(&compressed_size, sizeof(idx_t), position);
+		if (sizeof(idx_t) + compressed_size > slot_size) {
+			throw IOException("Corrupt temporary file \"%s\": compressed block exceeds its slot", path);
+		}
+		auto compressed_data = Allocator::Get(db).Allocate(compressed_size);
+		handle->Read(compressed_data.get(), compressed_size, position + sizeof(idx_t));
+		bytes_read += sizeof(idx_t) + compressed_size;
+
+		auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompress(buffer->buffer, buffer->size, compressed_data.get(), compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != Storage::BLOCK_SIZE) {
+			throw IOException("Corrupt temporary file \"%s\": failed to decompress block", path);
+		}
+		return buffer;
 	}
 
 	void EraseBlockIndex(block_id_t block_index) {
@@ -727,6 +919,8 @@ public:
 		TemporaryFileInformation info;
 		info.path = path;
 		info.size = GetPositionInFile(index_manager.GetMaxIndex());
+		info.bytes_written = bytes_written;
+		info.bytes_read = bytes_read;
 		return info;
 	}
 
@@ -754,16 +948,21 @@ private:
 	}
 
 	idx_t GetPositionInFile(idx_t index) {
-		return index * Storage::BLOCK_ALLOC_SIZE;
+		return index * slot_size;
 	}
 
 private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	//! The size of the slots in this file
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The total amount of bytes written to and read from this file
+	atomic<idx_t> bytes_written;
+	atomic<idx_t> bytes_read;
 };
 
 class TemporaryFileManager {
@@ -782,14 +981,29 @@ public:
 
 	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 		D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+		// compress the block (outside of the lock) if that is enabled and the block is compressible
+		AllocatedData compressed_block;
+		idx_t compressed_size = 0;
+		idx_t slot_size = Storage::BLOCK_ALLOC_SIZE;
+		if (DBConfig::GetConfig(db).options.temporary_file_compression) {
+			compressed_block = Allocator::Get(db).Allocate(Storage::BLOCK_ALLOC_SIZE);
+			compressed_size = CompressBlock(buffer, compressed_block.get());
+			if (compressed_size != 0) {
+				slot_size = AlignValue<idx_t, TEMPORARY_SLOT_ALIGNMENT>(sizeof(idx_t) + compressed_size);
+			}
+		}
+
 		TemporaryFileIndex index;
 		TemporaryFileHandle *handle = nullptr;
 
 		{
 			TemporaryManagerLock lock(manager_lock);
-			// first check if we can write to an open existing file
+			// first check if we can write to an open existing file with slots of this size
 			for (auto &entry : files) {
 				auto &temp_file = entry.second;
+				if (temp_file->GetSlotSize() != slot_size) {
+					continue;
+				}
 				index = temp_file->TryGetBlockIndex();
 				if (index.IsValid()) {
 					handle = entry.second.get();
@@ -799,7 +1013,7 @@ public:
 			if (!handle) {
 				// no existing handle to write to; we need to create & open a new file
 				auto new_file_index = index_manager.GetNewBlockIndex();
-				auto new_file = make_unique<TemporaryFileHandle>(db, temp_directory, new_file_index);
+				auto new_file = make_unique<TemporaryFileHandle>(db, temp_directory, new_file_index, slot_size);
 				handle = new_file.get();
 				files[new_file_index] = std::move(new_file);
 
@@ -810,7 +1024,11 @@ public:
 		}
 		D_ASSERT(handle);
 		D_ASSERT(index.IsValid());
-		handle->WriteTemporaryFile(buffer, index);
+		if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+			handle->WriteTemporaryFile(buffer, index);
+		} else {
+			handle->WriteCompressedTemporaryFile(compressed_block.get(), compressed_size, index);
+		}
 	}
 
 	bool HasTemporaryBuffer(block_id_t block_id) {
@@ -852,6 +1070,37 @@ public:
 	}
 
 private:
+	//! Compresses the block into the target (of size Storage::BLOCK_ALLOC_SIZE) after a header that holds the
+	//! compressed size. Returns the compressed size, or 0 if the block does not compress well enough to save a slot.
+	idx_t CompressBlock(FileBuffer &buffer, data_ptr_t target) {
+		// take an idle compression context, so that concurrent writers each compress with their own
+		unique_ptr<TemporaryCompressionContext> compression_context;
+		{
+			lock_guard<mutex> guard(compression_lock);
+			if (!compression_contexts.empty()) {
+				compression_context = std::move(compression_contexts.back());
+				compression_contexts.pop_back();
+			}
+		}
+		if (!compression_context) {
+			compression_context = make_unique<TemporaryCompressionContext>();
+		}
+		auto max_compressed_size = Storage::BLOCK_ALLOC_SIZE - TEMPORARY_SLOT_ALIGNMENT - sizeof(idx_t);
+		auto compressed_size =
+		    duckdb_zstd::ZSTD_compressCCtx(compression_context->context, target + sizeof(idx_t), max_compressed_size,
+		                                   buffer.buffer, buffer.size, TEMPORARY_COMPRESSION_LEVEL);
+		{
+			lock_guard<mutex> guard(compression_lock);
+			compression_contexts.push_back(std::move(compression_context));
+		}
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			// the block is incompressible: it does not fit in the target
+			return 0;
+		}
+		Store<idx_t>(compressed_size, target);
+		return compressed_size;
+	}
+
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index) {
 		auto entry = used_blocks.find(id);
@@ -890,6 +1139,10 @@ private:
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
 	//! Manager of in-use temporary file indexes
 	BlockIndexManager index_manager;
+	//! Protects compression_contexts
+	mutex compression_lock;
+	//! The compression contexts that are not in use by a writer
+	vector<unique_ptr<TemporaryCompressionContext>> compression_contexts;
 };
 
 TemporaryDirectoryHandle::TemporaryDirectoryHandle(DatabaseInstance &db, string path_p)
@@ -971,6 +1224,8 @@ void BufferManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
 	handle->Write(&buffer.size, sizeof(idx_t), 0);
 	buffer.Write(*handle, sizeof(idx_t));
+	lock_guard<mutex> temp_handle_guard(temp_handle_lock);
+	temp_file_bytes_written[path] = sizeof(idx_t) + buffer.AllocSize();
 }
 
 unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer) {
@@ -1017,6 +1272,8 @@ void BufferManager::DeleteTemporaryFile(block_id_t id) {
 	if (fs.FileExists(path)) {
 		fs.RemoveFile(path);
 	}
+	lock_guard<mutex> temp_handle_guard(temp_handle_lock);
+	temp_file_bytes_written.erase(path);
 }
 
 vector<TemporaryFileInformation> BufferManager::GetTemporaryFiles() {
@@ -1024,11 +1281,13 @@ vector<TemporaryFileInformation> BufferManager::GetTemporaryFiles() {
 	if (temp_directory.empty()) {
 		return result;
 	}
+	unordered_map<string, idx_t> bytes_written;
 	{
 		lock_guard<mutex> temp_handle_guard(temp_handle_lock);
 		if (temp_directory_handle) {
 			result = temp_directory_handle->GetTempFile().GetTemporaryFiles();
 		}
+		bytes_written = temp_file_bytes_written;
 	}
 	auto &fs = FileSystem::GetFileSystem(db);
 	fs.ListFiles(temp_directory, [&](const string &name, bool is_dir) {
@@ -1043,11 +1302,30 @@ vector<TemporaryFileInformation> BufferManager::GetTemporaryFiles() {
 		auto handle = fs.OpenFile(name, FileFlags::FILE_FLAGS_READ);
 		info.size = fs.GetFileSize(*handle);
 		handle.reset();
+		// these files are read only once, after which they are deleted
+		auto entry = bytes_written.find(fs.JoinPath(temp_directory, name));
+		if (entry != bytes_written.end()) {
+			info.bytes_written = entry->second;
+		}
 		result.push_back(info);
 	});
 	return result;
 }
 
+vector<EvictionQueueInformation> BufferManager::GetEvictionQueues() {
+	vector<EvictionQueueInformation> result;
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		auto &queue = *queues[i];
+		EvictionQueueInformation info;
+		info.queue = EvictionQueueTypeToString((EvictionQueueType)i);
+		info.hits = queue.hits;
+		info.misses = queue.misses;
+		info.evictions = queue.evictions;
+		result.push_back(info);
+	}
+	return result;
+}
+
 string BufferManager::InMemoryWarning() {
 	if (!temp_directory.empty()) {
 		return "";
@@ -0,0 +1,110 @@
+#include "duckdb/storage/compression/alp/alp.hpp"
+#include "duckdb/storage/compression/alp/alp_compress.hpp"
+#include "duckdb/storage/compression/alp/alp_scan.hpp"
+#include "duckdb/storage/compression/alp/alp_fetch.hpp"
+#include "duckdb/storage/compression/alp/alp_analyze.hpp"
+#include "duckdb/storage/compression/alp/alp_filter.hpp"
+
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+
+namespace duckdb {
+
+constexpr const idx_t AlpConstants::ALP_VECTOR_SIZE;
+constexpr const idx_t AlpConstants::SAMPLES_PER_VECTOR;
+constexpr const idx_t AlpConstants::MAX_COMBINATIONS;
+constexpr const idx_t AlpConstants::HEADER_SIZE;
+constexpr const idx_t AlpConstants::VECTOR_HEADER_SIZE;
+
+const int64_t AlpConstants::FACTORS[] = {1,
+                                         10,
+                                         100,
+                                         1000,
+                                         10000,
+                                         100000,
+                                         1000000,
+                                         10000000,
+                                         100000000,
+                                         1000000000,
+                                         10000000000,
+                                         100000000000,
+                                         1000000000000,
+                                         10000000000000,
+                                         100000000000000,
+                                         1000000000000000,
+                                         10000000000000000,
+                                         100000000000000000,
+                                         1000000000000000000};
+
+const double AlpDoubleConstants::EXPONENTS[] = {1.0,
+                                                10.0,
+                                                100.0,
+                                                1000.0,
+                                                10000.0,
+                                                100000.0,
+                                                1000000.0,
+                                                10000000.0,
+                                                100000000.0,
+                                                1000000000.0,
+                                                10000000000.0,
+                                                100000000000.0,
+                                                1000000000000.0,
+                                                10000000000000.0,
+                                                100000000000000.0,
+                                                1000000000000000.0,
+                                                10000000000000000.0,
+                                                100000000000000000.0,
+                                                1000000000000000000.0};
+
+const double AlpDoubleConstants::FRACTIONS[] = {1.0,
+                                                0.1,
+                                                0.01,
+                                                0.001,
+                                                0.0001,
+                                                0.00001,
+                                                0.000001,
+                                                0.0000001,
+                                                0.00000001,
+                                                0.000000001,
+                                                0.0000000001,
+                                                0.00000000001,
+                                                0.000000000001,
+                                                0.0000000000001,
+                                                0.00000000000001,
+                                                0.000000000000001,
+                                                0.0000000000000001,
+                                                0.00000000000000001,
+                                                0.000000000000000001};
+
+template <class T>
+CompressionFunction GetAlpFunction(PhysicalType data_type) {
+	auto function = CompressionFunction(CompressionType::COMPRESSION_ALP, data_type, AlpInitAnalyze<T>, AlpAnalyze<T>,
+	                                    AlpFinalAnalyze<T>, AlpInitCompression<T>, AlpCompress<T>,
+	                                    AlpFinalizeCompress<T>, AlpInitScan<T>, AlpScan<T>, AlpScanPartial<T>,
+	                                    AlpFetchRow<T>, AlpSkip<T>);
+	function.filter = AlpFilterScan<T>;
+	return function;
+}
+
+CompressionFunction AlpCompressionFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+		return GetAlpFunction<float>(type);
+	case PhysicalType::DOUBLE:
+		return GetAlpFunction<double>(type);
+	default:
+		throw InternalException("Unsupported type for ALP");
+	}
+}
+
+bool AlpCompressionFun::TypeIsSupported(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -5,6 +5,8 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/statistics/numeric_statistics.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -826,6 +828,198 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+//! Comparisons with constants are turned into the range of values [min_value, max_value] that pass them. For FOR
+//! groups the range is translated to the bitpacked deltas: groups that cannot contain a passing value are not unpacked
+//! at all, and the other groups are compared before the frame of reference is applied.
+template <class T>
+struct BitpackingFilterRange {
+	static bool IsSupported(const TableFilter &filter) {
+		switch (filter.filter_type) {
+		case TableFilterType::CONSTANT_COMPARISON: {
+			auto &constant_filter = (const ConstantFilter &)filter;
+			if (constant_filter.constant.IsNull() ||
+			    constant_filter.constant.type().InternalType() != GetTypeId<T>()) {
+				return false;
+			}
+			switch (constant_filter.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				return true;
+			default:
+				return false;
+			}
+		}
+		case TableFilterType::CONJUNCTION_AND: {
+			auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!IsSupported(*child_filter)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	//! Narrows [min_value, max_value] down to the values that pass the filter, returns false if there are none
+	static bool NarrowRange(const TableFilter &filter, T &min_value, T &max_value) {
+		if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+			auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!NarrowRange(*child_filter, min_value, max_value)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		D_ASSERT(filter.filter_type == TableFilterType::CONSTANT_COMPARISON);
+		auto &constant_filter = (const ConstantFilter &)filter;
+		auto constant = constant_filter.constant.GetValueUnsafe<T>();
+		switch (constant_filter.comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			min_value = MaxValue(min_value, constant);
+			max_value = MinValue(max_value, constant);
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+			if (constant == NumericLimits<T>::Minimum()) {
+				return false;
+			}
+			max_value = MinValue<T>(max_value, constant - 1);
+			break;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			max_value = MinValue(max_value, constant);
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			if (constant == NumericLimits<T>::Maximum()) {
+				return false;
+			}
+			min_value = MaxValue<T>(min_value, constant + 1);
+			break;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			min_value = MaxValue(min_value, constant);
+			break;
+		default:
+			throw InternalException("Unsupported comparison for bitpacking filter");
+		}
+		return min_value <= max_value;
+	}
+};
+
+template <class T, class T_S = typename std::make_signed<T>::type, class T_U = typename std::make_unsigned<T>::type>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                      SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = (BitpackingScanState<T> &)*state.scan_state;
+	auto &mask = FlatVector::Validity(result);
+	if (!BitpackingFilterRange<T>::IsSupported(filter)) {
+		BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
+		ColumnSegment::FilterSelection(sel, result, filter, approved_tuple_count, mask);
+		return;
+	}
+	auto min_value = NumericLimits<T>::Minimum();
+	auto max_value = NumericLimits<T>::Maximum();
+	if (!BitpackingFilterRange<T>::NarrowRange(filter, min_value, max_value)) {
+		// no value can pass the filter
+		scan_state.Skip(segment, scan_count);
+		approved_tuple_count = 0;
+		return;
+	}
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+
+	T *result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	bool passes[STANDARD_VECTOR_SIZE];
+	// a value v passes if (v - min_value) <= (max_value - min_value) in unsigned arithmetic
+	T_U range_size = T_U(max_value) - T_U(min_value);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		if (scan_state.current_group_offset >= BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		idx_t left_in_group =
+		    MinValue(scan_count - scanned, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+
+		if (scan_state.current_group.mode == BitpackingMode::CONSTANT) {
+			// the filter is evaluated once for the entire group
+			auto constant = scan_state.current_constant;
+			bool constant_passes = T_U(T_U(constant) - T_U(min_value)) <= range_size;
+			if (constant_passes) {
+				std::fill(result_data + scanned, result_data + scanned + left_in_group, constant);
+			}
+			memset(passes + scanned, constant_passes, left_in_group * sizeof(bool));
+			scanned += left_in_group;
+			scan_state.current_group_offset += left_in_group;
+			continue;
+		}
+		if (scan_state.current_group.mode != BitpackingMode::FOR) {
+			// delta encoded values have to be decoded to be compared
+			BitpackingScanPartial<T>(segment, state, left_in_group, result, scanned);
+			for (idx_t i = scanned; i < scanned + left_in_group; i++) {
+				passes[i] = T_U(T_U(result_data[i]) - T_U(min_value)) <= range_size;
+			}
+			scanned += left_in_group;
+			continue;
+		}
+
+		// the values of a FOR group lie in [FOR, FOR + 2^width - 1]: translate the range to the bitpacked deltas
+		auto frame_of_reference = scan_state.current_frame_of_reference;
+		auto width = scan_state.current_width;
+		T_U max_delta = width >= sizeof(T) * 8 ? NumericLimits<T_U>::Maximum() : (T_U(1) << width) - 1;
+		T_U lower_delta = min_value <= frame_of_reference ? 0 : T_U(min_value) - T_U(frame_of_reference);
+		T_U upper_delta = T_U(max_value) - T_U(frame_of_reference);
+		if (max_value < frame_of_reference || lower_delta > max_delta) {
+			// no value in this group passes the filter: skip it without unpacking
+			memset(passes + scanned, 0, left_in_group * sizeof(bool));
+			scanned += left_in_group;
+			scan_state.current_group_offset += left_in_group;
+			continue;
+		}
+		upper_delta = MinValue(upper_delta, max_delta);
+		T_U delta_range_size = upper_delta - lower_delta;
+
+		//! Because FOR offsets all our values to be 0 or above, we can always skip sign extension here
+		bool skip_sign_extend = true;
+		auto group_end = scanned + left_in_group;
+		while (scanned < group_end) {
+			idx_t offset_in_compression_group =
+			    scan_state.current_group_offset % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+			idx_t to_scan = MinValue<idx_t>(group_end - scanned, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
+			                                                         offset_in_compression_group);
+			data_ptr_t decompression_group_start_pointer =
+			    scan_state.current_group_ptr +
+			    (scan_state.current_group_offset - offset_in_compression_group) * width / 8;
+
+			T *current_result_ptr = result_data + scanned;
+			if (to_scan == BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE && offset_in_compression_group == 0) {
+				BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)current_result_ptr, decompression_group_start_pointer,
+				                                     width, skip_sign_extend);
+			} else {
+				BitpackingPrimitives::UnPackBlock<T>((data_ptr_t)scan_state.decompression_buffer,
+				                                     decompression_group_start_pointer, width, skip_sign_extend);
+				memcpy(current_result_ptr, scan_state.decompression_buffer + offset_in_compression_group,
+				       to_scan * sizeof(T));
+			}
+			// compare the deltas before the frame of reference is applied
+			for (idx_t i = 0; i < to_scan; i++) {
+				passes[scanned + i] = T_U(T_U(current_result_ptr[i]) - lower_delta) <= delta_range_size;
+			}
+			ApplyFrameOfReference<T>(current_result_ptr, frame_of_reference, to_scan);
+
+			scanned += to_scan;
+			scan_state.current_group_offset += to_scan;
+		}
+	}
+	ColumnSegment::SelectPassingRows(sel, approved_tuple_count, passes, mask);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -882,10 +1076,13 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 //===--------------------------------------------------------------------===//
 template <class T>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
-	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>, BitpackingInitCompression<T>,
-	                           BitpackingCompress<T>, BitpackingFinalizeCompress<T>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
+	                                    BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>, BitpackingInitCompression<T>,
+	                                    BitpackingCompress<T>, BitpackingFinalizeCompress<T>, BitpackingInitScan<T>,
+	                                    BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>,
+	                                    BitpackingSkip<T>);
+	function.filter = BitpackingFilter<T>;
+	return function;
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
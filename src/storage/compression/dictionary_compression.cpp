@@ -105,6 +105,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -434,6 +436,11 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The number of entries in the dictionary
+	idx_t dictionary_size = 0;
+	//! The filter that was last evaluated on the dictionary, and the dictionary entries that pass it
+	const TableFilter *dictionary_filter = nullptr;
+	unique_ptr<bool[]> dictionary_passes;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -453,6 +460,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = (uint32_t *)(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -542,6 +550,61 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = (CompressedStringScanState &)*state.scan_state;
+	auto &mask = FlatVector::Validity(result);
+	if (!ColumnSegment::FilterComparesValues(filter)) {
+		StringScanPartial<false>(segment, state, scan_count, result, 0);
+		ColumnSegment::FilterSelection(sel, result, filter, approved_tuple_count, mask);
+		return;
+	}
+
+	// the filter is evaluated once per dictionary entry, instead of once per row
+	if (scan_state.dictionary_filter != &filter) {
+		scan_state.dictionary_passes = unique_ptr<bool[]>(new bool[scan_state.dictionary_size]);
+		ColumnSegment::FilterValues(*scan_state.dictionary, scan_state.dictionary_size, filter,
+		                            scan_state.dictionary_passes.get());
+		scan_state.dictionary_filter = &filter;
+	}
+
+	// unpack the selection buffer of the vector
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = (data_ptr_t)(baseptr + DICTIONARY_HEADER_SIZE);
+
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	sel_t *sel_vec_ptr = scan_state.sel_vec->data();
+	BitpackingPrimitives::UnPackBuffer<sel_t>((data_ptr_t)sel_vec_ptr, src, decompress_count,
+	                                          scan_state.current_width);
+
+	// map the result of the dictionary entries through the selection buffer
+	auto string_numbers = sel_vec_ptr + start_offset;
+	bool passes[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < scan_count; i++) {
+		passes[i] = scan_state.dictionary_passes[string_numbers[i]];
+	}
+	ColumnSegment::SelectPassingRows(sel, approved_tuple_count, passes, mask);
+
+	// only the rows that pass the filter are fetched from the dictionary
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto dict_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		result_data[idx] = dict_data[string_numbers[idx]];
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -638,13 +701,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(PhysicalType type) {
@@ -7,6 +7,7 @@
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/random_engine.hpp"
 #include "duckdb/common/fsst.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 #include "miniz_wrapper.hpp"
 #include "fsst.h"
 
@@ -51,6 +52,8 @@ struct FSSTStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -507,6 +510,10 @@ struct FSSTScanState : public StringScanState {
 	uint32_t last_known_index;
 	int64_t last_known_row;
 
+	// Filters decompress the strings they evaluate into this buffer, only the strings that pass are copied to the
+	// result
+	unique_ptr<ArenaAllocator> filter_buffer;
+
 	void StoreLastDelta(uint32_t value, int64_t row) {
 		last_known_index = value;
 		last_known_row = row;
@@ -635,6 +642,75 @@ void FSSTStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void FSSTStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                               SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = (FSSTScanState &)*state.scan_state;
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto dict = GetDictionary(segment, scan_state.handle);
+	auto base_data = (data_ptr_t)(baseptr + sizeof(fsst_compression_header_t));
+
+	if (start == 0 || scan_state.last_known_row >= (int64_t)start) {
+		scan_state.ResetStoredDelta();
+	}
+
+	auto offsets = CalculateBpDeltaOffsets(scan_state.last_known_row, start, scan_count);
+
+	auto bitunpack_buffer = unique_ptr<uint32_t[]>(new uint32_t[offsets.total_bitunpack_count]);
+	BitUnpackRange(base_data, (data_ptr_t)bitunpack_buffer.get(), offsets.total_bitunpack_count,
+	               offsets.bitunpack_start_row, scan_state.current_width);
+	auto delta_decode_buffer = unique_ptr<uint32_t[]>(new uint32_t[offsets.total_delta_decode_count]);
+	DeltaDecodeIndices(bitunpack_buffer.get() + offsets.bitunpack_alignment_offset, delta_decode_buffer.get(),
+	                   offsets.total_delta_decode_count, scan_state.last_known_index);
+
+	if (!scan_state.filter_buffer) {
+		scan_state.filter_buffer = make_unique<ArenaAllocator>(Allocator::Get(segment.db));
+	} else {
+		scan_state.filter_buffer->Reset();
+	}
+
+	// only the valid rows that are still selected are decompressed, into the filter buffer
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &mask = FlatVector::Validity(result);
+	unsigned char decompress_buffer[StringUncompressed::STRING_BLOCK_LIMIT + 1];
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		uint32_t str_len = bitunpack_buffer[idx + offsets.scan_offset];
+		if (str_len == 0 || !mask.RowIsValid(idx)) {
+			result_data[idx] = string_t(nullptr, 0);
+			continue;
+		}
+		auto dict_offset = delta_decode_buffer[idx + offsets.unused_delta_decoded_values];
+		auto str_ptr = FSSTStorage::FetchStringPointer(dict, baseptr, dict_offset);
+		auto decompressed_size = duckdb_fsst_decompress(
+		    (duckdb_fsst_decoder_t *)scan_state.duckdb_fsst_decoder.get(), str_len, (unsigned char *)str_ptr,
+		    StringUncompressed::STRING_BLOCK_LIMIT + 1, &decompress_buffer[0]);
+		D_ASSERT(decompressed_size <= StringUncompressed::STRING_BLOCK_LIMIT);
+		auto str_data = (const char *)decompress_buffer;
+		if (decompressed_size > string_t::INLINE_LENGTH) {
+			auto target = scan_state.filter_buffer->Allocate(decompressed_size);
+			memcpy(target, decompress_buffer, decompressed_size);
+			str_data = (const char *)target;
+		}
+		result_data[idx] = string_t(str_data, decompressed_size);
+	}
+	ColumnSegment::FilterSelection(sel, result, filter, approved_tuple_count, mask);
+
+	// the strings that pass the filter are copied into the result
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		result_data[idx] = StringVector::AddStringOrBlob(result, result_data[idx]);
+	}
+
+	scan_state.StoreLastDelta(delta_decode_buffer[scan_count + offsets.unused_delta_decoded_values - 1],
+	                          start + scan_count - 1);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -683,11 +759,13 @@ void FSSTStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state
 //===--------------------------------------------------------------------===//
 CompressionFunction FSSTFun::GetFunction(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::VARCHAR);
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_FSST, data_type, FSSTStorage::StringInitAnalyze, FSSTStorage::StringAnalyze,
 	    FSSTStorage::StringFinalAnalyze, FSSTStorage::InitCompression, FSSTStorage::Compress,
 	    FSSTStorage::FinalizeCompress, FSSTStorage::StringInitScan, FSSTStorage::StringScan,
 	    FSSTStorage::StringScanPartial<false>, FSSTStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = FSSTStorage::StringFilter;
+	return function;
 }
 
 bool FSSTFun::TypeIsSupported(PhysicalType type) {
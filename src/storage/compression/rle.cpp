@@ -324,6 +324,62 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = (RLEScanState<T> &)*state.scan_state;
+	auto &mask = FlatVector::Validity(result);
+	if (!ColumnSegment::FilterComparesValues(filter)) {
+		RLEScanPartial<T>(segment, state, scan_count, result, 0);
+		ColumnSegment::FilterSelection(sel, result, filter, approved_tuple_count, mask);
+		return;
+	}
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = (T *)(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = (rle_count_t *)(data + scan_state.rle_count_offset);
+
+	// gather the runs that overlap with the vector: the filter is evaluated once per run
+	Vector run_values(result.GetType());
+	auto run_data = FlatVector::GetData<T>(run_values);
+	idx_t run_ends[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto remaining_in_run = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+		auto to_scan = MinValue<idx_t>(remaining_in_run, scan_count - scanned);
+		run_data[run_count] = data_pointer[scan_state.entry_pos];
+		scanned += to_scan;
+		run_ends[run_count++] = scanned;
+		scan_state.position_in_entry += to_scan;
+		if (scan_state.position_in_entry >= index_pointer[scan_state.entry_pos]) {
+			scan_state.entry_pos++;
+			scan_state.position_in_entry = 0;
+		}
+	}
+	bool run_passes[STANDARD_VECTOR_SIZE];
+	ColumnSegment::FilterValues(run_values, run_count, filter, run_passes);
+
+	// only the runs that pass the filter are written to the result
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	bool passes[STANDARD_VECTOR_SIZE];
+	idx_t run_start = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto run_end = run_ends[run_idx];
+		if (run_passes[run_idx]) {
+			std::fill(result_data + run_start, result_data + run_end, run_data[run_idx]);
+		}
+		memset(passes + run_start, run_passes[run_idx], (run_end - run_start) * sizeof(bool));
+		run_start = run_end;
+	}
+	ColumnSegment::SelectPassingRows(sel, approved_tuple_count, passes, mask);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -343,9 +399,12 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T>, RLECompress<T>, RLEFinalizeCompress<T>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                    RLEFinalAnalyze<T>, RLEInitCompression<T>, RLECompress<T>,
+	                                    RLEFinalizeCompress<T>, RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>,
+	                                    RLEFetchRow<T>, RLESkip<T>);
+	function.filter = RLEFilter<T>;
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -12,6 +12,7 @@ PartialBlockManager::~PartialBlockManager() {
 // Partial Blocks
 //===--------------------------------------------------------------------===//
 PartialBlockAllocation PartialBlockManager::GetBlockAllocation(uint32_t segment_size) {
+	lock_guard<mutex> guard(partial_block_lock);
 	PartialBlockAllocation allocation;
 	allocation.block_manager = &block_manager;
 	allocation.allocation_size = segment_size;
@@ -54,6 +55,7 @@ bool PartialBlockManager::GetPartialBlock(idx_t segment_size, unique_ptr<Partial
 }
 
 void PartialBlockManager::RegisterPartialBlock(PartialBlockAllocation &&allocation) {
+	lock_guard<mutex> guard(partial_block_lock);
 	auto &state(allocation.partial_block->state);
 	if (state.block_use_count < max_use_count) {
 		auto new_size = AlignValue(allocation.allocation_size + state.offset_in_block);
@@ -79,6 +81,7 @@ void PartialBlockManager::RegisterPartialBlock(PartialBlockAllocation &&allocati
 }
 
 void PartialBlockManager::FlushPartialBlocks() {
+	lock_guard<mutex> guard(partial_block_lock);
 	for (auto &e : partially_filled_blocks) {
 		e.second->Flush();
 	}
@@ -86,6 +89,7 @@ void PartialBlockManager::FlushPartialBlocks() {
 }
 
 void PartialBlockManager::Clear() {
+	lock_guard<mutex> guard(partial_block_lock);
 	for (auto &e : partially_filled_blocks) {
 		e.second->Clear();
 	}
@@ -215,6 +215,10 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t location) const {
 	// read the buffer from disk
 	block.Read(*handle, location);
+	VerifyChecksum(block);
+}
+
+void SingleFileBlockManager::VerifyChecksum(FileBuffer &block) const {
 	// compute the checksum
 	auto stored_checksum = Load<uint64_t>(block.InternalBuffer());
 	uint64_t computed_checksum = Checksum(block.buffer, block.size);
@@ -358,6 +362,21 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::ReadBlocks(const vector<Block *> &blocks) {
+	vector<FileReadRequest> requests;
+	requests.reserve(blocks.size());
+	for (auto block : blocks) {
+		D_ASSERT(block->id >= 0);
+		D_ASSERT(std::find(free_list.begin(), free_list.end(), block->id) == free_list.end());
+		requests.emplace_back(block->InternalBuffer(), block->AllocSize(),
+		                      BLOCK_START + block->id * Storage::BLOCK_ALLOC_SIZE);
+	}
+	handle->file_system.ReadBatch(*handle, requests.data(), requests.size());
+	for (auto block : blocks) {
+		VerifyChecksum(*block);
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
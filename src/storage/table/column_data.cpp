@@ -4,6 +4,7 @@
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -79,6 +80,7 @@ void ColumnData::InitializeScan(ColumnScanState &state) {
 	state.row_index = state.current ? state.current->start : 0;
 	state.internal_index = state.row_index;
 	state.initialized = false;
+	state.prefetch_end = 0;
 	state.version = version;
 	state.scan_state.reset();
 }
@@ -88,10 +90,33 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.row_index = row_idx;
 	state.internal_index = state.current->start;
 	state.initialized = false;
+	state.prefetch_end = 0;
 	state.version = version;
 	state.scan_state.reset();
 }
 
+void ColumnData::PrefetchSegments(ColumnScanState &state) {
+	// the number of segments for which the blocks are read at once
+	static constexpr idx_t PREFETCH_SEGMENT_COUNT = 8;
+	if (state.current->start < state.prefetch_end) {
+		return;
+	}
+	vector<shared_ptr<BlockHandle>> handles;
+	auto segment = state.current;
+	for (idx_t i = 0; segment && i < PREFETCH_SEGMENT_COUNT; i++) {
+		if (segment->segment_type == ColumnSegmentType::PERSISTENT && segment->block &&
+		    segment->block->BlockId() < MAXIMUM_BLOCK &&
+		    std::find(handles.begin(), handles.end(), segment->block) == handles.end()) {
+			handles.push_back(segment->block);
+		}
+		state.prefetch_end = segment->start + segment->count;
+		segment = (ColumnSegment *)segment->Next();
+	}
+	if (handles.size() > 1) {
+		block_manager.buffer_manager.Prefetch(handles);
+	}
+}
+
 idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining) {
 	state.previous_states.clear();
 	if (state.version != version) {
@@ -106,6 +131,7 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	}
 	D_ASSERT(data.HasSegment(state.current));
 	D_ASSERT(state.version == version);
+	PrefetchSegments(state);
 	D_ASSERT(state.internal_index <= state.row_index);
 	if (state.internal_index < state.row_index) {
 		state.current->Skip(state);
@@ -130,6 +156,7 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 			}
 			state.previous_states.emplace_back(std::move(state.scan_state));
 			state.current = (ColumnSegment *)state.current->Next();
+			PrefetchSegments(state);
 			state.current->InitializeScan(state);
 			state.segment_checked = false;
 			D_ASSERT(state.row_index >= state.current->start &&
@@ -206,6 +233,54 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, filter, count, FlatVector::Validity(result));
 }
 
+bool ColumnData::CanFilterSegment(ColumnScanState &state) {
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (updates) {
+			// the filter has to be evaluated on the updated values
+			return false;
+		}
+	}
+	if (state.version != version || !state.current) {
+		return false;
+	}
+	state.previous_states.clear();
+	if (!state.initialized) {
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.initialized = true;
+	}
+	if (state.row_index == state.current->start + state.current->count && state.current->next) {
+		// the previous vector ended at the end of the segment: move to the next one
+		state.current = (ColumnSegment *)state.current->Next();
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.segment_checked = false;
+	}
+	if (!state.current->function->filter) {
+		return false;
+	}
+	if (state.row_index + STANDARD_VECTOR_SIZE > state.current->start + state.current->count && state.current->next) {
+		// the vector spans multiple segments
+		return false;
+	}
+	PrefetchSegments(state);
+	if (state.internal_index < state.row_index) {
+		state.current->Skip(state);
+	}
+	return true;
+}
+
+void ColumnData::FilterSegment(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &count,
+                               const TableFilter &filter) {
+	D_ASSERT(state.internal_index == state.row_index);
+	auto scan_count =
+	    MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.current->start + state.current->count - state.row_index);
+	state.current->Filter(state, scan_count, result, sel, count, filter);
+	state.row_index += scan_count;
+	state.internal_index = state.row_index;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t count) {
 	Scan(transaction, vector_index, state, result);
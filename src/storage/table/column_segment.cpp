@@ -4,6 +4,7 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
@@ -110,6 +111,12 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function->scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+void ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &approved_tuple_count, const TableFilter &filter) {
+	D_ASSERT(function->filter);
+	function->filter(*this, state, scan_count, result, sel, approved_tuple_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -234,6 +241,16 @@ template <class T>
 static void FilterSelectionSwitch(T *vec, T *predicate, SelectionVector &sel, idx_t &approved_tuple_count,
                                   ExpressionType comparison_type, ValidityMask &mask) {
 	SelectionVector new_sel(approved_tuple_count);
+	if (!sel.data() && mask.AllValid()) {
+		// the first filter on a vector without NULLs: try the SIMD kernels
+		idx_t match_count;
+		if (SIMDKernels::SelectConstant<T>(vec, *predicate, comparison_type, approved_tuple_count, &new_sel, nullptr,
+		                                   match_count)) {
+			approved_tuple_count = match_count;
+			sel.Initialize(new_sel);
+			return;
+		}
+	}
 	// the inplace loops take the result as the last parameter
 	switch (comparison_type) {
 	case ExpressionType::COMPARE_EQUAL: {
@@ -488,4 +505,71 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &result, const
 	}
 }
 
+bool ColumnSegment::FilterComparesValues(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return !((const ConstantFilter &)filter).constant.IsNull();
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (!FilterComparesValues(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = (const ConjunctionOrFilter &)filter;
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!FilterComparesValues(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void ColumnSegment::FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *passes) {
+	D_ASSERT(FilterComparesValues(filter));
+	memset(passes, 0, count * sizeof(bool));
+	// evaluate the filter in chunks of at most a vector, which is what FilterSelection is written for
+	ValidityMask all_valid;
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		auto chunk_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - offset);
+		Vector chunk(values, offset, offset + chunk_count);
+		SelectionVector sel;
+		idx_t approved_tuple_count = chunk_count;
+		FilterSelection(sel, chunk, filter, approved_tuple_count, all_valid);
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			passes[offset + sel.get_index(i)] = true;
+		}
+	}
+}
+
+void ColumnSegment::SelectPassingRows(SelectionVector &sel, idx_t &approved_tuple_count, const bool *passes,
+                                      ValidityMask &mask) {
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	if (mask.AllValid()) {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (passes[idx]) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+	} else {
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (passes[idx] && mask.RowIsValid(idx)) {
+				new_sel.set_index(result_count++, idx);
+			}
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 } // namespace duckdb
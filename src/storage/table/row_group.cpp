@@ -703,11 +703,7 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		auto &column = columns[column_idx];
-		ColumnCheckpointInfo checkpoint_info {compression_types[column_idx]};
-		auto checkpoint_state = column->Checkpoint(*this, manager, checkpoint_info);
-		D_ASSERT(checkpoint_state);
-
+		auto checkpoint_state = WriteColumnToDisk(column_idx, manager, compression_types[column_idx]);
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
 
@@ -718,25 +714,30 @@ RowGroupWriteData RowGroup::WriteToDisk(PartialBlockManager &manager,
 	return result;
 }
 
-RowGroupPointer RowGroup::Checkpoint(RowGroupWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(idx_t column_idx, PartialBlockManager &manager,
+                                                              CompressionType compression_type) {
+	auto &column = columns[column_idx];
+	ColumnCheckpointInfo checkpoint_info {compression_type};
+	auto checkpoint_state = column->Checkpoint(*this, manager, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
+
+RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
+                                     vector<unique_ptr<BaseStatistics>> &global_stats) {
 	RowGroupPointer row_group_pointer;
 
-	vector<CompressionType> compression_types;
-	compression_types.reserve(columns.size());
-	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
-	}
-	auto result = WriteToDisk(writer.GetPartialBlockManager(), compression_types);
+	D_ASSERT(write_data.statistics.size() == columns.size());
 	for (idx_t column_idx = 0; column_idx < columns.size(); column_idx++) {
-		global_stats[column_idx]->Merge(*result.statistics[column_idx]);
+		global_stats[column_idx]->Merge(*write_data.statistics[column_idx]);
 	}
-	row_group_pointer.statistics = std::move(result.statistics);
+	row_group_pointer.statistics = std::move(write_data.statistics);
 
 	// construct the row group pointer and write the column meta data to disk
-	D_ASSERT(result.states.size() == columns.size());
+	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
-	for (auto &state : result.states) {
+	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
 		auto pointer = data_writer.GetBlockPointer();
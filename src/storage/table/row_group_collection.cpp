@@ -6,6 +6,8 @@
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
+#include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 
 namespace duckdb {
 
@@ -519,12 +521,105 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+struct CollectionCheckpointState {
+	CollectionCheckpointState(vector<RowGroup *> row_groups_p, vector<unique_ptr<RowGroupWriter>> &writers)
+	    : row_groups(std::move(row_groups_p)), writers(writers), write_data(row_groups.size()), has_error(false) {
+	}
+
+	vector<RowGroup *> row_groups;
+	vector<unique_ptr<RowGroupWriter>> &writers;
+	vector<RowGroupWriteData> write_data;
+	atomic<bool> has_error;
+	mutex error_lock;
+	std::exception_ptr error;
+};
+
+//! Compresses and writes a single column of a row group during a checkpoint
+class CheckpointTask : public Task {
+public:
+	CheckpointTask(CollectionCheckpointState &checkpoint_state, TaskCounter *counter, idx_t row_group_idx,
+	               idx_t column_idx)
+	    : checkpoint_state(checkpoint_state), counter(counter), row_group_idx(row_group_idx), column_idx(column_idx) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			if (!checkpoint_state.has_error) {
+				auto &row_group = *checkpoint_state.row_groups[row_group_idx];
+				auto &writer = *checkpoint_state.writers[row_group_idx];
+				checkpoint_state.write_data[row_group_idx].states[column_idx] = row_group.WriteColumnToDisk(
+				    column_idx, writer.GetPartialBlockManager(), writer.GetColumnCompressionType(column_idx));
+			}
+		} catch (...) {
+			lock_guard<mutex> guard(checkpoint_state.error_lock);
+			if (!checkpoint_state.error) {
+				checkpoint_state.error = std::current_exception();
+			}
+			checkpoint_state.has_error = true;
+		}
+		if (counter) {
+			counter->FinishTask();
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	CollectionCheckpointState &checkpoint_state;
+	//! The counter of the scheduled tasks, or nullptr if the task is executed directly
+	TaskCounter *counter;
+	idx_t row_group_idx;
+	idx_t column_idx;
+};
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, vector<unique_ptr<BaseStatistics>> &global_stats) {
+	vector<RowGroup *> checkpoint_row_groups;
+	vector<unique_ptr<RowGroupWriter>> writers;
 	for (auto row_group = (RowGroup *)row_groups->GetRootSegment(); row_group;
 	     row_group = (RowGroup *)row_group->Next()) {
-		auto rowg_writer = writer.GetRowGroupWriter(*row_group);
-		auto pointer = row_group->Checkpoint(*rowg_writer, global_stats);
-		writer.AddRowGroup(std::move(pointer), std::move(rowg_writer));
+		checkpoint_row_groups.push_back(row_group);
+		writers.push_back(writer.GetRowGroupWriter(*row_group));
+	}
+	CollectionCheckpointState checkpoint_state(std::move(checkpoint_row_groups), writers);
+	auto &state_row_groups = checkpoint_state.row_groups;
+	auto column_count = types.size();
+	for (auto &write_data : checkpoint_state.write_data) {
+		write_data.states.resize(column_count);
+	}
+
+	// compress the columns of all row groups, in parallel if possible
+	// the blocks they are written to are allocated from the partial block manager, which is shared by all of them
+	auto &scheduler = TaskScheduler::GetScheduler(info->db.GetDatabase());
+	idx_t task_count = state_row_groups.size() * column_count;
+	if (scheduler.NumberOfThreads() > 1 && task_count > 1) {
+		TaskCounter counter(scheduler);
+		for (idx_t row_group_idx = 0; row_group_idx < state_row_groups.size(); row_group_idx++) {
+			for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+				counter.AddTask(make_unique<CheckpointTask>(checkpoint_state, &counter, row_group_idx, column_idx));
+			}
+		}
+		// work on the tasks ourselves, and wait for any tasks that were picked up by other threads
+		counter.Finish();
+	} else {
+		for (idx_t row_group_idx = 0; row_group_idx < state_row_groups.size(); row_group_idx++) {
+			for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+				CheckpointTask(checkpoint_state, nullptr, row_group_idx, column_idx)
+				    .Execute(TaskExecutionMode::PROCESS_ALL);
+			}
+		}
+	}
+	if (checkpoint_state.has_error) {
+		std::rethrow_exception(checkpoint_state.error);
+	}
+
+	// write the metadata of the row groups in order
+	for (idx_t row_group_idx = 0; row_group_idx < state_row_groups.size(); row_group_idx++) {
+		auto &write_data = checkpoint_state.write_data[row_group_idx];
+		for (auto &state : write_data.states) {
+			write_data.statistics.push_back(state->GetStatistics());
+		}
+		auto pointer = state_row_groups[row_group_idx]->Checkpoint(std::move(write_data), *writers[row_group_idx],
+		                                                           global_stats);
+		writer.AddRowGroup(std::move(pointer), std::move(writers[row_group_idx]));
 	}
 }
 
@@ -74,6 +74,18 @@ idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &sta
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	if (!CanFilterSegment(state)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	// scan the validity first: the filter excludes NULL values
+	validity.Scan(transaction, vector_index, state.child_states[0], result);
+	FilterSegment(state, result, sel, count, filter);
+}
+
 idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t count) {
 	auto scan_count = ColumnData::ScanCount(state, result, count);
 	validity.ScanCount(state.child_states[0], result, count);
@@ -23,6 +23,8 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValuePair &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValuePair> value_map = {
 	    {"access_mode", {Value("READ_ONLY"), Value("read_only")}},
+	    {"adaptive_join_order_threshold", {Value::DOUBLE(42), Value::DOUBLE(42)}},
+	    {"arrow_string_dictionary", {true, true}},
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.2GB", "4.2GB"}},
 	    {"debug_checkpoint_abort", {"before_header", "before_header"}},
@@ -33,10 +35,12 @@ OptionValuePair &GetValueForOption(const string &name) {
 	    {"custom_extension_repository", {"duckdb.org/no-extensions-here", "duckdb.org/no-extensions-here"}},
 	    {"enable_fsst_vectors", {true, true}},
 	    {"enable_object_cache", {true, true}},
+	    {"enable_hardware_counters", {true, true}},
 	    {"enable_profiling", {"json", "json"}},
 	    {"enable_progress_bar", {true, true}},
 	    {"experimental_parallel_csv", {true, true}},
 	    {"explain_output", {true, true}},
+	    {"eviction_policy", {"2q", "2q"}},
 	    {"external_threads", {8, 8}},
 	    {"file_search_path", {"test", "test"}},
 	    {"force_compression", {"uncompressed", "Uncompressed"}},
@@ -49,14 +53,17 @@ OptionValuePair &GetValueForOption(const string &name) {
 	    {"memory_limit", {"4.2GB", "4.2GB"}},
 	    {"null_order", {"nulls_last", "nulls_last"}},
 	    {"perfect_ht_threshold", {0, 0}},
+	    {"pin_threads", {true, true}},
 	    {"preserve_identifier_case", {false, false}},
 	    {"preserve_insertion_order", {false, false}},
 	    {"profiler_history_size", {0, 0}},
+	    {"query_priority", {"high", "high"}},
 	    {"profile_output", {"test", "test"}},
 	    {"profiling_mode", {"detailed", "detailed"}},
 	    {"enable_progress_bar_print", {false, false}},
 	    {"progress_bar_time", {0, 0}},
 	    {"temp_directory", {"tmp", "tmp"}},
+	    {"temp_file_compression", {true, true}},
 	    {"wal_autocheckpoint", {"4.2GB", "4.2GB"}},
 	    {"worker_threads", {42, 42}},
 	    {"enable_http_metadata_cache", {true, true}},
@@ -1,5 +1,6 @@
 #include "catch.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <thread>
 
@@ -28,3 +29,76 @@ TEST_CASE("Test database maximum_threads argument", "[api]") {
 		REQUIRE_THROWS(db = DuckDB(nullptr, &config));
 	}
 }
+
+struct SpawningTaskCounters {
+	atomic<idx_t> spawned {0};
+	atomic<idx_t> executed {0};
+};
+
+class SpawningTask : public Task {
+public:
+	SpawningTask(TaskScheduler &scheduler, ProducerToken &token, SpawningTaskCounters &counters, idx_t spawn_count)
+	    : scheduler(scheduler), token(token), counters(counters), spawn_count(spawn_count) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		if (spawn_count > 0) {
+			// tasks scheduled from a background thread end up in the local queue of that thread
+			for (idx_t i = 0; i < spawn_count; i++) {
+				scheduler.ScheduleTask(token, make_unique<SpawningTask>(scheduler, token, counters, 0));
+			}
+			counters.spawned++;
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		counters.executed++;
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	TaskScheduler &scheduler;
+	ProducerToken &token;
+	SpawningTaskCounters &counters;
+	idx_t spawn_count;
+};
+
+static void ScheduleSpawningTasks(TaskScheduler &scheduler, ProducerToken &token, SpawningTaskCounters &counters) {
+	for (idx_t i = 0; i < 4; i++) {
+		scheduler.ScheduleTask(token, make_unique<SpawningTask>(scheduler, token, counters, 100));
+	}
+	// wait until the spawning tasks ran, after which the local queues of the threads hold the tasks they spawned
+	while (counters.spawned < 4) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+TEST_CASE("Test stopping threads while tasks are queued", "[api]") {
+	DuckDB db(nullptr);
+	auto &scheduler = TaskScheduler::GetScheduler(*db.instance);
+	scheduler.SetThreads(4);
+
+	// the tasks that are still queued when the threads are stopped are moved to the global queue
+	SpawningTaskCounters counters;
+	auto token = scheduler.CreateProducer();
+	ScheduleSpawningTasks(scheduler, *token, counters);
+	scheduler.SetThreads(1);
+	unique_ptr<Task> task;
+	while (scheduler.GetTaskFromProducer(*token, task)) {
+		task->Execute(TaskExecutionMode::PROCESS_ALL);
+		task.reset();
+	}
+	REQUIRE(counters.executed == 400);
+
+	// the queued tasks of a producer that no longer exists are dropped
+	scheduler.SetThreads(4);
+	SpawningTaskCounters dropped_counters;
+	token = scheduler.CreateProducer();
+	ScheduleSpawningTasks(scheduler, *token, dropped_counters);
+	token.reset();
+	scheduler.SetThreads(1);
+	// no queue holds any of the dropped tasks anymore: the remaining thread finds nothing to run
+	auto executed = dropped_counters.executed.load();
+	atomic<bool> marker(true);
+	REQUIRE(scheduler.ExecuteTasks(&marker, 400) == 0);
+	REQUIRE(dropped_counters.executed == executed);
+}
@@ -15,15 +15,15 @@
 using namespace duckdb;
 
 struct ArrowRoundtripFactory {
-	ArrowRoundtripFactory(vector<LogicalType> types_p, vector<string> names_p, string tz_p,
+	ArrowRoundtripFactory(vector<LogicalType> types_p, vector<string> names_p, ClientProperties options_p,
 	                      unique_ptr<QueryResult> result_p, bool big_result)
-	    : types(std::move(types_p)), names(std::move(names_p)), tz(std::move(tz_p)), result(std::move(result_p)),
-	      big_result(big_result) {
+	    : types(std::move(types_p)), names(std::move(names_p)), options(std::move(options_p)),
+	      result(std::move(result_p)), big_result(big_result) {
 	}
 
 	vector<LogicalType> types;
 	vector<string> names;
-	string tz;
+	ClientProperties options;
 	unique_ptr<QueryResult> result;
 	bool big_result;
 
@@ -54,9 +54,11 @@ public:
 			if (!chunk || chunk->size() == 0) {
 				return 0;
 			}
-			ArrowConverter::ToArrowArray(*chunk, out);
+			ArrowAppender appender(data.factory.result->types, chunk->size(), data.factory.options);
+			appender.Append(*chunk);
+			*out = appender.Finalize();
 		} else {
-			ArrowAppender appender(data.factory.result->types, STANDARD_VECTOR_SIZE);
+			ArrowAppender appender(data.factory.result->types, STANDARD_VECTOR_SIZE, data.factory.options);
 			idx_t count = 0;
 			while (true) {
 				auto chunk = data.factory.result->Fetch();
@@ -113,7 +115,7 @@ public:
 	}
 
 	void ToArrowSchema(struct ArrowSchema *out) {
-		ArrowConverter::ToArrowSchema(out, types, names, tz);
+		ArrowConverter::ToArrowSchema(out, types, names, options);
 	}
 };
 
@@ -125,10 +127,11 @@ void RunArrowComparison(Connection &con, const string &query, bool big_result =
 		FAIL();
 	}
 	// create the roundtrip factory
-	auto tz = ClientConfig::GetConfig(*con.context).ExtractTimezone();
+	auto options = initial_result->client_properties;
 	auto types = initial_result->types;
 	auto names = initial_result->names;
-	ArrowRoundtripFactory factory(std::move(types), std::move(names), tz, std::move(initial_result), big_result);
+	ArrowRoundtripFactory factory(std::move(types), std::move(names), std::move(options), std::move(initial_result),
+	                              big_result);
 
 	// construct the arrow scan
 	vector<Value> params;
@@ -176,6 +179,15 @@ static void TestArrowRoundtrip(const string &query) {
 	RunArrowComparison(con, query);
 }
 
+static void TestArrowStringDictionaryRoundtrip(const string &query) {
+	DuckDB db;
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("SET arrow_string_dictionary=true"));
+	RunArrowComparison(con, query, true);
+	RunArrowComparison(con, query);
+}
+
 static void TestParquetRoundtrip(const string &path) {
 	DuckDB db;
 	Connection con(db);
@@ -223,6 +235,16 @@ TEST_CASE("Test arrow roundtrip", "[arrow]") {
 	                   "(interval (1) seconds AS interval) FROM test_all_types()");
 }
 
+TEST_CASE("Test arrow roundtrip of strings as dictionaries", "[arrow]") {
+	TestArrowStringDictionaryRoundtrip("SELECT 'thisisalongstring'||(i%7)::varchar str FROM range(10000) tbl(i)");
+	TestArrowStringDictionaryRoundtrip("SELECT case when i%3=0 then null else 'str'||(i%5)::varchar end str, i, "
+	                                   "[i::varchar] l FROM range(10000) tbl(i)");
+	TestArrowStringDictionaryRoundtrip("SELECT i::varchar str FROM range(5000) tbl(i)");
+	TestArrowStringDictionaryRoundtrip("SELECT NULL::varchar str, '' e FROM range(10) tbl(i)");
+	TestArrowStringDictionaryRoundtrip(
+	    "SELECT s.str FROM (SELECT 'x'||(i%3)::varchar str FROM range(3) tbl(i)) s, range(3000) tbl(i)");
+}
+
 TEST_CASE("Test Parquet Files round-trip", "[arrow][.]") {
 	std::vector<std::string> data;
 	// data.emplace_back("data/parquet-testing/7-set.snappy.arrow2.parquet");
@@ -2,8 +2,12 @@
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/fstream.hpp"
+#include "duckdb/common/io_thread_pool.hpp"
 #include "test_helpers.hpp"
 
+#include <chrono>
+#include <thread>
+
 using namespace duckdb;
 using namespace std;
 
@@ -96,3 +100,70 @@ TEST_CASE("Test file operations", "[file_system]") {
 	handle.reset();
 	fs->RemoveFile(fname);
 }
+
+TEST_CASE("Test batched file reads", "[file_system]") {
+	unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	unique_ptr<FileHandle> handle;
+	constexpr idx_t VALUE_COUNT = 100000;
+	vector<int64_t> test_data(VALUE_COUNT);
+	for (idx_t i = 0; i < VALUE_COUNT; i++) {
+		test_data[i] = i;
+	}
+
+	auto fname = TestCreatePath("test_file_batch");
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE,
+	                                      FileLockType::NO_LOCK));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data.data(), sizeof(int64_t) * VALUE_COUNT, 0));
+	handle.reset();
+
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ, FileLockType::NO_LOCK));
+	// read ranges of varying sizes from all over the file in a single batch
+	constexpr idx_t REQUEST_COUNT = 100;
+	vector<vector<int64_t>> buffers(REQUEST_COUNT);
+	vector<FileReadRequest> requests;
+	for (idx_t i = 0; i < REQUEST_COUNT; i++) {
+		idx_t offset = (i * 7919) % (VALUE_COUNT / 2);
+		idx_t count = 1 + (i * 104729) % (VALUE_COUNT / 2);
+		buffers[i].resize(count);
+		requests.emplace_back(buffers[i].data(), sizeof(int64_t) * count, sizeof(int64_t) * offset);
+	}
+	REQUIRE_NOTHROW(fs->ReadBatch(*handle, requests.data(), requests.size()));
+	for (idx_t i = 0; i < REQUEST_COUNT; i++) {
+		idx_t offset = requests[i].location / sizeof(int64_t);
+		REQUIRE(memcmp(buffers[i].data(), test_data.data() + offset, sizeof(int64_t) * buffers[i].size()) == 0);
+	}
+
+	// reading past the end of the file fails
+	int64_t value;
+	FileReadRequest invalid_requests[2] = {FileReadRequest(buffers[0].data(), sizeof(int64_t), 0),
+	                                       FileReadRequest(&value, sizeof(int64_t), sizeof(int64_t) * VALUE_COUNT)};
+	REQUIRE_THROWS(fs->ReadBatch(*handle, invalid_requests, 2));
+	handle.reset();
+	fs->RemoveFile(fname);
+}
+
+TEST_CASE("Test the I/O thread pool", "[file_system]") {
+	auto &pool = IOThreadPool::Get();
+	constexpr idx_t TASK_COUNT = 1000;
+	vector<atomic<idx_t>> runs(TASK_COUNT);
+	for (auto &run : runs) {
+		run = 0;
+	}
+	// every task runs exactly once, also when batches are nested in the tasks of another batch
+	pool.Run(TASK_COUNT / 10, IOThreadPool::MAX_THREADS, [&](idx_t outer_idx) {
+		pool.Run(10, 4, [&](idx_t inner_idx) { runs[outer_idx * 10 + inner_idx]++; });
+	});
+	for (auto &run : runs) {
+		REQUIRE(run == 1);
+	}
+	// an exception is rethrown once the other tasks have finished, and no further tasks are started
+	atomic<idx_t> started(0);
+	REQUIRE_THROWS(pool.Run(TASK_COUNT, IOThreadPool::MAX_THREADS, [&](idx_t task_idx) {
+		started++;
+		if (task_idx == 0) {
+			throw IOException("task failed");
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}));
+	REQUIRE(started < TASK_COUNT);
+}
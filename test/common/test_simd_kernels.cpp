@@ -0,0 +1,179 @@
+#include "catch.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/simd_kernels.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace duckdb;
+using namespace std;
+
+//! Dispatches the kernels to an instruction set, and back to the best supported one when the test ends
+struct InstructionSetOverride {
+	explicit InstructionSetOverride(SIMDInstructionSet instruction_set) {
+		SIMDKernels::SetInstructionSet(instruction_set);
+	}
+	~InstructionSetOverride() {
+		SIMDKernels::SetInstructionSet(SIMDKernels::GetSupportedInstructionSet());
+	}
+};
+
+//! The instruction sets supported by this machine, starting with NONE (the scalar fallback of the callers)
+static vector<SIMDInstructionSet> SupportedInstructionSets() {
+	vector<SIMDInstructionSet> result;
+	for (auto instruction_set : {SIMDInstructionSet::NONE, SIMDInstructionSet::AVX2, SIMDInstructionSet::AVX512}) {
+		if (uint8_t(instruction_set) <= uint8_t(SIMDKernels::GetSupportedInstructionSet())) {
+			result.push_back(instruction_set);
+		}
+	}
+	return result;
+}
+
+template <class T>
+static bool ExpectedComparison(T left, T right, ExpressionType comparison_type) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return left == right;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return left != right;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return left < right;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return left <= right;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return left > right;
+	default:
+		return left >= right;
+	}
+}
+
+template <class T>
+static void TestSIMDSelectConstant(SIMDInstructionSet instruction_set) {
+	const ExpressionType comparison_types[] = {
+	    ExpressionType::COMPARE_EQUAL,       ExpressionType::COMPARE_NOTEQUAL,
+	    ExpressionType::COMPARE_LESSTHAN,    ExpressionType::COMPARE_LESSTHANOREQUALTO,
+	    ExpressionType::COMPARE_GREATERTHAN, ExpressionType::COMPARE_GREATERTHANOREQUALTO};
+	// counts that are not a multiple of the register width exercise the scalar tails
+	const idx_t counts[] = {0, 1, 7, 15, 17, 1000, STANDARD_VECTOR_SIZE};
+
+	std::mt19937 rng(42);
+	std::uniform_int_distribution<int> dist(-5, 5);
+	for (auto count : counts) {
+		vector<T> data(count);
+		for (auto &value : data) {
+			value = T(dist(rng));
+		}
+		for (auto comparison_type : comparison_types) {
+			for (int constant = -6; constant <= 6; constant += 3) {
+				SelectionVector true_sel(STANDARD_VECTOR_SIZE);
+				SelectionVector false_sel(STANDARD_VECTOR_SIZE);
+				idx_t true_count;
+				if (!SIMDKernels::SelectConstant<T>(data.data(), T(constant), comparison_type, count, &true_sel,
+				                                    &false_sel, true_count)) {
+					// only disabled kernels leave the comparison to the scalar loop of the caller
+					REQUIRE(instruction_set == SIMDInstructionSet::NONE);
+					return;
+				}
+				idx_t expected_true = 0, expected_false = 0;
+				for (idx_t i = 0; i < count; i++) {
+					if (ExpectedComparison<T>(data[i], T(constant), comparison_type)) {
+						REQUIRE(true_sel.get_index(expected_true++) == i);
+					} else {
+						REQUIRE(false_sel.get_index(expected_false++) == i);
+					}
+				}
+				REQUIRE(true_count == expected_true);
+
+				// only a true selection
+				SelectionVector only_true_sel(STANDARD_VECTOR_SIZE);
+				idx_t only_true_count;
+				REQUIRE(SIMDKernels::SelectConstant<T>(data.data(), T(constant), comparison_type, count,
+				                                       &only_true_sel, nullptr, only_true_count));
+				REQUIRE(only_true_count == expected_true);
+				for (idx_t i = 0; i < only_true_count; i++) {
+					REQUIRE(only_true_sel.get_index(i) == true_sel.get_index(i));
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("Test SIMD constant comparison kernels", "[simd]") {
+	for (auto instruction_set : SupportedInstructionSets()) {
+		InstructionSetOverride instruction_set_override(instruction_set);
+		TestSIMDSelectConstant<int32_t>(instruction_set);
+		TestSIMDSelectConstant<int64_t>(instruction_set);
+	}
+}
+
+template <class T>
+static void TestSIMDHash(SIMDInstructionSet instruction_set, const LogicalType &type) {
+	std::mt19937_64 rng(42);
+	for (idx_t count : {idx_t(0), idx_t(3), idx_t(13), idx_t(STANDARD_VECTOR_SIZE)}) {
+		Vector input(type);
+		auto data = FlatVector::GetData<T>(input);
+		for (idx_t i = 0; i < count; i++) {
+			data[i] = T(rng());
+		}
+		// the hash of a flat vector goes through the kernel, or through the scalar loop if the kernels are disabled
+		Vector hashes(LogicalType::HASH);
+		VectorOperations::Hash(input, hashes, count);
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		for (idx_t i = 0; i < count; i++) {
+			REQUIRE(hash_data[i] == duckdb::Hash<T>(data[i]));
+		}
+
+		vector<hash_t> result(count);
+		if (!SIMDKernels::Hash<T>(data, result.data(), count)) {
+			REQUIRE(instruction_set == SIMDInstructionSet::NONE);
+			continue;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			REQUIRE(result[i] == duckdb::Hash<T>(data[i]));
+		}
+	}
+}
+
+TEST_CASE("Test SIMD hash kernels", "[simd]") {
+	for (auto instruction_set : SupportedInstructionSets()) {
+		InstructionSetOverride instruction_set_override(instruction_set);
+		TestSIMDHash<int32_t>(instruction_set, LogicalType::INTEGER);
+		TestSIMDHash<int64_t>(instruction_set, LogicalType::BIGINT);
+	}
+}
+
+static void TestSIMDMatchCharacters(SIMDInstructionSet instruction_set) {
+	std::mt19937 rng(42);
+	const char alphabet[] = {'a', 'b', ',', '"', '\n', '\r', '\\', '\0'};
+	// groups of four characters: unused slots repeat a character of the group
+	const char characters[] = {',', '\n', '\r', ',', '"', '\\', '"', '\\', '\0', '\0', '\0', '\0'};
+	for (idx_t iteration = 0; iteration < 100; iteration++) {
+		char data[SIMDKernels::CHARACTER_BLOCK_SIZE];
+		for (auto &c : data) {
+			c = alphabet[rng() % sizeof(alphabet)];
+		}
+		uint64_t masks[3];
+		if (!SIMDKernels::MatchCharacters(data, characters, 3, masks)) {
+			REQUIRE(instruction_set == SIMDInstructionSet::NONE);
+			return;
+		}
+		for (idx_t group_idx = 0; group_idx < 3; group_idx++) {
+			for (idx_t i = 0; i < SIMDKernels::CHARACTER_BLOCK_SIZE; i++) {
+				bool expected = false;
+				for (idx_t char_idx = 0; char_idx < 4; char_idx++) {
+					expected = expected || data[i] == characters[group_idx * 4 + char_idx];
+				}
+				REQUIRE(((masks[group_idx] >> i) & 1) == uint64_t(expected));
+			}
+		}
+	}
+}
+
+TEST_CASE("Test SIMD character matching", "[simd]") {
+	for (auto instruction_set : SupportedInstructionSets()) {
+		InstructionSetOverride instruction_set_override(instruction_set);
+		TestSIMDMatchCharacters(instruction_set);
+	}
+}
@@ -0,0 +1,155 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#ifdef BUILD_HTTPFS_EXTENSION
+#include "http_block_cache.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+static const char *TEST_URL = "http://localhost/test.parquet";
+
+static vector<data_t> TestBlock(idx_t block_idx, idx_t block_len) {
+	vector<data_t> block(block_len);
+	for (idx_t i = 0; i < block_len; i++) {
+		block[i] = data_t(block_idx * 31 + i);
+	}
+	return block;
+}
+
+static string TestKey(idx_t block_idx) {
+	return HTTPBlockCache::GetBlockKey(TEST_URL, "v1", block_idx);
+}
+
+TEST_CASE("Test the HTTP block cache", "[extension]") {
+	DuckDB db(nullptr);
+	auto &buffer_manager = BufferManager::GetBufferManager(*db.instance);
+	auto directory = TestCreatePath("http_block_cache");
+	TestDeleteDirectory(directory);
+
+	const idx_t block_len = 1000;
+	// blocks in memory take up at least a block of the buffer manager: two of them fit
+	const idx_t memory_limit = Storage::BLOCK_SIZE * 5 / 2;
+	// three block files fit on disk
+	const idx_t disk_limit = 3 * (sizeof(uint64_t) + TestKey(0).size() + block_len);
+
+	vector<data_t> buffer(block_len);
+	{
+		HTTPBlockCache cache(buffer_manager, memory_limit, disk_limit, directory);
+		for (idx_t block_idx = 0; block_idx < 3; block_idx++) {
+			cache.Put(TestKey(block_idx), TestBlock(block_idx, block_len).data(), block_len);
+		}
+
+		// the last two blocks are in memory
+		REQUIRE(cache.Get(TestKey(2), buffer.data(), block_len));
+		REQUIRE(buffer == TestBlock(2, block_len));
+		REQUIRE(cache.memory_hits == 1);
+
+		// the first block was evicted from memory, but it is still on disk
+		REQUIRE(cache.Get(TestKey(0), buffer.data(), block_len));
+		REQUIRE(buffer == TestBlock(0, block_len));
+		REQUIRE(cache.disk_hits == 1);
+
+		// other versions of the file and other block lengths are not returned
+		REQUIRE(!cache.Get(HTTPBlockCache::GetBlockKey(TEST_URL, "v2", 0), buffer.data(), block_len));
+		REQUIRE(!cache.Get(TestKey(1), buffer.data(), block_len - 1));
+		REQUIRE(cache.misses == 2);
+
+		// another block evicts the least recently used block from memory and from disk
+		cache.Put(TestKey(3), TestBlock(3, block_len).data(), block_len);
+		REQUIRE(!cache.Contains(TestKey(1)));
+		REQUIRE(cache.Contains(TestKey(0)));
+		REQUIRE(cache.Contains(TestKey(2)));
+	}
+
+	// a new cache picks up the blocks that were persisted on disk
+	{
+		HTTPBlockCache cache(buffer_manager, memory_limit, disk_limit, directory);
+		REQUIRE(cache.Get(TestKey(3), buffer.data(), block_len));
+		REQUIRE(buffer == TestBlock(3, block_len));
+		REQUIRE(cache.disk_hits == 1);
+		REQUIRE(!cache.Contains(TestKey(1)));
+
+		// lowering the limits evicts blocks right away
+		cache.SetLimits(0, 0);
+		REQUIRE(!cache.Contains(TestKey(3)));
+		REQUIRE(!cache.Get(TestKey(3), buffer.data(), block_len));
+	}
+	TestDeleteDirectory(directory);
+}
+
+TEST_CASE("Test the HTTP block cache when the buffer manager needs the memory", "[extension]") {
+	DBConfig config;
+	config.options.maximum_memory = 4 * Storage::BLOCK_ALLOC_SIZE;
+	DuckDB db(nullptr, &config);
+	auto &buffer_manager = BufferManager::GetBufferManager(*db.instance);
+
+	const idx_t block_len = 1000;
+	HTTPBlockCache cache(buffer_manager, HTTPBlockCacheParams::DEFAULT_MEMORY_LIMIT, 0, string());
+	for (idx_t block_idx = 0; block_idx < 2; block_idx++) {
+		cache.Put(TestKey(block_idx), TestBlock(block_idx, block_len).data(), block_len);
+	}
+	vector<data_t> buffer(block_len);
+	REQUIRE(cache.Get(TestKey(0), buffer.data(), block_len));
+	REQUIRE(cache.memory_hits == 1);
+
+	// the cached blocks are not pinned: pinning all memory destroys them
+	vector<BufferHandle> pinned_buffers;
+	for (idx_t i = 0; i < buffer_manager.GetMaxMemory() / Storage::BLOCK_ALLOC_SIZE; i++) {
+		pinned_buffers.push_back(buffer_manager.Allocate(Storage::BLOCK_SIZE, false));
+	}
+
+	// a destroyed block is a miss, and is removed from the cache
+	REQUIRE(!cache.Get(TestKey(0), buffer.data(), block_len));
+	REQUIRE(!cache.Get(TestKey(1), buffer.data(), block_len));
+	REQUIRE(cache.misses == 2);
+	REQUIRE(!cache.Contains(TestKey(0)));
+	REQUIRE(!cache.Contains(TestKey(1)));
+
+	// once the memory is released, blocks are cached in memory again
+	pinned_buffers.clear();
+	cache.Put(TestKey(0), TestBlock(0, block_len).data(), block_len);
+	REQUIRE(cache.Get(TestKey(0), buffer.data(), block_len));
+	REQUIRE(buffer == TestBlock(0, block_len));
+	REQUIRE(cache.memory_hits == 2);
+}
+
+TEST_CASE("Test concurrent use of the HTTP block cache", "[extension]") {
+	DuckDB db(nullptr);
+	auto &buffer_manager = BufferManager::GetBufferManager(*db.instance);
+	auto directory = TestCreatePath("http_block_cache_concurrent");
+	TestDeleteDirectory(directory);
+
+	const idx_t block_len = 4096;
+	const idx_t block_count = 16;
+	// the limits are small, so blocks are constantly evicted while others read them
+	HTTPBlockCache cache(buffer_manager, 4 * Storage::BLOCK_SIZE, 8 * (block_len + 64), directory);
+
+	const idx_t thread_count = 4;
+	atomic<idx_t> wrong_blocks(0);
+	vector<thread> threads;
+	for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+		threads.emplace_back([&, thread_idx]() {
+			vector<data_t> buffer(block_len);
+			for (idx_t i = 0; i < 200; i++) {
+				auto block_idx = (i * 7 + thread_idx) % block_count;
+				if (cache.Get(TestKey(block_idx), buffer.data(), block_len)) {
+					if (buffer != TestBlock(block_idx, block_len)) {
+						wrong_blocks++;
+					}
+				} else {
+					cache.Put(TestKey(block_idx), TestBlock(block_idx, block_len).data(), block_len);
+				}
+			}
+		});
+	}
+	for (auto &worker : threads) {
+		worker.join();
+	}
+	REQUIRE(wrong_blocks == 0);
+	REQUIRE(cache.memory_hits + cache.disk_hits + cache.misses == thread_count * 200);
+	TestDeleteDirectory(directory);
+}
+#endif
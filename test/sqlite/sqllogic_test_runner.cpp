@@ -3,6 +3,7 @@
 
 #include "sqllogic_test_runner.hpp"
 #include "test_helpers.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "sqllogic_parser.hpp"
 #ifdef DUCKDB_OUT_OF_TREE
@@ -180,6 +181,7 @@ bool SQLLogicTestRunner::ForEachTokenReplace(const string &parameter, vector<str
 		result.push_back("fsst");
 		result.push_back("chimp");
 		result.push_back("patas");
+		result.push_back("alp");
 		collection = true;
 	}
 	return collection;
@@ -501,6 +503,11 @@ void SQLLogicTestRunner::ExecuteFile(string script) {
 					// vector size is too low for this test: skip it
 					return;
 				}
+			} else if (param == "hardware_counters") {
+				if (!HardwareCounters::Get().IsAvailable()) {
+					// the machine does not allow reading the CPU performance counters
+					return;
+				}
 			} else if (param == "skip_reload") {
 				skip_reload = true;
 			} else {
@@ -10,6 +10,8 @@
 #include "duckdb_python/pyconnection.hpp"
 #include "duckdb_python/pyresult.hpp"
 #include "duckdb/common/types/uuid.hpp"
+#include "duckdb/common/types/column_data_collection.hpp"
+#include "duckdb/parallel/task_counter.hpp"
 
 namespace duckdb {
 
@@ -635,7 +637,32 @@ void ArrayWrapper::Resize(idx_t new_capacity) {
 	mask->Resize(new_capacity);
 }
 
+bool ArrayWrapper::CreatesPythonObjects(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIME_TZ:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::BIT:
+	case LogicalTypeId::LIST:
+	case LogicalTypeId::MAP:
+	case LogicalTypeId::STRUCT:
+	case LogicalTypeId::UUID:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
+	if (Convert(current_offset, input, count)) {
+		requires_mask = true;
+	}
+	data->count += count;
+	mask->count += count;
+}
+
+bool ArrayWrapper::Convert(idx_t current_offset, Vector &input, idx_t count) {
 	auto dataptr = data->data;
 	auto maskptr = (bool *)mask->data;
 	D_ASSERT(dataptr);
@@ -761,11 +788,7 @@ void ArrayWrapper::Append(idx_t current_offset, Vector &input, idx_t count) {
 	default:
 		throw NotImplementedException("Unsupported type \"%s\"", input.GetType().ToString());
 	}
-	if (may_have_null) {
-		requires_mask = true;
-	}
-	data->count += count;
-	mask->count += count;
+	return may_have_null;
 }
 
 py::object ArrayWrapper::ToArray(idx_t count) const {
@@ -823,4 +846,137 @@ void NumpyResultConversion::Append(DataChunk &chunk) {
 #endif
 }
 
+//! The shared state of the tasks that convert the columns of a collection that do not create Python objects
+struct NumpyConversionState {
+	NumpyConversionState(ColumnDataCollection &collection, vector<ArrayWrapper> &arrays, vector<column_t> column_ids_p)
+	    : collection(collection), arrays(arrays), column_ids(std::move(column_ids_p)),
+	      may_have_null(column_ids.size(), false), has_error(false) {
+		collection.InitializeScan(scan_state, column_ids);
+	}
+
+	ColumnDataCollection &collection;
+	vector<ArrayWrapper> &arrays;
+	vector<column_t> column_ids;
+	ColumnDataParallelScanState scan_state;
+
+	mutex lock;
+	vector<bool> may_have_null;
+	std::exception_ptr error;
+	atomic<bool> has_error;
+};
+
+//! Converts chunks of the collection until all of them are taken, each chunk is written to its own row range
+class NumpyConversionTask : public Task {
+public:
+	NumpyConversionTask(NumpyConversionState &state, TaskCounter &counter) : state(state), counter(counter) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			DataChunk chunk;
+			state.collection.InitializeScanChunk(state.scan_state.scan_state, chunk);
+			ColumnDataLocalScanState local_state;
+			vector<bool> may_have_null(state.column_ids.size(), false);
+			while (!state.has_error && state.collection.Scan(state.scan_state, local_state, chunk)) {
+				for (idx_t i = 0; i < state.column_ids.size(); i++) {
+					auto &array = state.arrays[state.column_ids[i]];
+					if (array.Convert(local_state.current_row_index, chunk.data[i], chunk.size())) {
+						may_have_null[i] = true;
+					}
+				}
+			}
+			lock_guard<mutex> guard(state.lock);
+			for (idx_t i = 0; i < may_have_null.size(); i++) {
+				if (may_have_null[i]) {
+					state.may_have_null[i] = true;
+				}
+			}
+		} catch (...) {
+			lock_guard<mutex> guard(state.lock);
+			if (!state.error) {
+				state.error = std::current_exception();
+			}
+			state.has_error = true;
+		}
+		counter.FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	NumpyConversionState &state;
+	TaskCounter &counter;
+};
+
+void NumpyResultConversion::Append(ColumnDataCollection &collection, TaskScheduler *scheduler) {
+	const auto row_count = collection.Count();
+	D_ASSERT(count + row_count <= capacity);
+	D_ASSERT(count == 0);
+	vector<column_t> object_columns;
+	vector<column_t> parallel_columns;
+	for (idx_t col_idx = 0; col_idx < owned_data.size(); col_idx++) {
+		if (ArrayWrapper::CreatesPythonObjects(collection.Types()[col_idx])) {
+			object_columns.push_back(col_idx);
+		} else {
+			parallel_columns.push_back(col_idx);
+		}
+	}
+	const auto task_count = scheduler ? MinValue<idx_t>(scheduler->NumberOfThreads(), collection.ChunkCount()) : 0;
+	if (task_count <= 1 || parallel_columns.empty()) {
+		for (auto &chunk : collection.Chunks()) {
+			Append(chunk);
+		}
+		return;
+	}
+
+	// the columns that do not create Python objects are converted by the scheduler threads
+	NumpyConversionState state(collection, owned_data, parallel_columns);
+	TaskCounter counter(*scheduler);
+	for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+		counter.AddTask(make_unique<NumpyConversionTask>(state, counter));
+	}
+
+	// in the meantime, we convert the columns that create Python objects while holding the GIL
+	// the tasks refer to the state, so we always wait for them before throwing
+	std::exception_ptr object_error;
+	try {
+		idx_t offset = 0;
+		if (!object_columns.empty()) {
+			for (auto &chunk : collection.Chunks(object_columns)) {
+				for (idx_t i = 0; i < object_columns.size(); i++) {
+					auto &array = owned_data[object_columns[i]];
+					if (array.Convert(offset, chunk.data[i], chunk.size())) {
+						array.requires_mask = true;
+					}
+				}
+				offset += chunk.size();
+			}
+		}
+	} catch (...) {
+		object_error = std::current_exception();
+		state.has_error = true;
+	}
+
+	// then we work on the remaining tasks ourselves, and wait for the tasks that were picked up by other threads
+	{
+		py::gil_scoped_release release;
+		counter.Finish();
+	}
+	if (object_error) {
+		std::rethrow_exception(object_error);
+	}
+	if (state.has_error) {
+		std::rethrow_exception(state.error);
+	}
+	for (idx_t i = 0; i < parallel_columns.size(); i++) {
+		if (state.may_have_null[i]) {
+			owned_data[parallel_columns[i]].requires_mask = true;
+		}
+	}
+	for (auto &data : owned_data) {
+		data.data->count += row_count;
+		data.mask->count += row_count;
+	}
+	count += row_count;
+}
+
 } // namespace duckdb
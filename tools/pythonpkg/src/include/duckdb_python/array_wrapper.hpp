@@ -12,6 +12,8 @@
 #include "duckdb.hpp"
 
 namespace duckdb {
+class TaskScheduler;
+
 struct RawArrayWrapper {
 	explicit RawArrayWrapper(const LogicalType &type);
 
@@ -37,7 +39,13 @@ public:
 	void Initialize(idx_t capacity);
 	void Resize(idx_t new_capacity);
 	void Append(idx_t current_offset, Vector &input, idx_t count);
+	//! Converts count values of the input into the arrays at current_offset, without appending them. Returns whether
+	//! the values may contain NULLs. Only requires the GIL if the type creates Python objects.
+	bool Convert(idx_t current_offset, Vector &input, idx_t count);
 	py::object ToArray(idx_t count) const;
+
+	//! Whether the values of the type are converted to Python objects
+	static bool CreatesPythonObjects(const LogicalType &type);
 };
 
 class NumpyResultConversion {
@@ -45,6 +53,9 @@ public:
 	NumpyResultConversion(vector<LogicalType> &types, idx_t initial_capacity);
 
 	void Append(DataChunk &chunk);
+	//! Appends all chunks of a collection, which must fit in the capacity of the arrays. Columns that are not converted
+	//! to Python objects are converted in parallel on the task scheduler, without holding the GIL.
+	void Append(ColumnDataCollection &collection, TaskScheduler *scheduler);
 
 	py::object ToArray(idx_t col_idx) {
 		return owned_data[col_idx].ToArray(count);
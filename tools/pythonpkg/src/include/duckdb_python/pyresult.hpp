@@ -17,7 +17,7 @@ namespace duckdb {
 
 struct DuckDBPyResult {
 public:
-	explicit DuckDBPyResult(unique_ptr<QueryResult> result);
+	explicit DuckDBPyResult(unique_ptr<QueryResult> result, const shared_ptr<ClientContext> &context = nullptr);
 
 public:
 	Optional<py::tuple> Fetchone();
@@ -67,6 +67,8 @@ private:
 	idx_t chunk_offset = 0;
 
 	unique_ptr<QueryResult> result;
+	// The context that produced the result, whose task scheduler converts the result to NumPy arrays
+	weak_ptr<ClientContext> context;
 	unique_ptr<DataChunk> current_chunk;
 	// Holds the categories of Categorical/ENUM types
 	unordered_map<idx_t, py::list> categories;
@@ -410,7 +410,7 @@ unique_ptr<QueryResult> DuckDBPyConnection::ExecuteInternal(const string &query,
 shared_ptr<DuckDBPyConnection> DuckDBPyConnection::Execute(const string &query, py::object params, bool many) {
 	auto res = ExecuteInternal(query, std::move(params), many);
 	if (res) {
-		auto py_result = make_unique<DuckDBPyResult>(std::move(res));
+		auto py_result = make_unique<DuckDBPyResult>(std::move(res), connection->context);
 		result = make_unique<DuckDBPyRelation>(std::move(py_result));
 	}
 	return shared_from_this();
@@ -436,7 +436,7 @@ shared_ptr<DuckDBPyConnection> DuckDBPyConnection::ExecuteSuspend(const string &
     std::cout << "## Query will suspend after " << global_suspend_point_ms << " ms ##" << std::endl;
     auto res = ExecuteInternal(query, std::move(params), many);
     if (res) {
-        auto py_result = make_unique<DuckDBPyResult>(std::move(res));
+        auto py_result = make_unique<DuckDBPyResult>(std::move(res), connection->context);
         result = make_unique<DuckDBPyRelation>(std::move(py_result));
     }
     return shared_from_this();
@@ -456,7 +456,7 @@ shared_ptr<DuckDBPyConnection> DuckDBPyConnection::ExecuteResume(const string &q
     }
     auto res = ExecuteInternal(query,  std::move(params), many);
     if (res) {
-        auto py_result = make_unique<DuckDBPyResult>(std::move(res));
+        auto py_result = make_unique<DuckDBPyResult>(std::move(res), connection->context);
         result = make_unique<DuckDBPyRelation>(std::move(py_result));
     }
     return shared_from_this();
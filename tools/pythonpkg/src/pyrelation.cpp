@@ -497,7 +497,7 @@ void DuckDBPyRelation::ExecuteOrThrow() {
 	if (query_result->HasError()) {
 		query_result->ThrowError();
 	}
-	result = make_unique<DuckDBPyResult>(std::move(query_result));
+	result = make_unique<DuckDBPyResult>(std::move(query_result), rel->context.GetContext());
 }
 
 DataFrame DuckDBPyRelation::FetchDF(bool date_as_object) {
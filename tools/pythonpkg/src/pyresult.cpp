@@ -14,10 +14,12 @@
 #include "duckdb/common/types/uuid.hpp"
 #include "duckdb_python/array_wrapper.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
-DuckDBPyResult::DuckDBPyResult(unique_ptr<QueryResult> result_p) : result(std::move(result_p)) {
+DuckDBPyResult::DuckDBPyResult(unique_ptr<QueryResult> result_p, const shared_ptr<ClientContext> &context_p)
+    : result(std::move(result_p)), context(context_p) {
 	if (!result) {
 		throw InternalException("PyResult created without a result object");
 	}
@@ -174,9 +176,9 @@ py::dict DuckDBPyResult::FetchNumpyInternal(bool stream, idx_t vectors_per_chunk
 	NumpyResultConversion conversion(result->types, initial_capacity);
 	if (result->type == QueryResultType::MATERIALIZED_RESULT) {
 		auto &materialized = (MaterializedQueryResult &)*result;
-		for (auto &chunk : materialized.Collection().Chunks()) {
-			conversion.Append(chunk);
-		}
+		auto client_context = context.lock();
+		auto scheduler = client_context ? &TaskScheduler::GetScheduler(*client_context) : nullptr;
+		conversion.Append(materialized.Collection(), scheduler);
 		InsertCategory(materialized, categories);
 		materialized.Collection().Reset();
 	} else {
@@ -278,8 +280,7 @@ bool DuckDBPyResult::FetchArrowChunk(QueryResult *result, py::list &batches, idx
 		return false;
 	}
 	ArrowSchema arrow_schema;
-	timezone_config = QueryResult::GetConfigTimezone(*result);
-	ArrowConverter::ToArrowSchema(&arrow_schema, result->types, result->names, timezone_config);
+	ArrowConverter::ToArrowSchema(&arrow_schema, result->types, result->names, result->client_properties);
 	TransformDuckToArrowChunk(arrow_schema, data, batches);
 	return true;
 }
@@ -309,8 +310,7 @@ duckdb::pyarrow::Table DuckDBPyResult::FetchArrowTable(idx_t chunk_size) {
 	auto schema_import_func = pyarrow_lib_module.attr("Schema").attr("_import_from_c");
 	ArrowSchema schema;
 
-	timezone_config = QueryResult::GetConfigTimezone(*result);
-	ArrowConverter::ToArrowSchema(&schema, result->types, result->names, timezone_config);
+	ArrowConverter::ToArrowSchema(&schema, result->types, result->names, result->client_properties);
 
 	auto schema_obj = schema_import_func((uint64_t)&schema);
 
@@ -0,0 +1,33 @@
+import duckdb
+import pandas as pd
+import numpy
+
+class TestParallelFetchDF(object):
+    def test_parallel_fetchdf(self, duckdb_cursor):
+        con = duckdb.connect()
+        con.execute("PRAGMA threads=4")
+        query = """
+            SELECT i, i * 2 AS d, CASE WHEN i % 7 = 0 THEN NULL ELSE i END AS n, (i % 3)::VARCHAR AS s,
+                   DATE '2000-01-01' + (i % 1000)::INTEGER AS dt
+            FROM range(1000000) tbl(i)
+        """
+        df = con.execute(query).fetchdf()
+        assert len(df) == 1000000
+        assert numpy.array_equal(df['i'].to_numpy(), numpy.arange(1000000))
+        assert numpy.array_equal(df['d'].to_numpy(), numpy.arange(1000000) * 2)
+        assert df['n'].isna().sum() == 142858
+        assert df['n'].sum() == sum(i for i in range(1000000) if i % 7 != 0)
+        assert list(df['s'][:4]) == ['0', '1', '2', '0']
+        assert df['dt'][1001] == pd.Timestamp('2000-01-02')
+
+        # the same conversion on a single thread
+        con.execute("PRAGMA threads=1")
+        single_df = con.execute(query).fetchdf()
+        pd.testing.assert_frame_equal(df, single_df)
+
+    def test_parallel_fetchnumpy(self, duckdb_cursor):
+        con = duckdb.connect()
+        con.execute("PRAGMA threads=4")
+        res = con.sql("SELECT i::DOUBLE AS f, NULL::INTEGER AS z FROM range(100000) tbl(i)").fetchnumpy()
+        assert numpy.array_equal(res['f'], numpy.arange(100000, dtype=numpy.float64))
+        assert numpy.ma.getmaskarray(res['z']).all()